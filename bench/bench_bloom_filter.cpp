@@ -0,0 +1,223 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+
+#include "benchmark.hpp"
+
+#include "typhoon/bloom_filter.hpp"
+#include "typhoon/blocked_bloom_filter.hpp"
+#include "typhoon/span.hpp"
+
+#include <stdint.h>
+#include <vector>
+
+//
+// Both filters hold eight million keys in the same number of bits, about
+// 12MB. The 65536 keys looked up touch more lines than the L2 cache holds,
+// so most lookups miss it. Half of the looked up keys were added.
+// The '_bloom_filter' twins use tpn::bloom_filter with three hashes, so each
+// lookup reads up to three cache lines.
+//
+namespace
+{
+  const size_t Keys   = 8000000U;
+  const size_t Lookup = 65536U;
+
+  typedef tpn::blocked_bloom_filter<uint32_t, Keys, 100U> blocked_filter;
+
+  //***************************************************************************
+  /// A seeded mix of a 32 bit key, for the three hashes of bloom_filter.
+  //***************************************************************************
+  template <uint32_t VSeed>
+  struct seeded_hash
+  {
+    typedef uint32_t argument_type;
+
+    size_t operator ()(uint32_t key) const
+    {
+      uint32_t h = key ^ VSeed;
+      h ^= h >> 16U;
+      h *= 0x85EBCA6BU;
+      h ^= h >> 13U;
+      h *= 0xC2B2AE35U;
+      h ^= h >> 16U;
+
+      return h;
+    }
+  };
+
+  typedef tpn::bloom_filter<blocked_filter::Bits,
+                            seeded_hash<0x9E3779B9U>,
+                            seeded_hash<0x7F4A7C15U>,
+                            seeded_hash<0xF39CC060U> > classic_filter;
+
+  //***************************************************************************
+  /// Added keys are even, missing keys are odd.
+  //***************************************************************************
+  const std::vector<uint32_t>& lookup_keys()
+  {
+    static std::vector<uint32_t> keys;
+
+    if (keys.empty())
+    {
+      uint32_t x = 12345U;
+
+      for (size_t i = 0U; i < Lookup; ++i)
+      {
+        x = (x * 1664525U) + 1013904223U;
+        keys.push_back(((x >> 8U) % Keys) * 2U + (i & 1U));
+      }
+    }
+
+    return keys;
+  }
+
+  //***************************************************************************
+  blocked_filter& filled_blocked_filter()
+  {
+    static blocked_filter* p_filter = nullptr;
+
+    if (p_filter == nullptr)
+    {
+      p_filter = new blocked_filter;
+
+      for (uint32_t i = 0U; i < Keys; ++i)
+      {
+        p_filter->add(i * 2U);
+      }
+    }
+
+    return *p_filter;
+  }
+
+  //***************************************************************************
+  classic_filter& filled_classic_filter()
+  {
+    static classic_filter* p_filter = nullptr;
+
+    if (p_filter == nullptr)
+    {
+      p_filter = new classic_filter;
+
+      for (uint32_t i = 0U; i < Keys; ++i)
+      {
+        p_filter->add(i * 2U);
+      }
+    }
+
+    return *p_filter;
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(blocked_bloom_filter_exists)
+{
+  const blocked_filter& filter = filled_blocked_filter();
+  const std::vector<uint32_t>& keys = lookup_keys();
+
+  for (auto _ : state)
+  {
+    size_t found = 0U;
+
+    for (size_t i = 0U; i < keys.size(); ++i)
+    {
+      found += filter.exists(keys[i]) ? 1U : 0U;
+    }
+
+    bench::do_not_optimize(found);
+  }
+
+  state.set_items_per_iteration(keys.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(blocked_bloom_filter_exists_batch)
+{
+  const blocked_filter& filter = filled_blocked_filter();
+  const std::vector<uint32_t>& keys = lookup_keys();
+  static bool results[Lookup];
+
+  for (auto _ : state)
+  {
+    size_t found = filter.exists_batch(tpn::span<const uint32_t>(keys.data(), keys.size()),
+                                       tpn::span<bool>(results, Lookup));
+    bench::do_not_optimize(found);
+  }
+
+  state.set_items_per_iteration(keys.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(blocked_bloom_filter_exists_bloom_filter)
+{
+  const classic_filter& filter = filled_classic_filter();
+  const std::vector<uint32_t>& keys = lookup_keys();
+
+  for (auto _ : state)
+  {
+    size_t found = 0U;
+
+    for (size_t i = 0U; i < keys.size(); ++i)
+    {
+      found += filter.exists(keys[i]) ? 1U : 0U;
+    }
+
+    bench::do_not_optimize(found);
+  }
+
+  state.set_items_per_iteration(keys.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(blocked_bloom_filter_add_batch)
+{
+  blocked_filter& filter = filled_blocked_filter();
+  const std::vector<uint32_t>& keys = lookup_keys();
+
+  for (auto _ : state)
+  {
+    filter.add_batch(tpn::span<const uint32_t>(keys.data(), keys.size()));
+  }
+
+  state.set_items_per_iteration(keys.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(blocked_bloom_filter_add)
+{
+  blocked_filter& filter = filled_blocked_filter();
+  const std::vector<uint32_t>& keys = lookup_keys();
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0U; i < keys.size(); ++i)
+    {
+      filter.add(keys[i]);
+    }
+  }
+
+  state.set_items_per_iteration(keys.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(blocked_bloom_filter_add_bloom_filter)
+{
+  classic_filter& filter = filled_classic_filter();
+  const std::vector<uint32_t>& keys = lookup_keys();
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0U; i < keys.size(); ++i)
+    {
+      filter.add(keys[i]);
+    }
+  }
+
+  state.set_items_per_iteration(keys.size());
+}
@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+
+#include "benchmark.hpp"
+
+#include "typhoon/btree_map.hpp"
+#include "typhoon/map.hpp"
+
+//
+// Each btree_map benchmark has a 'map_' twin that does the same with the
+// node per element tpn::map.
+//
+namespace
+{
+  const size_t SIZE = 32768U;
+
+  typedef tpn::btree_map<uint32_t, uint32_t, SIZE> btree_map_type;
+  typedef tpn::map<uint32_t, uint32_t, SIZE>       map_type;
+
+  //***************************************************************************
+  /// Keys in a scrambled order, all even so that odd keys miss.
+  //***************************************************************************
+  uint32_t make_key(uint32_t i)
+  {
+    return (i * 2654435761U) & ~1U;
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void fill(TMap& data)
+  {
+    data.clear();
+
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      data.insert(typename TMap::value_type(make_key(i), i));
+    }
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void find(bench::state& state, TMap& data)
+  {
+    fill(data);
+
+    for (auto _ : state)
+    {
+      uint32_t sum = 0U;
+
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        sum += data.find(make_key(i))->second;
+      }
+
+      bench::do_not_optimize(sum);
+    }
+
+    state.set_items_per_iteration(SIZE);
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void lower_bound(bench::state& state, TMap& data)
+  {
+    fill(data);
+
+    for (auto _ : state)
+    {
+      uint32_t sum = 0U;
+
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        typename TMap::const_iterator itr = data.lower_bound(make_key(i) | 1U);
+        sum += (itr == data.end()) ? 0U : itr->second;
+      }
+
+      bench::do_not_optimize(sum);
+    }
+
+    state.set_items_per_iteration(SIZE);
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void iterate(bench::state& state, TMap& data)
+  {
+    fill(data);
+
+    for (auto _ : state)
+    {
+      uint32_t sum = 0U;
+
+      for (typename TMap::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        sum += itr->second;
+      }
+
+      bench::do_not_optimize(sum);
+    }
+
+    state.set_items_per_iteration(SIZE);
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void insert(bench::state& state, TMap& data)
+  {
+    for (auto _ : state)
+    {
+      fill(data);
+      bench::do_not_optimize(data);
+    }
+
+    state.set_items_per_iteration(SIZE);
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void erase_insert(bench::state& state, TMap& data)
+  {
+    fill(data);
+
+    uint32_t next = SIZE;
+
+    for (auto _ : state)
+    {
+      // Replace the oldest key with a new one.
+      data.erase(make_key(next - SIZE));
+      data.insert(typename TMap::value_type(make_key(next), next));
+      ++next;
+    }
+
+    state.set_items_per_iteration(1U);
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(btree_map_find_32768)
+{
+  static btree_map_type data;
+  find(state, data);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(map_find_32768)
+{
+  static map_type data;
+  find(state, data);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(btree_map_lower_bound_32768)
+{
+  static btree_map_type data;
+  lower_bound(state, data);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(map_lower_bound_32768)
+{
+  static map_type data;
+  lower_bound(state, data);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(btree_map_iterate_32768)
+{
+  static btree_map_type data;
+  iterate(state, data);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(map_iterate_32768)
+{
+  static map_type data;
+  iterate(state, data);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(btree_map_insert_32768)
+{
+  static btree_map_type data;
+  insert(state, data);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(map_insert_32768)
+{
+  static map_type data;
+  insert(state, data);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(btree_map_erase_insert_32768)
+{
+  static btree_map_type data;
+  erase_insert(state, data);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(map_erase_insert_32768)
+{
+  static map_type data;
+  erase_insert(state, data);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(btree_map_build_sorted_32768)
+{
+  static btree_map_type source;
+  static btree_map_type data;
+
+  fill(source);
+
+  for (auto _ : state)
+  {
+    data.clear();
+    data.insert(tpn::sorted_unique_t(), source.begin(), source.end());
+    bench::do_not_optimize(data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
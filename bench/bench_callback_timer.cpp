@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/callback_timer.hpp"
+
+namespace
+{
+  const uint_least8_t N_TIMERS = 200U;
+
+  uint32_t callback_count = 0U;
+
+  void callback()
+  {
+    ++callback_count;
+  }
+
+  typedef tpn::callback_timer<N_TIMERS>                      timer_type;
+  typedef tpn::callback_timer<N_TIMERS, tpn::timer_wheel<> > wheel_timer_type;
+
+  //***************************************************************************
+  /// Registers N_TIMERS repeating timers with staggered periods.
+  //***************************************************************************
+  template <typename TTimer>
+  void setup(TTimer& timers, tpn::timer::id::type* ids)
+  {
+    timers.clear();
+
+    for (uint_least8_t i = 0U; i < N_TIMERS; ++i)
+    {
+      ids[i] = timers.register_timer(callback, 10U + ((i * 37U) % 1000U), tpn::timer::mode::REPEATING);
+    }
+
+    timers.enable(true);
+  }
+
+  //***************************************************************************
+  /// Cost of starting all timers while others are already active.
+  //***************************************************************************
+  template <typename TTimer>
+  void start_all(bench::state& state)
+  {
+    static TTimer timers;
+    tpn::timer::id::type ids[N_TIMERS];
+    setup(timers, ids);
+
+    for (auto _ : state)
+    {
+      for (uint_least8_t i = 0U; i < N_TIMERS; ++i)
+      {
+        timers.start(ids[i]);
+      }
+    }
+
+    state.set_items_per_iteration(N_TIMERS);
+  }
+
+  //***************************************************************************
+  /// Cost of a single tick with 200 armed timers.
+  //***************************************************************************
+  template <typename TTimer>
+  void tick_all(bench::state& state)
+  {
+    static TTimer timers;
+    tpn::timer::id::type ids[N_TIMERS];
+    setup(timers, ids);
+
+    for (uint_least8_t i = 0U; i < N_TIMERS; ++i)
+    {
+      timers.start(ids[i]);
+    }
+
+    for (auto _ : state)
+    {
+      timers.tick(1U);
+    }
+
+    bench::do_not_optimize(callback_count);
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(callback_timer_start_200)
+{
+  start_all<timer_type>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(callback_timer_tick_200)
+{
+  tick_all<timer_type>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(callback_timer_wheel_start_200)
+{
+  start_all<wheel_timer_type>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(callback_timer_wheel_tick_200)
+{
+  tick_all<wheel_timer_type>(state);
+}
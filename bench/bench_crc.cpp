@@ -0,0 +1,66 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/crc32.hpp"
+#include "typhoon/crc32_c.hpp"
+#include "typhoon/crc16_ccitt.hpp"
+
+namespace
+{
+  const size_t SIZE = 4096U;
+
+  //***************************************************************************
+  const uint8_t* buffer()
+  {
+    static uint8_t data[SIZE];
+    static bool    initialised = false;
+
+    if (!initialised)
+    {
+      uint32_t value = 0x12345678U;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        value   = (value * 1664525U) + 1013904223U;
+        data[i] = uint8_t(value >> 24);
+      }
+
+      initialised = true;
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  template <typename TCrc>
+  void run_crc(bench::state& state)
+  {
+    const uint8_t* data = buffer();
+
+    for (auto _ : state)
+    {
+      typename TCrc::value_type value = TCrc(data, data + SIZE).value();
+      bench::do_not_optimize(value);
+    }
+
+    state.set_bytes_per_iteration(SIZE);
+  }
+}
+
+TYPHOON_BENCHMARK(crc32_t4_4k)      { run_crc<tpn::crc32_t4>(state); }
+TYPHOON_BENCHMARK(crc32_t16_4k)     { run_crc<tpn::crc32_t16>(state); }
+TYPHOON_BENCHMARK(crc32_t256_4k)    { run_crc<tpn::crc32_t256>(state); }
+TYPHOON_BENCHMARK(crc32_t2048_4k)   { run_crc<tpn::crc32_t2048>(state); }
+TYPHOON_BENCHMARK(crc32_t4096_4k)   { run_crc<tpn::crc32_t4096>(state); }
+TYPHOON_BENCHMARK(crc32_c_t256_4k)  { run_crc<tpn::crc32_c_t256>(state); }
+TYPHOON_BENCHMARK(crc32_c_t2048_4k) { run_crc<tpn::crc32_c_t2048>(state); }
+TYPHOON_BENCHMARK(crc16_ccitt_t256_4k)  { run_crc<tpn::crc16_ccitt_t256>(state); }
+TYPHOON_BENCHMARK(crc16_ccitt_t2048_4k) { run_crc<tpn::crc16_ccitt_t2048>(state); }
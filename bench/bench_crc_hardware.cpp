@@ -0,0 +1,58 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/crc32_c.hpp"
+
+#if TYPHOON_CRC32_C_HARDWARE
+
+namespace
+{
+  const size_t SIZE = 4096U;
+
+  //***************************************************************************
+  bool hardware_available()
+  {
+#if defined(TYPHOON_CRC32_C_HARDWARE_X86) && (defined(__GNUC__) || defined(__clang__))
+    return __builtin_cpu_supports("sse4.2");
+#else
+    return true;
+#endif
+  }
+}
+
+//*****************************************************************************
+/// CRC32-C of a 4k block using the hardware policy.
+/// Does nothing if the CPU running the benchmark lacks the instruction.
+//*****************************************************************************
+TYPHOON_BENCHMARK(crc32_c_hardware_4k)
+{
+  static uint8_t data[SIZE];
+
+  for (size_t i = 0U; i < SIZE; ++i)
+  {
+    data[i] = uint8_t((i * 131U) ^ (i >> 3U));
+  }
+
+  if (!hardware_available())
+  {
+    return;
+  }
+
+  for (auto _ : state)
+  {
+    uint32_t value = tpn::crc32_c_hardware(data, data + SIZE).value();
+    bench::do_not_optimize(value);
+  }
+
+  state.set_bytes_per_iteration(SIZE);
+}
+
+#endif
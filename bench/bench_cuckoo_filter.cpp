@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+
+#include "benchmark.hpp"
+
+#include "typhoon/cuckoo_filter.hpp"
+#include "typhoon/blocked_bloom_filter.hpp"
+#include "typhoon/span.hpp"
+
+#include <stdint.h>
+#include <vector>
+
+//
+// A set of 65536 open connections, tracked by id. As connections close and
+// open, the cuckoo filter erases and inserts one key each. The
+// '_bloom_rebuild' twin is what a Bloom filter has to do instead: rebuild
+// from the live set after a close.
+//
+namespace
+{
+  const size_t Connections = 65536U;
+  const size_t Lookup      = 4096U;
+
+  typedef tpn::cuckoo_filter<uint32_t, Connections, 16U>         filter_type;
+  typedef tpn::blocked_bloom_filter<uint32_t, Connections, 8192U> bloom_type;
+
+  //***************************************************************************
+  /// Connection ids are a counter, so each new one is unseen.
+  //***************************************************************************
+  struct connections
+  {
+    connections()
+      : next_id(0U)
+      , oldest(0U)
+    {
+      for (size_t i = 0U; i < Connections; ++i)
+      {
+        open();
+      }
+    }
+
+    void open()
+    {
+      live.push_back(next_id);
+      filter.insert(next_id);
+      ++next_id;
+    }
+
+    void close()
+    {
+      filter.erase(live[oldest]);
+      live[oldest] = live.back();
+      live.pop_back();
+      oldest = (oldest + 1U) % live.size();
+    }
+
+    filter_type           filter;
+    std::vector<uint32_t> live;
+    uint32_t              next_id;
+    size_t                oldest;
+  };
+
+  connections& open_connections()
+  {
+    static connections* p_connections = new connections;
+
+    return *p_connections;
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(cuckoo_filter_contains)
+{
+  connections& c = open_connections();
+
+  std::vector<uint32_t> keys;
+
+  for (size_t i = 0U; i < Lookup; ++i)
+  {
+    // Half live, half never seen.
+    keys.push_back((i & 1U) ? c.live[(i * 40503U) % c.live.size()] : (0x80000000U + uint32_t(i)));
+  }
+
+  // Measured on a million keys that were never inserted.
+  size_t false_positives = 0U;
+
+  for (uint32_t i = 0U; i < 1000000U; ++i)
+  {
+    false_positives += c.filter.contains(0xC0000000U + i) ? 1U : 0U;
+  }
+
+  for (auto _ : state)
+  {
+    size_t found = 0U;
+
+    for (size_t i = 0U; i < keys.size(); ++i)
+    {
+      found += c.filter.contains(keys[i]) ? 1U : 0U;
+    }
+
+    bench::do_not_optimize(found);
+  }
+
+  state.set_items_per_iteration(keys.size());
+  state.set_counter("false_positive_rate", double(false_positives) / 1000000.0);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(cuckoo_filter_churn)
+{
+  connections& c = open_connections();
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0U; i < Lookup; ++i)
+    {
+      c.close();
+      c.open();
+    }
+  }
+
+  state.set_items_per_iteration(Lookup);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(cuckoo_filter_churn_bloom_rebuild)
+{
+  connections& c = open_connections();
+  static bloom_type bloom;
+
+  for (auto _ : state)
+  {
+    c.close();
+    c.open();
+
+    bloom.clear();
+    bloom.add_batch(tpn::span<const uint32_t>(c.live.data(), c.live.size()));
+  }
+
+  state.set_items_per_iteration(1U);
+}
@@ -0,0 +1,226 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/flat_hash_map.hpp"
+#include "typhoon/unordered_map.hpp"
+
+namespace
+{
+  const size_t SIZE       = 1024U;
+  const size_t LARGE_SIZE = 32768U;
+
+  typedef tpn::flat_hash_map<uint32_t, uint32_t, SIZE>       map_type;
+  typedef tpn::flat_hash_map<uint32_t, uint32_t, LARGE_SIZE> large_map_type;
+  typedef tpn::unordered_map<uint32_t, uint32_t, LARGE_SIZE> large_unordered_map_type;
+
+  //***************************************************************************
+  /// The same keys as the unordered_map benchmarks.
+  //***************************************************************************
+  uint32_t make_key(uint32_t i)
+  {
+    return i * 2654435761U;
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void fill(TMap& data, size_t n)
+  {
+    data.clear();
+
+    for (uint32_t i = 0U; i < n; ++i)
+    {
+      data.insert(typename TMap::value_type(make_key(i), i));
+    }
+  }
+
+  //***************************************************************************
+  /// Looks the keys up in a shuffled order, so that consecutive lookups
+  /// neither share cache lines nor follow a stride the prefetcher can see.
+  //***************************************************************************
+  template <typename TMap>
+  void find_shuffled(bench::state& state, TMap& data, size_t n)
+  {
+    static uint32_t order[LARGE_SIZE];
+
+    fill(data, n);
+
+    for (uint32_t i = 0U; i < n; ++i)
+    {
+      order[i] = i;
+    }
+
+    uint32_t x = 2463534242U;
+
+    for (uint32_t i = uint32_t(n - 1U); i > 0U; --i)
+    {
+      x ^= x << 13U;
+      x ^= x >> 17U;
+      x ^= x << 5U;
+
+      const uint32_t j = x % (i + 1U);
+      const uint32_t t = order[i];
+      order[i] = order[j];
+      order[j] = t;
+    }
+
+    for (auto _ : state)
+    {
+      uint32_t sum = 0U;
+
+      for (uint32_t i = 0U; i < n; ++i)
+      {
+        sum += data.find(make_key(order[i]))->second;
+      }
+
+      bench::do_not_optimize(sum);
+    }
+
+    state.set_items_per_iteration(n);
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_hash_map_insert_1024)
+{
+  static map_type data;
+
+  for (auto _ : state)
+  {
+    fill(data, SIZE);
+    bench::do_not_optimize(data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_hash_map_find_hit_1024)
+{
+  static map_type data;
+  fill(data, SIZE);
+
+  for (auto _ : state)
+  {
+    uint32_t sum = 0U;
+
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      sum += data.find(make_key(i))->second;
+    }
+
+    bench::do_not_optimize(sum);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_hash_map_find_miss_1024)
+{
+  static map_type data;
+  fill(data, SIZE);
+
+  for (auto _ : state)
+  {
+    size_t misses = 0U;
+
+    for (uint32_t i = SIZE; i < (2U * SIZE); ++i)
+    {
+      misses += (data.find(make_key(i)) == data.end()) ? 1U : 0U;
+    }
+
+    bench::do_not_optimize(misses);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_hash_map_iterate_1024)
+{
+  static map_type data;
+  fill(data, SIZE);
+
+  for (auto _ : state)
+  {
+    uint32_t sum = 0U;
+
+    for (map_type::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+    {
+      sum += itr->second;
+    }
+
+    bench::do_not_optimize(sum);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_hash_map_erase_insert_1024)
+{
+  static map_type data;
+  fill(data, SIZE);
+
+  uint32_t next = SIZE;
+
+  for (auto _ : state)
+  {
+    // Replace the oldest key with a new one, as a session table does.
+    data.erase(make_key(next - SIZE));
+    data.insert(map_type::value_type(make_key(next), next));
+    ++next;
+  }
+
+  state.set_items_per_iteration(1U);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(unordered_map_find_shuffled_32768)
+{
+  static large_unordered_map_type data;
+  find_shuffled(state, data, LARGE_SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_hash_map_find_shuffled_32768)
+{
+  static large_map_type data;
+  find_shuffled(state, data, LARGE_SIZE);
+}
+
+//*****************************************************************************
+/// Fills a map through operator[] with more keys than it holds.
+/// 'overfill' is the number of keys held beyond max_size, which must be 0.
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_hash_map_subscript_fill_14)
+{
+  typedef tpn::flat_hash_map<uint32_t, uint32_t, 14U> small_map_type;
+
+  const uint32_t Keys = 40U;
+
+  small_map_type data;
+
+  for (auto _ : state)
+  {
+    data.clear();
+
+    for (uint32_t i = 0U; i < Keys; ++i)
+    {
+      data[make_key(i)] = i;
+    }
+
+    bench::do_not_optimize(data);
+  }
+
+  state.set_counter("overfill", double(data.size()) - double(data.max_size()));
+  state.set_items_per_iteration(Keys);
+}
@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/flat_map.hpp"
+#include "typhoon/flat_set.hpp"
+#include "typhoon/utility.hpp"
+
+//
+// Builds a container from a range of keys in random order, as a table loaded
+// from a configuration block would be. The '_single' twins insert the same
+// keys one at a time, which is what the range insert used to do.
+//
+namespace
+{
+  const size_t SIZE = 4096U;
+
+  typedef tpn::flat_map<uint32_t, uint32_t, SIZE> map_type;
+  typedef tpn::flat_set<uint32_t, SIZE>           set_type;
+  typedef map_type::value_type                    entry_type;
+
+  //***************************************************************************
+  const entry_type* random_entries()
+  {
+    static entry_type entries[SIZE];
+    static bool filled = false;
+
+    if (!filled)
+    {
+      uint32_t x = 2463534242U;
+
+      for (uint32_t i = 0U; i < SIZE; ++i)
+      {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        new (&entries[i]) entry_type(x, i);
+      }
+
+      filled = true;
+    }
+
+    return entries;
+  }
+
+  //***************************************************************************
+  const entry_type* sorted_entries()
+  {
+    static entry_type entries[SIZE];
+
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      new (&entries[i]) entry_type(i * 16U, i);
+    }
+
+    return entries;
+  }
+
+  //***************************************************************************
+  const uint32_t* random_keys()
+  {
+    static uint32_t keys[SIZE];
+    const entry_type* entries = random_entries();
+
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      keys[i] = entries[i].first;
+    }
+
+    return keys;
+  }
+
+  map_type map_data;
+  set_type set_data;
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_map_insert_range)
+{
+  const entry_type* entries = random_entries();
+
+  for (auto _ : state)
+  {
+    map_data.clear();
+    map_data.insert(entries, entries + SIZE);
+    bench::do_not_optimize(map_data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_map_insert_range_single)
+{
+  const entry_type* entries = random_entries();
+
+  for (auto _ : state)
+  {
+    map_data.clear();
+
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      map_data.insert(entries[i]);
+    }
+
+    bench::do_not_optimize(map_data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_map_insert_sorted_unique)
+{
+  const entry_type* entries = sorted_entries();
+
+  for (auto _ : state)
+  {
+    map_data.clear();
+    map_data.insert(tpn::sorted_unique, entries, entries + SIZE);
+    bench::do_not_optimize(map_data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_set_insert_range)
+{
+  const uint32_t* keys = random_keys();
+
+  for (auto _ : state)
+  {
+    set_data.clear();
+    set_data.insert(keys, keys + SIZE);
+    bench::do_not_optimize(set_data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(flat_set_insert_range_single)
+{
+  const uint32_t* keys = random_keys();
+
+  for (auto _ : state)
+  {
+    set_data.clear();
+
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      set_data.insert(keys[i]);
+    }
+
+    bench::do_not_optimize(set_data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
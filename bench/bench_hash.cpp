@@ -0,0 +1,387 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+
+#include "benchmark.hpp"
+
+#include "typhoon/hash.hpp"
+#include "typhoon/fnv_1.hpp"
+#include "typhoon/wyhash.hpp"
+#include "typhoon/murmur3.hpp"
+#include "typhoon/string_view.hpp"
+
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+
+//
+// The '_fnv_1a' twins hash the same keys byte at a time, as generic_hash did
+// before it used wyhash.
+//
+namespace
+{
+  //***************************************************************************
+  /// A key of the given length, made of printable text.
+  //***************************************************************************
+  const char* key_text()
+  {
+    static char text[4096];
+
+    if (text[0] == 0)
+    {
+      for (size_t i = 0U; i < sizeof(text); ++i)
+      {
+        text[i] = char('a' + ((i * 7U) % 26U));
+      }
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  template <size_t VLength>
+  void run_generic(bench::state& state)
+  {
+    const tpn::string_view key(key_text(), VLength);
+    const tpn::hash<tpn::string_view> hasher;
+
+    for (auto _ : state)
+    {
+      bench::do_not_optimize(key);
+      size_t h = hasher(key);
+      bench::do_not_optimize(h);
+    }
+
+    state.set_bytes_per_iteration(VLength);
+  }
+
+  //***************************************************************************
+  template <size_t VLength>
+  void run_fnv_1a(bench::state& state)
+  {
+    const uint8_t* key = reinterpret_cast<const uint8_t*>(key_text());
+
+    for (auto _ : state)
+    {
+      bench::do_not_optimize(key);
+      uint64_t h = tpn::fnv_1a_64(key, key + VLength);
+      bench::do_not_optimize(h);
+    }
+
+    state.set_bytes_per_iteration(VLength);
+  }
+
+  //***************************************************************************
+  /// Hashes 65536 similar keys and reports how well the hashes spread.
+  /// 'collisions' is the number of repeated 32 bit hashes (about 0.5 are
+  /// expected from a random hash), and 'chi_squared' the fit of the low 12
+  /// bits to 4096 equally likely buckets (about 4095 is expected).
+  //***************************************************************************
+  template <typename THash>
+  void run_quality(bench::state& state, THash hash32)
+  {
+    const size_t Keys    = 65536U;
+    const size_t Buckets = 4096U;
+
+    std::vector<char>     text(Keys * 32U);
+    std::vector<size_t>   lengths(Keys);
+    std::vector<uint32_t> hashes(Keys);
+
+    for (size_t i = 0U; i < Keys; ++i)
+    {
+      lengths[i] = size_t(snprintf(&text[i * 32U], 32U, "sensor/%u/value", unsigned(i)));
+    }
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < Keys; ++i)
+      {
+        const uint8_t* key = reinterpret_cast<const uint8_t*>(&text[i * 32U]);
+        hashes[i] = hash32(key, key + lengths[i]);
+      }
+
+      bench::clobber_memory();
+    }
+
+    std::vector<size_t> counts(Buckets);
+
+    for (size_t i = 0U; i < Keys; ++i)
+    {
+      ++counts[hashes[i] % Buckets];
+    }
+
+    const double expected    = double(Keys) / double(Buckets);
+    double       chi_squared = 0.0;
+
+    for (size_t i = 0U; i < Buckets; ++i)
+    {
+      const double difference = double(counts[i]) - expected;
+      chi_squared += (difference * difference) / expected;
+    }
+
+    std::sort(hashes.begin(), hashes.end());
+
+    const size_t collisions = Keys - size_t(std::unique(hashes.begin(), hashes.end()) - hashes.begin());
+
+    state.set_counter("collisions", double(collisions));
+    state.set_counter("chi_squared", chi_squared);
+    state.set_items_per_iteration(Keys);
+  }
+
+  //***************************************************************************
+  template <typename THash, size_t VLength>
+  void run_murmur3(bench::state& state)
+  {
+    const uint8_t* key = reinterpret_cast<const uint8_t*>(key_text());
+
+    for (auto _ : state)
+    {
+      bench::do_not_optimize(key);
+      typename THash::value_type h = THash(key, key + VLength).value();
+      bench::do_not_optimize(h);
+    }
+
+    state.set_bytes_per_iteration(VLength);
+  }
+
+  //***************************************************************************
+  /// The 32 bit murmur3, fed a byte at a time as the range constructor did
+  /// before it read whole blocks.
+  //***************************************************************************
+  template <size_t VLength>
+  void run_murmur3_bytes(bench::state& state)
+  {
+    const uint8_t* key = reinterpret_cast<const uint8_t*>(key_text());
+
+    for (auto _ : state)
+    {
+      bench::do_not_optimize(key);
+      tpn::murmur3<uint32_t> hash;
+
+      for (size_t i = 0U; i < VLength; ++i)
+      {
+        hash.add(key[i]);
+      }
+
+      uint32_t h = hash.value();
+      bench::do_not_optimize(h);
+    }
+
+    state.set_bytes_per_iteration(VLength);
+  }
+
+  //***************************************************************************
+  /// Writes a hash value as the reference MurmurHash3 output bytes.
+  //***************************************************************************
+  void store_hash(uint8_t* p, uint32_t value)
+  {
+    for (size_t i = 0U; i < 4U; ++i)
+    {
+      p[i] = uint8_t(value >> (i * 8U));
+    }
+  }
+
+  void store_hash(uint8_t* p, const tpn::murmur3_128_value& value)
+  {
+    for (size_t i = 0U; i < 8U; ++i)
+    {
+      p[i]      = uint8_t(value.low >> (i * 8U));
+      p[i + 8U] = uint8_t(value.high >> (i * 8U));
+    }
+  }
+
+  //***************************************************************************
+  /// Checks a murmur3 variant against its SMHasher verification value, and
+  /// that a key streamed in two calls, split anywhere and at any alignment,
+  /// hashes the same as one call.
+  /// 'verified' is 1 when the verification value matches, and
+  /// 'split_mismatches' the number of split keys that hashed differently.
+  //***************************************************************************
+  template <typename THash>
+  void run_murmur3_check(bench::state& state, uint32_t verification)
+  {
+    const size_t Hash_Size = sizeof(typename THash::value_type);
+
+    uint8_t key[256];
+    uint8_t hashes[256U * Hash_Size];
+    size_t  split_mismatches = 0U;
+    bool    verified         = false;
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        key[i] = uint8_t(i);
+        store_hash(&hashes[i * Hash_Size], THash(key, key + i, uint32_t(256U - i)).value());
+      }
+
+      uint8_t result[Hash_Size];
+      store_hash(result, THash(hashes, hashes + sizeof(hashes)).value());
+
+      const uint32_t value = uint32_t(result[0]) | (uint32_t(result[1]) << 8U) | (uint32_t(result[2]) << 16U) | (uint32_t(result[3]) << 24U);
+      verified = (value == verification);
+
+      split_mismatches = 0U;
+
+      const uint8_t* text = reinterpret_cast<const uint8_t*>(key_text());
+
+      for (size_t offset = 0U; offset < 8U; ++offset)
+      {
+        for (size_t length = 0U; length <= 40U; ++length)
+        {
+          const uint8_t* begin = text + offset;
+          const uint8_t* end   = begin + length;
+
+          const typename THash::value_type whole = THash(begin, end).value();
+
+          for (size_t split = 0U; split <= length; ++split)
+          {
+            THash hash;
+            hash.add(begin, begin + split);
+            hash.add(begin + split, end);
+
+            if (!(hash.value() == whole))
+            {
+              ++split_mismatches;
+            }
+          }
+        }
+      }
+
+      bench::clobber_memory();
+    }
+
+    state.set_counter("verified", verified ? 1.0 : 0.0);
+    state.set_counter("split_mismatches", double(split_mismatches));
+  }
+
+  uint32_t hash_wyhash_32(const uint8_t* begin, const uint8_t* end)
+  {
+    return tpn::wyhash_32(begin, end);
+  }
+
+  uint32_t hash_fnv_1a_32(const uint8_t* begin, const uint8_t* end)
+  {
+    return tpn::fnv_1a_32(begin, end);
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_string_16)
+{
+  run_generic<16U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_string_16_fnv_1a)
+{
+  run_fnv_1a<16U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_string_40)
+{
+  run_generic<40U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_string_40_fnv_1a)
+{
+  run_fnv_1a<40U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_string_200)
+{
+  run_generic<200U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_string_200_fnv_1a)
+{
+  run_fnv_1a<200U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_string_4096)
+{
+  run_generic<4096U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_string_4096_fnv_1a)
+{
+  run_fnv_1a<4096U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_quality_65536_keys)
+{
+  run_quality(state, hash_wyhash_32);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_quality_65536_keys_fnv_1a)
+{
+  run_quality(state, hash_fnv_1a_32);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_murmur3_32_200)
+{
+  run_murmur3<tpn::murmur3<uint32_t>, 200U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_murmur3_32_200_bytes)
+{
+  run_murmur3_bytes<200U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_murmur3_32_4096)
+{
+  run_murmur3<tpn::murmur3<uint32_t>, 4096U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_murmur3_32_4096_bytes)
+{
+  run_murmur3_bytes<4096U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_murmur3_x86_128_4096)
+{
+  run_murmur3<tpn::murmur3_x86_128, 4096U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_murmur3_x64_128_4096)
+{
+  run_murmur3<tpn::murmur3_x64_128, 4096U>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_murmur3_32_check)
+{
+  run_murmur3_check<tpn::murmur3<uint32_t> >(state, 0xB0F57EE3UL);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_murmur3_x86_128_check)
+{
+  run_murmur3_check<tpn::murmur3_x86_128>(state, 0xB3ECE62AUL);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(hash_murmur3_x64_128_check)
+{
+  run_murmur3_check<tpn::murmur3_x64_128>(state, 0x6384BA69UL);
+}
@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/fixed_sized_memory_block_allocator.hpp"
+#include "typhoon/slab_memory_block_allocator.hpp"
+#include "typhoon/monotonic_buffer_allocator.hpp"
+
+//
+// Message sized requests spread over four size classes, served either by a
+// chain of fixed_sized_memory_block_allocator or by one slab allocator with
+// the same classes.
+//
+namespace
+{
+  const size_t SIZE     = 64U;
+  const size_t REQUESTS = 1024U;
+  const size_t HELD     = 16U;
+
+  typedef tpn::fixed_sized_memory_block_allocator<32U,  8U, SIZE> fixed_32_type;
+  typedef tpn::fixed_sized_memory_block_allocator<64U,  8U, SIZE> fixed_64_type;
+  typedef tpn::fixed_sized_memory_block_allocator<128U, 8U, SIZE> fixed_128_type;
+  typedef tpn::fixed_sized_memory_block_allocator<256U, 8U, SIZE> fixed_256_type;
+
+  typedef tpn::slab_memory_block_allocator<8U,
+                                           tpn::slab_size_class<32U,  SIZE>,
+                                           tpn::slab_size_class<64U,  SIZE>,
+                                           tpn::slab_size_class<128U, SIZE>,
+                                           tpn::slab_size_class<256U, SIZE> > slab_type;
+
+  //***************************************************************************
+  /// Request sizes, weighted towards the larger classes, which are the ones
+  /// at the end of a chain.
+  //***************************************************************************
+  const size_t* request_sizes()
+  {
+    static size_t sizes[REQUESTS];
+    static const size_t choices[8] = { 24U, 48U, 100U, 120U, 200U, 240U, 250U, 256U };
+
+    uint32_t x = 2463534242U;
+
+    for (size_t i = 0U; i < REQUESTS; ++i)
+    {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      sizes[i] = choices[x & 7U];
+    }
+
+    return sizes;
+  }
+
+  //***************************************************************************
+  /// Allocates HELD blocks at a time, then releases them newest first.
+  //***************************************************************************
+  void run(bench::state& state, tpn::imemory_block_allocator& allocator)
+  {
+    const size_t* sizes = request_sizes();
+    void* held[HELD];
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < REQUESTS; i += HELD)
+      {
+        for (size_t h = 0U; h < HELD; ++h)
+        {
+          held[h] = allocator.allocate(sizes[i + h], 8U);
+        }
+
+        bench::do_not_optimize(held);
+
+        for (size_t h = HELD; h != 0U; --h)
+        {
+          allocator.release(held[h - 1U]);
+        }
+      }
+    }
+
+    state.set_items_per_iteration(REQUESTS);
+  }
+
+  //***************************************************************************
+  /// Allocates all of the requests as the temporaries of one frame, then
+  /// frees them together, one by one or by rewinding an arena.
+  //***************************************************************************
+  void run_frame(bench::state& state, tpn::imemory_block_allocator& allocator)
+  {
+    const size_t* sizes = request_sizes();
+    static void* held[REQUESTS];
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < REQUESTS; ++i)
+      {
+        held[i] = allocator.allocate(sizes[i], 8U);
+      }
+
+      bench::do_not_optimize(held);
+
+      for (size_t i = 0U; i < REQUESTS; ++i)
+      {
+        allocator.release(held[i]);
+      }
+    }
+
+    state.set_items_per_iteration(REQUESTS);
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(memory_block_allocator_chain)
+{
+  static fixed_32_type  fixed_32;
+  static fixed_64_type  fixed_64;
+  static fixed_128_type fixed_128;
+  static fixed_256_type fixed_256;
+
+  fixed_32.set_successor(fixed_64, fixed_128, fixed_256);
+
+  run(state, fixed_32);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(memory_block_allocator_slab)
+{
+  static slab_type slab;
+
+  run(state, slab);
+}
+
+//*****************************************************************************
+/// A frame's worth of requests from a slab allocator large enough to hold
+/// them, and from an arena rewound at the end of each frame.
+//*****************************************************************************
+TYPHOON_BENCHMARK(memory_block_allocator_frame_slab)
+{
+  static tpn::slab_memory_block_allocator<8U,
+                                          tpn::slab_size_class<32U,  REQUESTS>,
+                                          tpn::slab_size_class<64U,  REQUESTS>,
+                                          tpn::slab_size_class<128U, REQUESTS>,
+                                          tpn::slab_size_class<256U, REQUESTS> > slab;
+
+  run_frame(state, slab);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(memory_block_allocator_frame_monotonic)
+{
+  static char buffer[REQUESTS * 256U];
+  static tpn::monotonic_buffer_allocator arena(buffer, sizeof(buffer));
+
+  const size_t* sizes = request_sizes();
+  static void* held[REQUESTS];
+
+  for (auto _ : state)
+  {
+    tpn::monotonic_buffer_allocator::scope frame(arena);
+
+    for (size_t i = 0U; i < REQUESTS; ++i)
+    {
+      held[i] = arena.allocate(sizes[i], 8U);
+    }
+
+    bench::do_not_optimize(held);
+  }
+
+  state.set_items_per_iteration(REQUESTS);
+}
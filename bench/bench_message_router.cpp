@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/message_router.hpp"
+
+namespace
+{
+  template <tpn::message_id_t ID>
+  struct message : public tpn::message<ID>
+  {
+  };
+
+  //***************************************************************************
+  /// A router handling 32 message types.
+  //***************************************************************************
+  class router : public tpn::message_router<router,
+                                            message<0>,  message<1>,  message<2>,  message<3>,
+                                            message<4>,  message<5>,  message<6>,  message<7>,
+                                            message<8>,  message<9>,  message<10>, message<11>,
+                                            message<12>, message<13>, message<14>, message<15>,
+                                            message<16>, message<17>, message<18>, message<19>,
+                                            message<20>, message<21>, message<22>, message<23>,
+                                            message<24>, message<25>, message<26>, message<27>,
+                                            message<28>, message<29>, message<30>, message<31> >
+  {
+  public:
+
+    router()
+      : count(0U)
+    {
+    }
+
+    template <typename TMessage>
+    void on_receive(const TMessage&)
+    {
+      count += TMessage::ID;
+    }
+
+    void on_receive_unknown(const tpn::imessage&)
+    {
+    }
+
+    uint32_t count;
+  };
+
+  const message<0>  first;
+  const message<15> middle;
+  const message<31> last;
+
+  //***************************************************************************
+  /// A drained queue of 64 messages, in runs of 8 with the same id.
+  //***************************************************************************
+  const size_t Batch_Size = 64U;
+
+  const message<3>  run_a;
+  const message<17> run_b;
+  const message<29> run_c;
+
+  struct batch
+  {
+    batch()
+    {
+      const tpn::imessage* const runs[] = { &run_a, &run_b, &middle, &run_c, &first, &run_b, &last, &run_a };
+
+      for (size_t i = 0U; i < Batch_Size; ++i)
+      {
+        messages[i] = runs[i / 8U];
+      }
+    }
+
+    const tpn::imessage* messages[Batch_Size];
+  };
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(message_router_receive_first_of_32)
+{
+  router r;
+  tpn::imessage_router* p_router = &r;
+  bench::do_not_optimize(p_router);
+
+  for (auto _ : state)
+  {
+    p_router->receive(first);
+    bench::clobber_memory();
+  }
+
+  bench::do_not_optimize(r.count);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(message_router_receive_middle_of_32)
+{
+  router r;
+  tpn::imessage_router* p_router = &r;
+  bench::do_not_optimize(p_router);
+
+  for (auto _ : state)
+  {
+    p_router->receive(middle);
+    bench::clobber_memory();
+  }
+
+  bench::do_not_optimize(r.count);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(message_router_receive_last_of_32)
+{
+  router r;
+  tpn::imessage_router* p_router = &r;
+  bench::do_not_optimize(p_router);
+
+  for (auto _ : state)
+  {
+    p_router->receive(last);
+    bench::clobber_memory();
+  }
+
+  bench::do_not_optimize(r.count);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(message_router_accepts_of_32)
+{
+  router r;
+  const tpn::imessage_router* p_router = &r;
+  bench::do_not_optimize(p_router);
+
+  for (auto _ : state)
+  {
+    bool accepted = p_router->accepts(tpn::message_id_t(31)) && !p_router->accepts(tpn::message_id_t(200));
+    bench::do_not_optimize(accepted);
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(message_router_receive_64)
+{
+  router r;
+  tpn::imessage_router* p_router = &r;
+  bench::do_not_optimize(p_router);
+
+  const batch b;
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0U; i < Batch_Size; ++i)
+    {
+      p_router->receive(*b.messages[i]);
+    }
+
+    bench::clobber_memory();
+  }
+
+  bench::do_not_optimize(r.count);
+  state.set_items_per_iteration(Batch_Size);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(message_router_receive_batch_64)
+{
+  router r;
+  tpn::imessage_router* p_router = &r;
+  bench::do_not_optimize(p_router);
+
+  const batch b;
+
+  for (auto _ : state)
+  {
+    p_router->receive_batch(tpn::span<const tpn::imessage* const>(b.messages, Batch_Size));
+    bench::clobber_memory();
+  }
+
+  bench::do_not_optimize(r.count);
+  state.set_items_per_iteration(Batch_Size);
+}
@@ -0,0 +1,214 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/pool.hpp"
+#include "typhoon/pool_atomic.hpp"
+#include "typhoon/pool_magazine.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const size_t SIZE  = 256U;
+  const size_t ITEMS = 1000000U;
+  const size_t HELD  = 4U;
+
+  struct message
+  {
+    uint32_t id;
+    uint32_t payload[7];
+  };
+
+  //***************************************************************************
+  /// A tpn::pool behind a mutex, which is how a pool has to be shared
+  /// without pool_atomic.
+  //***************************************************************************
+  class locked_pool
+  {
+  public:
+
+    message* allocate()
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      return pool.full() ? TYPHOON_NULLPTR : pool.allocate();
+    }
+
+    void release(message* p)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pool.release(p);
+    }
+
+  private:
+
+    std::mutex                 mutex;
+    tpn::pool<message, SIZE>   pool;
+  };
+
+  //***************************************************************************
+  /// The lock free pool.
+  //***************************************************************************
+  class atomic_pool
+  {
+  public:
+
+    message* allocate()
+    {
+      return pool.try_allocate();
+    }
+
+    void release(message* p)
+    {
+      pool.release(p);
+    }
+
+  private:
+
+    tpn::pool_atomic<message, SIZE> pool;
+  };
+
+  typedef tpn::pool_atomic<message, SIZE> shared_pool_type;
+
+  //***************************************************************************
+  /// A magazine per thread in front of a shared lock free pool.
+  //***************************************************************************
+  class magazine_pool
+  {
+  public:
+
+    explicit magazine_pool(shared_pool_type& pool)
+      : magazine(pool)
+    {
+    }
+
+    message* allocate()
+    {
+      return magazine.try_allocate<message>();
+    }
+
+    void release(message* p)
+    {
+      magazine.release(p);
+    }
+
+  private:
+
+    tpn::pool_magazine<shared_pool_type, 16U> magazine;
+  };
+
+  //***************************************************************************
+  /// Each cycle allocates HELD messages and releases them again, as a
+  /// producer that fills a few messages for each pass of its loop would.
+  //***************************************************************************
+  template <typename TPool>
+  void cycle(TPool& pool, size_t n)
+  {
+    message* held[HELD];
+
+    for (size_t i = 0U; i < n; i += HELD)
+    {
+      for (size_t h = 0U; h < HELD; ++h)
+      {
+        held[h] = pool.allocate();
+        held[h]->id = uint32_t(i + h);
+      }
+
+      bench::do_not_optimize(held);
+
+      for (size_t h = 0U; h < HELD; ++h)
+      {
+        pool.release(held[h]);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Runs ITEMS allocate and release pairs split over 'threads' threads.
+  //***************************************************************************
+  template <typename TPool>
+  void run(bench::state& state, size_t threads)
+  {
+    static TPool pool;
+
+    for (auto _ : state)
+    {
+      if (threads == 1U)
+      {
+        cycle(pool, ITEMS);
+      }
+      else
+      {
+        std::vector<std::thread> workers;
+
+        for (size_t t = 0U; t < threads; ++t)
+        {
+          workers.push_back(std::thread([threads]() { cycle(pool, ITEMS / threads); }));
+        }
+
+        for (size_t t = 0U; t < workers.size(); ++t)
+        {
+          workers[t].join();
+        }
+      }
+    }
+
+    state.set_items_per_iteration(ITEMS);
+  }
+
+  //***************************************************************************
+  /// As run(), with each thread using its own magazine.
+  //***************************************************************************
+  void run_magazine(bench::state& state, size_t threads)
+  {
+    static shared_pool_type pool;
+
+    for (auto _ : state)
+    {
+      std::vector<std::thread> workers;
+
+      for (size_t t = 0U; t < threads; ++t)
+      {
+        workers.push_back(std::thread([threads]()
+        {
+          magazine_pool magazine(pool);
+          cycle(magazine, ITEMS / threads);
+        }));
+      }
+
+      for (size_t t = 0U; t < workers.size(); ++t)
+      {
+        workers[t].join();
+      }
+    }
+
+    state.set_items_per_iteration(ITEMS);
+  }
+}
+
+//*****************************************************************************
+/// A shared pool with 1, 2, 4 and 8 threads.
+//*****************************************************************************
+TYPHOON_BENCHMARK(pool_mutex_threads_1)  { run<locked_pool>(state, 1U); }
+TYPHOON_BENCHMARK(pool_mutex_threads_2)  { run<locked_pool>(state, 2U); }
+TYPHOON_BENCHMARK(pool_mutex_threads_4)  { run<locked_pool>(state, 4U); }
+TYPHOON_BENCHMARK(pool_mutex_threads_8)  { run<locked_pool>(state, 8U); }
+
+TYPHOON_BENCHMARK(pool_atomic_threads_1) { run<atomic_pool>(state, 1U); }
+TYPHOON_BENCHMARK(pool_atomic_threads_2) { run<atomic_pool>(state, 2U); }
+TYPHOON_BENCHMARK(pool_atomic_threads_4) { run<atomic_pool>(state, 4U); }
+TYPHOON_BENCHMARK(pool_atomic_threads_8) { run<atomic_pool>(state, 8U); }
+
+TYPHOON_BENCHMARK(pool_magazine_threads_1) { run_magazine(state, 1U); }
+TYPHOON_BENCHMARK(pool_magazine_threads_2) { run_magazine(state, 2U); }
+TYPHOON_BENCHMARK(pool_magazine_threads_4) { run_magazine(state, 4U); }
+TYPHOON_BENCHMARK(pool_magazine_threads_8) { run_magazine(state, 8U); }
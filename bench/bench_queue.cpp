@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/queue_spsc_atomic.hpp"
+#include "typhoon/queue_mpmc_atomic.hpp"
+#include "typhoon/queue_mpmc_mutex.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const size_t SIZE  = 256U;
+  const size_t ITEMS = 4096U;
+
+  typedef tpn::queue_spsc_atomic<uint32_t, SIZE> queue_type;
+
+  typedef tpn::queue_mpmc_mutex<uint32_t, SIZE>  mpmc_mutex_type;
+  typedef tpn::queue_mpmc_atomic<uint32_t, SIZE> mpmc_atomic_type;
+
+  const size_t BATCH = 16U;
+
+  //***************************************************************************
+  /// Pushes 'count' items, one at a time or in batches.
+  //***************************************************************************
+  template <typename TQueue>
+  void produce(TQueue& queue, size_t count)
+  {
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+      while (!queue.push(i))
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void produce_batch(mpmc_atomic_type& queue, size_t count)
+  {
+    uint32_t values[BATCH] = {};
+
+    while (count != 0U)
+    {
+      const size_t n = queue.push_n(values, (count < BATCH) ? count : BATCH);
+
+      if (n == 0U)
+      {
+        std::this_thread::yield();
+      }
+
+      count -= n;
+    }
+  }
+
+  //***************************************************************************
+  /// Pops 'count' items, one at a time or in batches.
+  //***************************************************************************
+  template <typename TQueue>
+  void consume(TQueue& queue, size_t count)
+  {
+    uint32_t value = 0U;
+
+    while (count != 0U)
+    {
+      if (queue.pop(value))
+      {
+        --count;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+
+    bench::do_not_optimize(value);
+  }
+
+  void consume_batch(mpmc_atomic_type& queue, size_t count)
+  {
+    uint32_t values[BATCH];
+
+    while (count != 0U)
+    {
+      const size_t n = queue.pop_n(values, (count < BATCH) ? count : BATCH);
+
+      if (n == 0U)
+      {
+        std::this_thread::yield();
+      }
+
+      count -= n;
+    }
+
+    bench::do_not_optimize(values);
+  }
+
+  //***************************************************************************
+  /// Runs ITEMS items through the queue with 'threads' threads.
+  /// One thread alternates push and pop; otherwise half the threads produce
+  /// and half consume.
+  //***************************************************************************
+  template <typename TQueue, typename TProduce, typename TConsume>
+  void run_mpmc(bench::state& state, TQueue& queue, size_t threads, TProduce produce_fn, TConsume consume_fn)
+  {
+    for (auto _ : state)
+    {
+      if (threads == 1U)
+      {
+        for (size_t i = 0U; i < ITEMS; i += SIZE)
+        {
+          produce_fn(queue, SIZE);
+          consume_fn(queue, SIZE);
+        }
+      }
+      else
+      {
+        const size_t pairs      = threads / 2U;
+        const size_t per_thread = ITEMS / pairs;
+
+        std::vector<std::thread> workers;
+
+        for (size_t t = 0U; t < pairs; ++t)
+        {
+          workers.push_back(std::thread([&queue, per_thread, consume_fn]() { consume_fn(queue, per_thread); }));
+          workers.push_back(std::thread([&queue, per_thread, produce_fn]() { produce_fn(queue, per_thread); }));
+        }
+
+        for (size_t t = 0U; t < workers.size(); ++t)
+        {
+          workers[t].join();
+        }
+      }
+    }
+
+    state.set_items_per_iteration(ITEMS);
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  void run_mpmc(bench::state& state, size_t threads)
+  {
+    static TQueue queue;
+
+    run_mpmc(state, queue, threads, produce<TQueue>, consume<TQueue>);
+  }
+
+  //***************************************************************************
+  void run_mpmc_batch(bench::state& state, size_t threads)
+  {
+    static mpmc_atomic_type queue;
+
+    run_mpmc(state, queue, threads, produce_batch, consume_batch);
+  }
+}
+
+//*****************************************************************************
+/// Push and pop on the same thread; measures the uncontended cost.
+//*****************************************************************************
+TYPHOON_BENCHMARK(queue_spsc_atomic_push_pop)
+{
+  static queue_type queue;
+
+  for (auto _ : state)
+  {
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      queue.push(i);
+    }
+
+    uint32_t value = 0U;
+
+    while (queue.pop(value))
+    {
+      bench::do_not_optimize(value);
+    }
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+/// One producer thread and one consumer thread.
+//*****************************************************************************
+TYPHOON_BENCHMARK(queue_spsc_atomic_producer_consumer)
+{
+  static queue_type queue;
+
+  for (auto _ : state)
+  {
+    std::thread consumer([]()
+    {
+      uint32_t value    = 0U;
+      size_t   received = 0U;
+
+      while (received < ITEMS)
+      {
+        if (queue.pop(value))
+        {
+          ++received;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      bench::do_not_optimize(value);
+    });
+
+    for (uint32_t i = 0U; i < ITEMS; ++i)
+    {
+      while (!queue.push(i))
+      {
+        std::this_thread::yield();
+      }
+    }
+
+    consumer.join();
+  }
+
+  state.set_items_per_iteration(ITEMS);
+}
+
+//*****************************************************************************
+/// MPMC queues with 1, 2, 4 and 8 threads.
+//*****************************************************************************
+TYPHOON_BENCHMARK(queue_mpmc_mutex_threads_1)  { run_mpmc<mpmc_mutex_type>(state, 1U); }
+TYPHOON_BENCHMARK(queue_mpmc_mutex_threads_2)  { run_mpmc<mpmc_mutex_type>(state, 2U); }
+TYPHOON_BENCHMARK(queue_mpmc_mutex_threads_4)  { run_mpmc<mpmc_mutex_type>(state, 4U); }
+TYPHOON_BENCHMARK(queue_mpmc_mutex_threads_8)  { run_mpmc<mpmc_mutex_type>(state, 8U); }
+
+TYPHOON_BENCHMARK(queue_mpmc_atomic_threads_1) { run_mpmc<mpmc_atomic_type>(state, 1U); }
+TYPHOON_BENCHMARK(queue_mpmc_atomic_threads_2) { run_mpmc<mpmc_atomic_type>(state, 2U); }
+TYPHOON_BENCHMARK(queue_mpmc_atomic_threads_4) { run_mpmc<mpmc_atomic_type>(state, 4U); }
+TYPHOON_BENCHMARK(queue_mpmc_atomic_threads_8) { run_mpmc<mpmc_atomic_type>(state, 8U); }
+
+//*****************************************************************************
+/// MPMC atomic queue using push_n and pop_n.
+//*****************************************************************************
+TYPHOON_BENCHMARK(queue_mpmc_atomic_batch_threads_1) { run_mpmc_batch(state, 1U); }
+TYPHOON_BENCHMARK(queue_mpmc_atomic_batch_threads_2) { run_mpmc_batch(state, 2U); }
+TYPHOON_BENCHMARK(queue_mpmc_atomic_batch_threads_4) { run_mpmc_batch(state, 4U); }
+TYPHOON_BENCHMARK(queue_mpmc_atomic_batch_threads_8) { run_mpmc_batch(state, 8U); }
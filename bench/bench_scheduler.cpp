@@ -0,0 +1,130 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/scheduler.hpp"
+#include "typhoon/scheduler_work_stealing.hpp"
+#include "typhoon/crc32.hpp"
+
+#include <atomic>
+
+namespace
+{
+  const size_t TASKS      = 8U;
+  const size_t WORK       = 64U;
+  const size_t BLOCK_SIZE = 256U;
+  const size_t STACK_SIZE = 64U * 1024U;
+
+  //***************************************************************************
+  /// A task that checksums a block for each unit of work.
+  /// The last unit of work of all the tasks stops the scheduler.
+  //***************************************************************************
+  class crc_task : public tpn::task
+  {
+  public:
+
+    crc_task()
+      : tpn::task(0U),
+        work(0U),
+        p_scheduler(nullptr),
+        p_remaining(nullptr)
+    {
+      for (size_t i = 0U; i < BLOCK_SIZE; ++i)
+      {
+        block[i] = uint8_t(i * 7U);
+      }
+    }
+
+    void reset(tpn::ischeduler& scheduler, std::atomic<size_t>& remaining)
+    {
+      work        = WORK;
+      p_scheduler = &scheduler;
+      p_remaining = &remaining;
+    }
+
+    uint32_t task_request_work() const override
+    {
+      return work;
+    }
+
+    void task_process_work() override
+    {
+      uint32_t crc = tpn::crc32_t256(block, block + BLOCK_SIZE).value();
+      bench::do_not_optimize(crc);
+
+      --work;
+
+      if (p_remaining->fetch_sub(1U) == 1U)
+      {
+        p_scheduler->exit_scheduler();
+      }
+    }
+
+  private:
+
+    uint32_t             work;
+    tpn::ischeduler*     p_scheduler;
+    std::atomic<size_t>* p_remaining;
+    uint8_t              block[BLOCK_SIZE];
+  };
+
+  //***************************************************************************
+  /// Runs TASKS * WORK units of work to completion on a fresh scheduler.
+  //***************************************************************************
+  template <typename TScheduler>
+  void run_tasks(bench::state& state)
+  {
+    static crc_task tasks[TASKS];
+
+    for (auto _ : state)
+    {
+      // A scheduler cannot be restarted once it has exited.
+      TScheduler scheduler;
+
+      std::atomic<size_t> remaining(TASKS * WORK);
+
+      for (size_t i = 0U; i < TASKS; ++i)
+      {
+        tasks[i].reset(scheduler, remaining);
+        scheduler.add_task(tasks[i]);
+      }
+
+      scheduler.start();
+    }
+
+    state.set_items_per_iteration(TASKS * WORK);
+  }
+}
+
+//*****************************************************************************
+/// The polling scheduler on one thread, for comparison.
+//*****************************************************************************
+TYPHOON_BENCHMARK(scheduler_sequential_single)
+{
+  run_tasks<tpn::scheduler<tpn::scheduler_policy_sequential_single, TASKS> >(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(scheduler_work_stealing_workers_1)
+{
+  run_tasks<tpn::scheduler_work_stealing<TASKS, 1U, STACK_SIZE> >(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(scheduler_work_stealing_workers_2)
+{
+  run_tasks<tpn::scheduler_work_stealing<TASKS, 2U, STACK_SIZE> >(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(scheduler_work_stealing_workers_4)
+{
+  run_tasks<tpn::scheduler_work_stealing<TASKS, 4U, STACK_SIZE> >(state);
+}
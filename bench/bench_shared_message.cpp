@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+
+#include "benchmark.hpp"
+
+#include "typhoon/message_bus.hpp"
+#include "typhoon/message_router.hpp"
+#include "typhoon/queued_message_router.hpp"
+#include "typhoon/queue_spsc_atomic.hpp"
+#include "typhoon/reference_counted_message_pool.hpp"
+#include "typhoon/fixed_sized_memory_block_allocator.hpp"
+#include "typhoon/algorithm.hpp"
+
+//
+// One message published to a bus with four subscribers, each of which queues
+// it for its own router, then the four queues drained.
+// Everything runs on the calling thread, so this measures the cost of the
+// fan-out itself. The atomic counter and allocator are never contended, and
+// nothing here says how the pipeline scales across threads.
+// The '_copy' benchmark is the pipeline without shared messages: each
+// subscriber receives the message by 'receive(const imessage&)' and copies
+// it into its own queue.
+//
+namespace
+{
+  const size_t Subscribers = 4U;
+  const size_t Queue_Size  = 4U;
+
+  //***************************************************************************
+  /// A frame of sensor samples.
+  //***************************************************************************
+  template <size_t VSamples>
+  struct frame : public tpn::message<1>
+  {
+    explicit frame(uint32_t sequence_)
+      : sequence(sequence_)
+    {
+      tpn::fill_n(samples, VSamples, int16_t(sequence_));
+    }
+
+    uint32_t sequence;
+    int16_t  samples[VSamples];
+  };
+
+  typedef frame<128U>  small_frame; // 260 bytes.
+  typedef frame<2048U> large_frame; // 4 KiB.
+
+  //***************************************************************************
+  /// The router that processes the frames.
+  //***************************************************************************
+  template <typename TFrame>
+  class processor : public tpn::message_router<processor<TFrame>, TFrame>
+  {
+  public:
+
+    explicit processor(tpn::message_router_id_t id)
+      : tpn::message_router<processor<TFrame>, TFrame>(id)
+      , total(0U)
+    {
+    }
+
+    void on_receive(const TFrame& msg)
+    {
+      total += uint32_t(msg.samples[msg.sequence % (sizeof(msg.samples) / sizeof(msg.samples[0]))]);
+    }
+
+    void on_receive_unknown(const tpn::imessage&)
+    {
+    }
+
+    uint32_t total;
+  };
+
+  //***************************************************************************
+  /// Queues a copy of each frame for the processor.
+  //***************************************************************************
+  template <typename TFrame>
+  class copying_router : public tpn::imessage_router
+  {
+  public:
+
+    explicit copying_router(processor<TFrame>& destination_)
+      : imessage_router(destination_.get_message_router_id())
+      , destination(destination_)
+    {
+    }
+
+    using tpn::imessage_router::receive;
+
+    void receive(const tpn::imessage& msg) TYPHOON_OVERRIDE
+    {
+      queue.push(static_cast<const TFrame&>(msg));
+    }
+
+    size_t process()
+    {
+      size_t count = 0U;
+
+      while (!queue.empty())
+      {
+        destination.receive(queue.front());
+        queue.pop();
+        ++count;
+      }
+
+      return count;
+    }
+
+    using tpn::imessage_router::accepts;
+
+    bool accepts(tpn::message_id_t id) const TYPHOON_OVERRIDE
+    {
+      return destination.accepts(id);
+    }
+
+    bool is_null_router() const TYPHOON_OVERRIDE
+    {
+      return false;
+    }
+
+    bool is_producer() const TYPHOON_OVERRIDE
+    {
+      return false;
+    }
+
+    bool is_consumer() const TYPHOON_OVERRIDE
+    {
+      return true;
+    }
+
+  private:
+
+    processor<TFrame>& destination;
+    tpn::queue_spsc_atomic<TFrame, Queue_Size> queue;
+  };
+
+  typedef tpn::queued_message_router<tpn::queue_spsc_atomic<tpn::shared_message, Queue_Size> > queued_router;
+
+  //***************************************************************************
+  /// Publishes frames shared from a pool.
+  /// The counter and allocator are either the atomic ones a multi-threaded
+  /// pipeline needs, or plain ones. Both are driven from this thread.
+  //***************************************************************************
+  template <typename TFrame, typename TCounter, template <size_t, size_t, size_t> class TAllocator>
+  void run_shared(bench::state& state)
+  {
+    typedef tpn::reference_counted_message_pool<TCounter> pool_t;
+    typedef typename pool_t::template pool_message_parameters<TFrame> parameters;
+
+    TAllocator<parameters::max_size, parameters::max_alignment, Queue_Size> allocator;
+    pool_t pool(allocator);
+
+    processor<TFrame> p0(0), p1(1), p2(2), p3(3);
+    queued_router q0(p0), q1(p1), q2(p2), q3(p3);
+    queued_router* queues[Subscribers] = { &q0, &q1, &q2, &q3 };
+
+    tpn::message_bus<Subscribers> bus;
+
+    for (size_t i = 0U; i < Subscribers; ++i)
+    {
+      bus.subscribe(*queues[i]);
+    }
+
+    uint32_t sequence = 0U;
+
+    for (auto _ : state)
+    {
+      bus.receive(tpn::shared_message::create<TFrame>(pool, sequence++));
+
+      for (size_t i = 0U; i < Subscribers; ++i)
+      {
+        queues[i]->process();
+      }
+    }
+
+    uint32_t total = p0.total + p1.total + p2.total + p3.total;
+    bench::do_not_optimize(total);
+    state.set_items_per_iteration(Subscribers);
+  }
+
+  //***************************************************************************
+  /// Publishes frames that each subscriber copies.
+  //***************************************************************************
+  template <typename TFrame>
+  void run_copy(bench::state& state)
+  {
+    processor<TFrame> p0(0), p1(1), p2(2), p3(3);
+    copying_router<TFrame> c0(p0), c1(p1), c2(p2), c3(p3);
+    copying_router<TFrame>* queues[Subscribers] = { &c0, &c1, &c2, &c3 };
+
+    tpn::message_bus<Subscribers> bus;
+
+    for (size_t i = 0U; i < Subscribers; ++i)
+    {
+      bus.subscribe(*queues[i]);
+    }
+
+    uint32_t sequence = 0U;
+
+    for (auto _ : state)
+    {
+      bus.receive(TFrame(sequence++));
+
+      for (size_t i = 0U; i < Subscribers; ++i)
+      {
+        queues[i]->process();
+      }
+    }
+
+    uint32_t total = p0.total + p1.total + p2.total + p3.total;
+    bench::do_not_optimize(total);
+    state.set_items_per_iteration(Subscribers);
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(shared_message_fan_out_4)
+{
+  run_shared<small_frame, tpn::atomic_int32_t, tpn::fixed_sized_memory_block_allocator_atomic>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(shared_message_fan_out_4_single_thread)
+{
+  run_shared<small_frame, int32_t, tpn::fixed_sized_memory_block_allocator>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(shared_message_fan_out_4_copy)
+{
+  run_copy<small_frame>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(shared_message_fan_out_4_4k)
+{
+  run_shared<large_frame, tpn::atomic_int32_t, tpn::fixed_sized_memory_block_allocator_atomic>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(shared_message_fan_out_4_4k_copy)
+{
+  run_copy<large_frame>(state);
+}
@@ -0,0 +1,200 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+// Growth changes the layout of ivector, so it must be enabled for the whole
+// program. It is enabled for this file alone only because every element
+// type here is local to it, so no ivector instantiation is shared.
+#define TYPHOON_IVECTOR_GROWTH_ENABLE
+
+#include "benchmark.hpp"
+
+#include "typhoon/small_vector.hpp"
+#include "typhoon/slab_memory_block_allocator.hpp"
+
+#include <string.h>
+
+//
+// A small_vector that mostly stays inline, and one that spills to the
+// allocator and grows, against a fixed vector sized for the worst case.
+// The relocation pair moves a full inline buffer out to a block and back,
+// once as bytes and once element by element.
+//
+namespace
+{
+  const size_t INLINE = 16U;
+  const size_t SIZE   = 256U;
+
+  typedef tpn::slab_memory_block_allocator<8U,
+                                           tpn::slab_size_class<256U,  4U>,
+                                           tpn::slab_size_class<1024U, 4U>,
+                                           tpn::slab_size_class<4096U, 4U> > allocator_type;
+
+  struct item
+  {
+    item(uint32_t value_)
+      : value(value_)
+    {
+    }
+
+    uint32_t value;
+  };
+
+  typedef tpn::small_vector<item, INLINE> small_vector_type;
+  typedef tpn::vector<item, SIZE>         vector_type;
+
+  //***************************************************************************
+  /// A sample with a user-declared copy, so it is not trivially copyable, but
+  /// nothing in it depends on its address.
+  //***************************************************************************
+  struct sample
+  {
+    sample()
+      : id(0U)
+    {
+      memset(values, 0, sizeof(values));
+    }
+
+    explicit sample(uint32_t id_)
+      : id(id_)
+    {
+      memset(values, 0, sizeof(values));
+    }
+
+    sample(const sample& other)
+      : id(other.id)
+    {
+      memcpy(values, other.values, sizeof(values));
+    }
+
+    sample& operator =(const sample& other)
+    {
+      id = other.id;
+      memcpy(values, other.values, sizeof(values));
+      return *this;
+    }
+
+    uint32_t id;
+    uint32_t values[3];
+  };
+
+  struct relocatable_sample : public sample
+  {
+    relocatable_sample()
+    {
+    }
+
+    explicit relocatable_sample(uint32_t id_)
+      : sample(id_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  template <typename TSample>
+  void move_back_and_forth(bench::state& state)
+  {
+    allocator_type allocator;
+
+    tpn::small_vector<TSample, 64U> a(allocator);
+
+    for (uint32_t i = 0U; i < 64U; ++i)
+    {
+      a.push_back(TSample(i));
+    }
+
+    for (auto _ : state)
+    {
+      // Out to a block and back inline, relocating every element twice.
+      a.reserve(128U);
+      a.shrink_to_fit();
+      bench::do_not_optimize(a);
+    }
+
+    state.set_items_per_iteration(128U);
+  }
+}
+
+namespace tpn
+{
+  template <>
+  struct is_trivially_relocatable<relocatable_sample> : public tpn::true_type
+  {
+  };
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(small_vector_push_back_inline)
+{
+  allocator_type allocator;
+  small_vector_type data(allocator);
+
+  for (auto _ : state)
+  {
+    data.clear();
+
+    for (uint32_t i = 0U; i < INLINE; ++i)
+    {
+      data.push_back(i);
+    }
+
+    bench::do_not_optimize(data);
+  }
+
+  state.set_items_per_iteration(INLINE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(small_vector_push_back_spill_256)
+{
+  allocator_type allocator;
+
+  for (auto _ : state)
+  {
+    small_vector_type data(allocator);
+
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      data.push_back(i);
+    }
+
+    bench::do_not_optimize(data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(small_vector_push_back_fixed_256)
+{
+  for (auto _ : state)
+  {
+    vector_type data;
+
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      data.push_back(i);
+    }
+
+    bench::do_not_optimize(data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(small_vector_relocate_memcpy)
+{
+  move_back_and_forth<relocatable_sample>(state);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(small_vector_relocate_move)
+{
+  move_back_and_forth<sample>(state);
+}
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/algorithm.hpp"
+#include "typhoon/span.hpp"
+
+namespace
+{
+  const size_t SIZE = 1024U;
+
+  uint32_t source[SIZE];
+  uint32_t data[SIZE];
+  uint32_t scratch[SIZE / 2U];
+
+  //***************************************************************************
+  void fill()
+  {
+    uint32_t value = 0x9E3779B9U;
+
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      value     = (value * 1664525U) + 1013904223U;
+      source[i] = value >> 8;
+    }
+  }
+
+  //***************************************************************************
+  template <typename TSort>
+  void run_sort(bench::state& state, TSort sort)
+  {
+    fill();
+
+    for (auto _ : state)
+    {
+      state.pause_timing();
+      tpn::copy(source, source + SIZE, data);
+      state.resume_timing();
+
+      sort(data, data + SIZE);
+      bench::do_not_optimize(data);
+    }
+
+    state.set_items_per_iteration(SIZE);
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(sort_shell_1024)
+{
+  run_sort(state, [](uint32_t* first, uint32_t* last) { tpn::shell_sort(first, last); });
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(sort_intro_1024)
+{
+  run_sort(state, [](uint32_t* first, uint32_t* last) { tpn::intro_sort(first, last); });
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(sort_insertion_1024)
+{
+  run_sort(state, [](uint32_t* first, uint32_t* last) { tpn::insertion_sort(first, last); });
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(sort_merge_in_place_1024)
+{
+  run_sort(state, [](uint32_t* first, uint32_t* last) { tpn::merge_sort(first, last); });
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(sort_merge_buffered_1024)
+{
+  run_sort(state, [](uint32_t* first, uint32_t* last) { tpn::merge_sort(first, last, tpn::span<uint32_t>(scratch, SIZE / 2U)); });
+}
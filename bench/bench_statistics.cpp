@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+
+#include "benchmark.hpp"
+
+#include "typhoon/mean.hpp"
+#include "typhoon/rms.hpp"
+#include "typhoon/variance.hpp"
+#include "typhoon/covariance.hpp"
+#include "typhoon/correlation.hpp"
+#include "typhoon/span.hpp"
+
+#include <stdint.h>
+#include <vector>
+
+//
+// A block of 4096 sensor samples per channel, as a DMA transfer delivers
+// them. Each benchmark has a '_scalar' twin that adds the samples one call
+// at a time.
+//
+namespace
+{
+  const size_t Samples = 4096U;
+
+  //***************************************************************************
+  template <typename T>
+  const std::vector<T>& channel(uint32_t seed)
+  {
+    static std::vector<T> samples[2];
+
+    std::vector<T>& s = samples[seed & 1U];
+
+    if (s.empty())
+    {
+      uint32_t x = seed + 1U;
+
+      for (size_t i = 0U; i < Samples; ++i)
+      {
+        x = (x * 1664525U) + 1013904223U;
+        s.push_back(T(2048.0 + (double(x >> 20U) / 16.0)));
+      }
+    }
+
+    return s;
+  }
+
+  //***************************************************************************
+  template <typename TStatistic, typename T>
+  void run_batch(bench::state& state)
+  {
+    const std::vector<T>& samples = channel<T>(0U);
+
+    for (auto _ : state)
+    {
+      TStatistic statistic;
+      statistic.add(tpn::span<const T>(samples.data(), samples.size()));
+      double result = statistic;
+      bench::do_not_optimize(result);
+    }
+
+    state.set_items_per_iteration(Samples);
+  }
+
+  //***************************************************************************
+  template <typename TStatistic, typename T>
+  void run_scalar(bench::state& state)
+  {
+    const std::vector<T>& samples = channel<T>(0U);
+
+    for (auto _ : state)
+    {
+      TStatistic statistic;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        statistic.add(samples[i]);
+      }
+
+      double result = statistic;
+      bench::do_not_optimize(result);
+    }
+
+    state.set_items_per_iteration(Samples);
+  }
+
+  //***************************************************************************
+  template <typename TStatistic, typename T>
+  void run_pair_batch(bench::state& state)
+  {
+    const std::vector<T>& samples1 = channel<T>(0U);
+    const std::vector<T>& samples2 = channel<T>(1U);
+
+    for (auto _ : state)
+    {
+      TStatistic statistic;
+      statistic.add(tpn::span<const T>(samples1.data(), samples1.size()),
+                    tpn::span<const T>(samples2.data(), samples2.size()));
+      double result = statistic;
+      bench::do_not_optimize(result);
+    }
+
+    state.set_items_per_iteration(Samples);
+  }
+
+  //***************************************************************************
+  template <typename TStatistic, typename T>
+  void run_pair_scalar(bench::state& state)
+  {
+    const std::vector<T>& samples1 = channel<T>(0U);
+    const std::vector<T>& samples2 = channel<T>(1U);
+
+    for (auto _ : state)
+    {
+      TStatistic statistic;
+
+      for (size_t i = 0U; i < samples1.size(); ++i)
+      {
+        statistic.add(samples1[i], samples2[i]);
+      }
+
+      double result = statistic;
+      bench::do_not_optimize(result);
+    }
+
+    state.set_items_per_iteration(Samples);
+  }
+
+  typedef tpn::mean<float>                                          mean_float;
+  typedef tpn::rms<float>                                           rms_float;
+  typedef tpn::variance<tpn::variance_type::Sample, float>          variance_float;
+  typedef tpn::variance<tpn::variance_type::Sample, double>         variance_double;
+  typedef tpn::variance<tpn::variance_type::Sample, int16_t, int64_t> variance_int16;
+  typedef tpn::covariance<tpn::covariance_type::Sample, float>      covariance_float;
+  typedef tpn::correlation<tpn::correlation_type::Sample, float>    correlation_float;
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(statistics_mean_float)                { run_batch<mean_float, float>(state); }
+TYPHOON_BENCHMARK(statistics_mean_float_scalar)         { run_scalar<mean_float, float>(state); }
+TYPHOON_BENCHMARK(statistics_rms_float)                 { run_batch<rms_float, float>(state); }
+TYPHOON_BENCHMARK(statistics_rms_float_scalar)          { run_scalar<rms_float, float>(state); }
+TYPHOON_BENCHMARK(statistics_variance_float)            { run_batch<variance_float, float>(state); }
+TYPHOON_BENCHMARK(statistics_variance_float_scalar)     { run_scalar<variance_float, float>(state); }
+TYPHOON_BENCHMARK(statistics_variance_double)           { run_batch<variance_double, double>(state); }
+TYPHOON_BENCHMARK(statistics_variance_double_scalar)    { run_scalar<variance_double, double>(state); }
+TYPHOON_BENCHMARK(statistics_variance_int16)            { run_batch<variance_int16, int16_t>(state); }
+TYPHOON_BENCHMARK(statistics_variance_int16_scalar)     { run_scalar<variance_int16, int16_t>(state); }
+TYPHOON_BENCHMARK(statistics_covariance_float)          { run_pair_batch<covariance_float, float>(state); }
+TYPHOON_BENCHMARK(statistics_covariance_float_scalar)   { run_pair_scalar<covariance_float, float>(state); }
+TYPHOON_BENCHMARK(statistics_correlation_float)         { run_pair_batch<correlation_float, float>(state); }
+TYPHOON_BENCHMARK(statistics_correlation_float_scalar)  { run_pair_scalar<correlation_float, float>(state); }
+
+//*****************************************************************************
+/// Four partial results, as four cores would produce, reduced into one.
+//*****************************************************************************
+TYPHOON_BENCHMARK(statistics_variance_float_merge)
+{
+  const std::vector<float>& samples = channel<float>(0U);
+  const size_t quarter = Samples / 4U;
+
+  for (auto _ : state)
+  {
+    variance_float partial[4];
+
+    for (size_t i = 0U; i < 4U; ++i)
+    {
+      partial[i].add(tpn::span<const float>(samples.data() + (i * quarter), quarter));
+    }
+
+    for (size_t i = 1U; i < 4U; ++i)
+    {
+      partial[0].merge(partial[i]);
+    }
+
+    double result = partial[0];
+    bench::do_not_optimize(result);
+  }
+
+  state.set_items_per_iteration(Samples);
+}
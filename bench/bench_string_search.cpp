@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/string.hpp"
+#include "typhoon/string_view.hpp"
+#include "typhoon/string_utilities.hpp"
+#include "typhoon/algorithm.hpp"
+
+//
+// Each benchmark has a '_scalar' twin that runs the character at a time
+// loops the strings used before, to show what the block scanning gains.
+//
+namespace
+{
+  typedef tpn::string<256> line_type;
+
+  //***************************************************************************
+  /// A line of the text telemetry protocol, 'key=value' fields separated by
+  /// commas, with the field being looked for at the end.
+  //***************************************************************************
+  const line_type& telemetry_line()
+  {
+    static line_type line;
+
+    if (line.empty())
+    {
+      line.assign("   node=gateway-07,uptime=0001234567,rssi=-067,snr=0009.5,battery=003.71,"
+                  "queue=00000012,drops=00000000,retries=00000003,channel=11,firmware=2.4.17,"
+                  "voltage=03.302,current=00.118,power=000.389,errors=00000000,state=RUNNING,"
+                  "temperature=0041.25\r\n   ");
+    }
+
+    return line;
+  }
+
+  const char* const delimiters = ",;\r\n";
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(string_find_char)
+{
+  const line_type& line = telemetry_line();
+
+  for (auto _ : state)
+  {
+    size_t position = line.find('\r');
+    bench::do_not_optimize(position);
+  }
+
+  state.set_items_per_iteration(line.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(string_find_char_scalar)
+{
+  const line_type& line = telemetry_line();
+
+  for (auto _ : state)
+  {
+    size_t position = tpn::private_string_search::scalar_find(line.data(), line.size(), '\r', true);
+    bench::do_not_optimize(position);
+  }
+
+  state.set_items_per_iteration(line.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(string_find_substring)
+{
+  const line_type& line = telemetry_line();
+
+  for (auto _ : state)
+  {
+    size_t position = line.find("temperature=");
+    bench::do_not_optimize(position);
+  }
+
+  state.set_items_per_iteration(line.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(string_find_substring_scalar)
+{
+  const line_type& line = telemetry_line();
+  const char* const key = "temperature=";
+
+  for (auto _ : state)
+  {
+    line_type::const_iterator itr = tpn::search(line.begin(), line.end(), key, key + 12);
+    bench::do_not_optimize(itr);
+  }
+
+  state.set_items_per_iteration(line.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(string_find_first_of)
+{
+  const line_type& line = telemetry_line();
+
+  for (auto _ : state)
+  {
+    size_t position = line.find_first_of(";\r\n");
+    bench::do_not_optimize(position);
+  }
+
+  state.set_items_per_iteration(line.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(string_find_first_of_scalar)
+{
+  const line_type& line = telemetry_line();
+
+  for (auto _ : state)
+  {
+    size_t position = tpn::private_string_search::scalar_find_of(line.data(), line.size(), ";\r\n", 3U, true);
+    bench::do_not_optimize(position);
+  }
+
+  state.set_items_per_iteration(line.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(string_view_rfind)
+{
+  const line_type& line = telemetry_line();
+  const tpn::string_view view(line.data(), line.size());
+
+  for (auto _ : state)
+  {
+    size_t position = view.rfind("node=");
+    bench::do_not_optimize(position);
+  }
+
+  state.set_items_per_iteration(line.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(string_view_rfind_scalar)
+{
+  const line_type& line = telemetry_line();
+
+  for (auto _ : state)
+  {
+    size_t position = tpn::private_string_search::scalar_rsearch(line.data(), line.size(), "node=", 5U);
+    bench::do_not_optimize(position);
+  }
+
+  state.set_items_per_iteration(line.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(string_get_token)
+{
+  const line_type& line = telemetry_line();
+  const tpn::string_view view(line.data(), line.size());
+
+  for (auto _ : state)
+  {
+    size_t tokens = 0U;
+    tpn::optional<tpn::string_view> token;
+
+    while ((token = tpn::get_token(view, delimiters, token, true)))
+    {
+      ++tokens;
+    }
+
+    bench::do_not_optimize(tokens);
+  }
+
+  state.set_items_per_iteration(line.size());
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(string_trim_whitespace)
+{
+  const line_type& line = telemetry_line();
+
+  for (auto _ : state)
+  {
+    tpn::string_view view = tpn::trim_view_whitespace(tpn::string_view(line.data(), line.size()));
+    bench::do_not_optimize(view);
+  }
+
+  state.set_items_per_iteration(line.size());
+}
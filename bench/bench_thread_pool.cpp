@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/thread_pool.hpp"
+#include "typhoon/crc32.hpp"
+
+namespace
+{
+  const size_t BLOCK_SIZE = 4096U;
+  const size_t BLOCKS     = 64U;
+  const size_t STACK_SIZE = 64U * 1024U;
+
+  //***************************************************************************
+  const uint8_t* buffer()
+  {
+    static uint8_t data[BLOCK_SIZE * BLOCKS];
+    static bool    initialised = false;
+
+    if (!initialised)
+    {
+      uint32_t value = 0x12345678U;
+
+      for (size_t i = 0U; i < sizeof(data); ++i)
+      {
+        value   = (value * 1664525U) + 1013904223U;
+        data[i] = uint8_t(value >> 24);
+      }
+
+      initialised = true;
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  uint32_t crc_block(size_t block)
+  {
+    const uint8_t* p = buffer() + (block * BLOCK_SIZE);
+
+    return tpn::crc32_t256(p, p + BLOCK_SIZE).value();
+  }
+
+  //***************************************************************************
+  /// Checksums every block, fanned out across the pool.
+  //***************************************************************************
+  template <typename TPool>
+  void crc_blocks(bench::state& state, TPool& pool)
+  {
+    static uint32_t results[BLOCKS];
+
+    buffer();
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < BLOCKS; ++i)
+      {
+        while (!pool.submit([i]() { results[i] = crc_block(i); }))
+        {
+          tpn::this_thread::yield();
+        }
+      }
+
+      pool.wait();
+      bench::do_not_optimize(results);
+    }
+
+    state.set_bytes_per_iteration(BLOCK_SIZE * BLOCKS);
+  }
+}
+
+//*****************************************************************************
+/// The same work on the calling thread, for comparison.
+//*****************************************************************************
+TYPHOON_BENCHMARK(thread_pool_crc32_serial)
+{
+  static uint32_t results[BLOCKS];
+
+  buffer();
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0U; i < BLOCKS; ++i)
+    {
+      results[i] = crc_block(i);
+    }
+
+    bench::do_not_optimize(results);
+  }
+
+  state.set_bytes_per_iteration(BLOCK_SIZE * BLOCKS);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(thread_pool_crc32_threads_1)
+{
+  static tpn::thread_pool<1U, STACK_SIZE> pool;
+
+  crc_blocks(state, pool);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(thread_pool_crc32_threads_2)
+{
+  static tpn::thread_pool<2U, STACK_SIZE> pool;
+
+  crc_blocks(state, pool);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(thread_pool_crc32_threads_4)
+{
+  static tpn::thread_pool<4U, STACK_SIZE> pool;
+
+  crc_blocks(state, pool);
+}
+
+//*****************************************************************************
+/// The cost of a round trip through the pool for an empty task.
+//*****************************************************************************
+TYPHOON_BENCHMARK(thread_pool_submit_wait)
+{
+  static tpn::thread_pool<2U, STACK_SIZE> pool;
+
+  for (auto _ : state)
+  {
+    pool.submit([]() {});
+    pool.wait();
+  }
+}
@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/unordered_map.hpp"
+
+namespace
+{
+  const size_t SIZE = 1024U;
+
+  typedef tpn::unordered_map<uint32_t, uint32_t, SIZE> map_type;
+
+  //***************************************************************************
+  /// Spreads the keys so that they do not map to consecutive buckets.
+  //***************************************************************************
+  uint32_t make_key(uint32_t i)
+  {
+    return i * 2654435761U;
+  }
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(unordered_map_insert_1024)
+{
+  static map_type data;
+
+  for (auto _ : state)
+  {
+    data.clear();
+
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      data.insert(map_type::value_type(make_key(i), i));
+    }
+
+    bench::do_not_optimize(data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(unordered_map_find_hit_1024)
+{
+  static map_type data;
+  data.clear();
+
+  for (uint32_t i = 0U; i < SIZE; ++i)
+  {
+    data.insert(map_type::value_type(make_key(i), i));
+  }
+
+  for (auto _ : state)
+  {
+    uint32_t sum = 0U;
+
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      sum += data.find(make_key(i))->second;
+    }
+
+    bench::do_not_optimize(sum);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(unordered_map_find_miss_1024)
+{
+  static map_type data;
+  data.clear();
+
+  for (uint32_t i = 0U; i < SIZE; ++i)
+  {
+    data.insert(map_type::value_type(make_key(i), i));
+  }
+
+  for (auto _ : state)
+  {
+    size_t misses = 0U;
+
+    for (uint32_t i = SIZE; i < (2U * SIZE); ++i)
+    {
+      misses += (data.find(make_key(i)) == data.end()) ? 1U : 0U;
+    }
+
+    bench::do_not_optimize(misses);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(unordered_map_iterate_1024)
+{
+  static map_type data;
+  data.clear();
+
+  for (uint32_t i = 0U; i < SIZE; ++i)
+  {
+    data.insert(map_type::value_type(make_key(i), i));
+  }
+
+  for (auto _ : state)
+  {
+    uint32_t sum = 0U;
+
+    for (map_type::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+    {
+      sum += itr->second;
+    }
+
+    bench::do_not_optimize(sum);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
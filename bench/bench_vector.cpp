@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include "benchmark.hpp"
+
+#include "typhoon/vector.hpp"
+
+namespace
+{
+  const size_t SIZE = 256U;
+
+  typedef tpn::vector<uint32_t, SIZE> vector_type;
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(vector_push_back_256)
+{
+  vector_type data;
+
+  for (auto _ : state)
+  {
+    data.clear();
+
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      data.push_back(i);
+    }
+
+    bench::do_not_optimize(data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(vector_insert_front_256)
+{
+  vector_type data;
+
+  for (auto _ : state)
+  {
+    data.clear();
+
+    for (uint32_t i = 0U; i < SIZE; ++i)
+    {
+      data.insert(data.begin(), i);
+    }
+
+    bench::do_not_optimize(data);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(vector_iterate_256)
+{
+  vector_type data;
+
+  for (uint32_t i = 0U; i < SIZE; ++i)
+  {
+    data.push_back(i);
+  }
+
+  for (auto _ : state)
+  {
+    uint32_t sum = 0U;
+
+    for (vector_type::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+    {
+      sum += *itr;
+    }
+
+    bench::do_not_optimize(sum);
+  }
+
+  state.set_items_per_iteration(SIZE);
+}
+
+//*****************************************************************************
+TYPHOON_BENCHMARK(vector_copy_256)
+{
+  vector_type source;
+
+  for (uint32_t i = 0U; i < SIZE; ++i)
+  {
+    source.push_back(i);
+  }
+
+  vector_type destination;
+
+  for (auto _ : state)
+  {
+    destination = source;
+    bench::do_not_optimize(destination);
+  }
+
+  state.set_bytes_per_iteration(SIZE * sizeof(uint32_t));
+}
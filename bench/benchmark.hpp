@@ -0,0 +1,253 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#ifndef TYPHOON_BENCH_BENCHMARK_HPP
+#define TYPHOON_BENCH_BENCHMARK_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+  //***************************************************************************
+  /// The state passed to every benchmark function.
+  /// The timed region is the body of the range-for loop over the state.
+  //***************************************************************************
+  class state
+  {
+  public:
+
+    typedef std::chrono::steady_clock clock_type;
+
+    //*************************************************************************
+    class iterator
+    {
+    public:
+
+      iterator()
+        : p_state(nullptr),
+          remaining(0U)
+      {
+      }
+
+      iterator(state* p_state_, size_t remaining_)
+        : p_state(p_state_),
+          remaining(remaining_)
+      {
+      }
+
+      size_t operator *() const
+      {
+        return remaining;
+      }
+
+      iterator& operator ++()
+      {
+        --remaining;
+        return *this;
+      }
+
+      bool operator !=(const iterator&)
+      {
+        if (remaining != 0U)
+        {
+          return true;
+        }
+
+        p_state->stop_timer();
+        return false;
+      }
+
+    private:
+
+      state* p_state;
+      size_t remaining;
+    };
+
+    //*************************************************************************
+    explicit state(size_t iterations_)
+      : n_iterations(iterations_),
+        bytes_per_iteration(0U),
+        items_per_iteration(0U),
+        elapsed(0)
+    {
+    }
+
+    //*************************************************************************
+    iterator begin()
+    {
+      start_timer();
+      return iterator(this, n_iterations);
+    }
+
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator();
+    }
+
+    //*************************************************************************
+    size_t iterations() const
+    {
+      return n_iterations;
+    }
+
+    //*************************************************************************
+    /// Pauses the timer for untimed setup inside the loop.
+    //*************************************************************************
+    void pause_timing()
+    {
+      stop_timer();
+    }
+
+    //*************************************************************************
+    void resume_timing()
+    {
+      start_timer();
+    }
+
+    //*************************************************************************
+    /// Sets the number of bytes processed by one iteration.
+    //*************************************************************************
+    void set_bytes_per_iteration(size_t bytes)
+    {
+      bytes_per_iteration = bytes;
+    }
+
+    //*************************************************************************
+    /// Sets the number of items processed by one iteration.
+    //*************************************************************************
+    void set_items_per_iteration(size_t items)
+    {
+      items_per_iteration = items;
+    }
+
+    //*************************************************************************
+    /// Records a named counter that is reported alongside the timing.
+    //*************************************************************************
+    void set_counter(const char* name, double value)
+    {
+      for (size_t i = 0U; i < counters.size(); ++i)
+      {
+        if (counters[i].first == name)
+        {
+          counters[i].second = value;
+          return;
+        }
+      }
+
+      counters.push_back(std::make_pair(std::string(name), value));
+    }
+
+    //*************************************************************************
+    double elapsed_ns() const
+    {
+      return double(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    size_t get_bytes_per_iteration() const { return bytes_per_iteration; }
+    size_t get_items_per_iteration() const { return items_per_iteration; }
+
+    const std::vector<std::pair<std::string, double> >& get_counters() const
+    {
+      return counters;
+    }
+
+  private:
+
+    //*************************************************************************
+    void start_timer()
+    {
+      start = clock_type::now();
+    }
+
+    //*************************************************************************
+    void stop_timer()
+    {
+      elapsed += clock_type::now() - start;
+    }
+
+    size_t                   n_iterations;
+    size_t                   bytes_per_iteration;
+    size_t                   items_per_iteration;
+    clock_type::time_point   start;
+    clock_type::duration     elapsed;
+    std::vector<std::pair<std::string, double> > counters;
+  };
+
+  typedef void (*function_type)(bench::state&);
+
+  //***************************************************************************
+  /// A registered benchmark.
+  //***************************************************************************
+  struct entry
+  {
+    const char*   name;
+    function_type function;
+  };
+
+  //***************************************************************************
+  /// The list of all registered benchmarks.
+  //***************************************************************************
+  inline std::vector<entry>& registry()
+  {
+    static std::vector<entry> entries;
+    return entries;
+  }
+
+  //***************************************************************************
+  /// Adds a benchmark to the registry at static initialisation time.
+  //***************************************************************************
+  struct registrar
+  {
+    registrar(const char* name, function_type function)
+    {
+      entry e = { name, function };
+      registry().push_back(e);
+    }
+  };
+
+  //***************************************************************************
+  /// Prevents the compiler from optimising away a value.
+  //***************************************************************************
+  template <typename T>
+  inline void do_not_optimize(T& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    volatile T sink = value;
+    (void)sink;
+#endif
+  }
+
+  //***************************************************************************
+  /// Forces all pending writes to memory to be considered observable.
+  //***************************************************************************
+  inline void clobber_memory()
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+  }
+}
+
+//*****************************************************************************
+/// Defines and registers a benchmark function.
+//*****************************************************************************
+#define TYPHOON_BENCHMARK(name) \
+  static void name(bench::state&); \
+  static const bench::registrar name##_registrar(#name, name); \
+  static void name(bench::state& state)
+
+#endif
@@ -0,0 +1,263 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+// Host benchmark runner.
+//
+// Usage: typhoon_bench [--filter=<substring>] [--format=json|csv]
+//                      [--min-time=<seconds>] [--repetitions=<n>] [--list]
+//
+// Results are written to stdout, one record per benchmark.
+// The JSON format is a single object with a "benchmarks" array.
+//
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+  //***************************************************************************
+  struct options
+  {
+    options()
+      : filter(""),
+        csv(false),
+        list(false),
+        min_time(0.05),
+        repetitions(5U)
+    {
+    }
+
+    const char* filter;
+    bool        csv;
+    bool        list;
+    double      min_time;
+    size_t      repetitions;
+  };
+
+  //***************************************************************************
+  struct result
+  {
+    const char* name;
+    size_t      iterations;
+    double      ns_min;
+    double      ns_median;
+    size_t      bytes_per_iteration;
+    size_t      items_per_iteration;
+    std::vector<std::pair<std::string, double> > counters;
+  };
+
+  //***************************************************************************
+  bool starts_with(const char* text, const char* prefix)
+  {
+    return strncmp(text, prefix, strlen(prefix)) == 0;
+  }
+
+  //***************************************************************************
+  bool parse(int argc, char* argv[], options& opt)
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      const char* arg = argv[i];
+
+      if (starts_with(arg, "--filter="))
+      {
+        opt.filter = arg + strlen("--filter=");
+      }
+      else if (strcmp(arg, "--format=csv") == 0)
+      {
+        opt.csv = true;
+      }
+      else if (strcmp(arg, "--format=json") == 0)
+      {
+        opt.csv = false;
+      }
+      else if (starts_with(arg, "--min-time="))
+      {
+        opt.min_time = atof(arg + strlen("--min-time="));
+      }
+      else if (starts_with(arg, "--repetitions="))
+      {
+        opt.repetitions = size_t(std::max(1, atoi(arg + strlen("--repetitions="))));
+      }
+      else if (strcmp(arg, "--list") == 0)
+      {
+        opt.list = true;
+      }
+      else
+      {
+        fprintf(stderr, "typhoon_bench: unknown option '%s'\n", arg);
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Doubles the iteration count until one run takes at least min_time.
+  //***************************************************************************
+  size_t calibrate(bench::function_type function, double min_time)
+  {
+    const double min_ns = min_time * 1e9;
+    size_t iterations = 1U;
+
+    for (;;)
+    {
+      bench::state s(iterations);
+      function(s);
+
+      if ((s.elapsed_ns() >= min_ns) || (iterations >= (size_t(1U) << 40)))
+      {
+        return iterations;
+      }
+
+      // Jump close to the target once the measurement is meaningful.
+      if (s.elapsed_ns() > (min_ns / 100.0))
+      {
+        const double scale = (min_ns * 1.2) / s.elapsed_ns();
+        iterations = std::max(iterations + 1U, size_t(double(iterations) * scale));
+      }
+      else
+      {
+        iterations *= 10U;
+      }
+    }
+  }
+
+  //***************************************************************************
+  result run(const bench::entry& e, const options& opt)
+  {
+    result r;
+    r.name       = e.name;
+    r.iterations = calibrate(e.function, opt.min_time);
+
+    std::vector<double> samples;
+
+    for (size_t i = 0U; i < opt.repetitions; ++i)
+    {
+      bench::state s(r.iterations);
+      e.function(s);
+
+      samples.push_back(s.elapsed_ns() / double(r.iterations));
+
+      r.bytes_per_iteration = s.get_bytes_per_iteration();
+      r.items_per_iteration = s.get_items_per_iteration();
+      r.counters            = s.get_counters();
+    }
+
+    std::sort(samples.begin(), samples.end());
+    r.ns_min    = samples.front();
+    r.ns_median = samples[samples.size() / 2U];
+
+    return r;
+  }
+
+  //***************************************************************************
+  double per_second(size_t per_iteration, double ns)
+  {
+    return (per_iteration == 0U) || (ns <= 0.0) ? 0.0 : (double(per_iteration) * 1e9) / ns;
+  }
+
+  //***************************************************************************
+  void print_json(const std::vector<result>& results)
+  {
+    printf("{\n  \"benchmarks\": [");
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const result& r = results[i];
+
+      printf("%s\n    {\"name\": \"%s\", \"iterations\": %zu, \"ns_per_iter\": %.3f, \"ns_per_iter_median\": %.3f, "
+             "\"bytes_per_second\": %.1f, \"items_per_second\": %.1f",
+             (i == 0U) ? "" : ",",
+             r.name, r.iterations, r.ns_min, r.ns_median,
+             per_second(r.bytes_per_iteration, r.ns_min),
+             per_second(r.items_per_iteration, r.ns_min));
+
+      for (size_t c = 0U; c < r.counters.size(); ++c)
+      {
+        printf(", \"%s\": %.6g", r.counters[c].first.c_str(), r.counters[c].second);
+      }
+
+      printf("}");
+    }
+
+    printf("\n  ]\n}\n");
+  }
+
+  //***************************************************************************
+  void print_csv(const std::vector<result>& results)
+  {
+    printf("name,iterations,ns_per_iter,ns_per_iter_median,bytes_per_second,items_per_second\n");
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const result& r = results[i];
+
+      printf("%s,%zu,%.3f,%.3f,%.1f,%.1f\n",
+             r.name, r.iterations, r.ns_min, r.ns_median,
+             per_second(r.bytes_per_iteration, r.ns_min),
+             per_second(r.items_per_iteration, r.ns_min));
+    }
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  options opt;
+
+  if (!parse(argc, argv, opt))
+  {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<bench::entry> entries = bench::registry();
+
+  std::sort(entries.begin(), entries.end(),
+            [](const bench::entry& lhs, const bench::entry& rhs) { return strcmp(lhs.name, rhs.name) < 0; });
+
+  std::vector<result> results;
+
+  for (size_t i = 0U; i < entries.size(); ++i)
+  {
+    const bench::entry& e = entries[i];
+
+    if (strstr(e.name, opt.filter) == nullptr)
+    {
+      continue;
+    }
+
+    if (opt.list)
+    {
+      printf("%s\n", e.name);
+      continue;
+    }
+
+    fprintf(stderr, "running %s\n", e.name);
+    results.push_back(run(e, opt));
+  }
+
+  if (!opt.list)
+  {
+    if (opt.csv)
+    {
+      print_csv(results);
+    }
+    else
+    {
+      print_json(results);
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
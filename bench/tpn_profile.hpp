@@ -0,0 +1,18 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#ifndef TYPHOON_BENCH_PROFILE_HPP
+#define TYPHOON_BENCH_PROFILE_HPP
+
+#include "typhoon/profiles/gcc_linux_x86.hpp"
+
+#define TYPHOON_CALLBACK_TIMER_USE_ATOMIC_LOCK
+#define TYPHOON_MESSAGE_TIMER_USE_ATOMIC_LOCK
+
+#endif
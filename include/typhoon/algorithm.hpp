@@ -43,6 +43,7 @@ SOFTWARE.
 #include "iterator.hpp"
 #include "functional.hpp"
 #include "utility.hpp"
+#include "nullptr.hpp"
 
 #include <stdint.h>
 #include <string.h>
@@ -81,6 +82,21 @@ namespace tpn
 
   template <typename TIterator, typename TCompare>
   TYPHOON_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename T, size_t Extent>
+  class span;
 }
 
 //*****************************************************************************
@@ -1072,6 +1088,10 @@ namespace tpn
     TYPHOON_CONSTEXPR14
     TIterator rotate_general(TIterator first, TIterator middle, TIterator last)
     {
+      // The new position of the first item.
+      TIterator result = first;
+      tpn::advance(result, tpn::distance(middle, last));
+
       TIterator next = middle;
 
       while (first != next)
@@ -1093,7 +1113,7 @@ namespace tpn
         }
       }
 
-      return first;
+      return result;
     }
 
     //*********************************
@@ -1143,6 +1163,16 @@ namespace tpn
   TYPHOON_CONSTEXPR14
   TIterator rotate(TIterator first, TIterator middle, TIterator last)
   {
+    if (first == middle)
+    {
+      return last;
+    }
+
+    if (middle == last)
+    {
+      return first;
+    }
+
     if (tpn::next(first) == middle)
     {
       return private_algorithm::rotate_left_by_one(first, last);
@@ -1786,11 +1816,26 @@ namespace tpn
 #if TYPHOON_NOT_USING_STL
   //***************************************************************************
   /// Sorts the elements.
+  /// Uses introsort for random access iterators, shell sort otherwise.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
-  void sort(TIterator first, TIterator last, TCompare compare)
+  typename tpn::enable_if<tpn::is_random_access_iterator<TIterator>::value, void>::type
+    sort(TIterator first, TIterator last, TCompare compare)
+  {
+    tpn::intro_sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Uses introsort for random access iterators, shell sort otherwise.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  typename tpn::enable_if<!tpn::is_random_access_iterator<TIterator>::value, void>::type
+    sort(TIterator first, TIterator last, TCompare compare)
   {
     tpn::shell_sort(first, last, compare);
   }
@@ -1802,17 +1847,33 @@ namespace tpn
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    tpn::shell_sort(first, last, tpn::less<typename tpn::iterator_traits<TIterator>::value_type>());
+    tpn::sort(first, last, tpn::less<typename tpn::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// Uses in-place merge sort for random access iterators, insertion sort otherwise.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
-  void stable_sort(TIterator first, TIterator last, TCompare compare)
+  typename tpn::enable_if<tpn::is_random_access_iterator<TIterator>::value, void>::type
+    stable_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    tpn::merge_sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses in-place merge sort for random access iterators, insertion sort otherwise.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  typename tpn::enable_if<!tpn::is_random_access_iterator<TIterator>::value, void>::type
+    stable_sort(TIterator first, TIterator last, TCompare compare)
   {
     tpn::insertion_sort(first, last, compare);
   }
@@ -1825,7 +1886,7 @@ namespace tpn
   template <typename TIterator>
   void stable_sort(TIterator first, TIterator last)
   {
-    tpn::insertion_sort(first, last, tpn::less<typename tpn::iterator_traits<TIterator>::value_type>());
+    tpn::stable_sort(first, last, tpn::less<typename tpn::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
@@ -2833,6 +2894,412 @@ namespace tpn
     tpn::sort_heap(first, last);
   }
 
+  //***************************************************************************
+  namespace private_sort
+  {
+    /// Ranges at or below this size are finished with insertion sort.
+    static TYPHOON_CONSTANT ptrdiff_t INSERTION_SORT_THRESHOLD = 16;
+
+    //*********************************
+    /// Insertion sort for random access iterators that moves rather than rotates.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    void insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename tpn::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        if (compare(*itr, *first))
+        {
+          value_type value = tpn::move(*itr);
+          tpn::move_backward(first, itr, itr + 1);
+          *first = tpn::move(value);
+        }
+        else if (compare(*itr, *(itr - 1)))
+        {
+          // *first is a sentinel, so the scan cannot run off the front.
+          value_type value = tpn::move(*itr);
+          TIterator  hole  = itr;
+
+          do
+          {
+            *hole = tpn::move(*(hole - 1));
+            --hole;
+          } while (compare(value, *(hole - 1)));
+
+          *hole = tpn::move(value);
+        }
+      }
+    }
+
+    //*********************************
+    /// Moves the median of a, b and c to result.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    void move_median_to_first(TIterator result, TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      if (compare(*a, *b))
+      {
+        if (compare(*b, *c))
+        {
+          tpn::iter_swap(result, b);
+        }
+        else if (compare(*a, *c))
+        {
+          tpn::iter_swap(result, c);
+        }
+        else
+        {
+          tpn::iter_swap(result, a);
+        }
+      }
+      else if (compare(*a, *c))
+      {
+        tpn::iter_swap(result, a);
+      }
+      else if (compare(*b, *c))
+      {
+        tpn::iter_swap(result, c);
+      }
+      else
+      {
+        tpn::iter_swap(result, b);
+      }
+    }
+
+    //*********************************
+    /// Hoare partition around *pivot.
+    /// The median of three guarantees a sentinel at each end.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    TIterator unguarded_partition(TIterator first, TIterator last, TIterator pivot, TCompare compare)
+    {
+      while (true)
+      {
+        while (compare(*first, *pivot))
+        {
+          ++first;
+        }
+
+        --last;
+
+        while (compare(*pivot, *last))
+        {
+          --last;
+        }
+
+        if (!(first < last))
+        {
+          return first;
+        }
+
+        tpn::iter_swap(first, last);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// Quicksort until the partitions are small, switching to heap sort
+    /// if the recursion depth shows quadratic behaviour.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_loop(TIterator first, TIterator last, size_t depth_limit, TCompare compare)
+    {
+      while ((last - first) > INSERTION_SORT_THRESHOLD)
+      {
+        if (depth_limit == 0U)
+        {
+          tpn::make_heap(first, last, compare);
+          tpn::sort_heap(first, last, compare);
+          return;
+        }
+
+        --depth_limit;
+
+        TIterator middle = first + ((last - first) / 2);
+        move_median_to_first(first, first + 1, middle, last - 1, compare);
+
+        TIterator cut = unguarded_partition(first + 1, last, first, compare);
+
+        // Recurse into the right partition, loop on the left.
+        intro_sort_loop(cut, last, depth_limit, compare);
+        last = cut;
+      }
+    }
+
+    //*********************************
+    /// 2 * floor(log2(n))
+    //*********************************
+    inline size_t intro_sort_depth_limit(size_t n)
+    {
+      size_t depth = 0U;
+
+      while (n > 1U)
+      {
+        n >>= 1U;
+        ++depth;
+      }
+
+      return depth * 2U;
+    }
+
+    //*********************************
+    /// Merges [first, middle) and [middle, last) in place using rotations.
+    //*********************************
+    template <typename TIterator, typename TDistance, typename TCompare>
+    void merge_without_buffer(TIterator first, TIterator middle, TIterator last, TDistance length1, TDistance length2, TCompare compare)
+    {
+      while ((length1 != 0) && (length2 != 0))
+      {
+        typedef typename tpn::iterator_traits<TIterator>::value_type value_type;
+
+        if (length1 == 1)
+        {
+          // Slide the single left element up into place.
+          TIterator  position = tpn::lower_bound(middle, last, *first, compare);
+          value_type value    = tpn::move(*first);
+          *tpn::move(middle, position, first) = tpn::move(value);
+          return;
+        }
+
+        if (length2 == 1)
+        {
+          // Slide the single right element down into place.
+          TIterator  position = tpn::upper_bound(first, middle, *middle, compare);
+          value_type value    = tpn::move(*middle);
+          tpn::move_backward(position, middle, middle + 1);
+          *position = tpn::move(value);
+          return;
+        }
+
+        TIterator first_cut;
+        TIterator second_cut;
+        TDistance length11;
+        TDistance length22;
+
+        if (length1 > length2)
+        {
+          length11   = length1 / 2;
+          first_cut  = first + length11;
+          second_cut = tpn::lower_bound(middle, last, *first_cut, compare);
+          length22   = second_cut - middle;
+        }
+        else
+        {
+          length22   = length2 / 2;
+          second_cut = middle + length22;
+          first_cut  = tpn::upper_bound(first, middle, *second_cut, compare);
+          length11   = first_cut - first;
+        }
+
+        // Rotate [first_cut, second_cut) by three reversals.
+        tpn::reverse(first_cut, middle);
+        tpn::reverse(middle, second_cut);
+        tpn::reverse(first_cut, second_cut);
+        TIterator new_middle = first_cut + (second_cut - middle);
+
+        // Recurse on the smaller half, loop on the larger.
+        if ((length11 + length22) < ((length1 - length11) + (length2 - length22)))
+        {
+          merge_without_buffer(first, first_cut, new_middle, length11, length22, compare);
+
+          first   = new_middle;
+          middle  = second_cut;
+          length1 = length1 - length11;
+          length2 = length2 - length22;
+        }
+        else
+        {
+          merge_without_buffer(new_middle, second_cut, last, length1 - length11, length2 - length22, compare);
+
+          last    = new_middle;
+          middle  = first_cut;
+          length1 = length11;
+          length2 = length22;
+        }
+      }
+    }
+
+    //*********************************
+    /// Merges [first, middle) and [middle, last) by moving the left run into the buffer.
+    //*********************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_with_buffer(TIterator first, TIterator middle, TIterator last, TBufferIterator buffer, TCompare compare)
+    {
+      TBufferIterator buffer_end = tpn::move(first, middle, buffer);
+
+      while ((buffer != buffer_end) && (middle != last))
+      {
+        if (compare(*middle, *buffer))
+        {
+          *first = tpn::move(*middle);
+          ++middle;
+        }
+        else
+        {
+          *first = tpn::move(*buffer);
+          ++buffer;
+        }
+
+        ++first;
+      }
+
+      tpn::move(buffer, buffer_end, first);
+    }
+
+    //*********************************
+    /// Bottom up merge sort.
+    /// Runs are merged through the buffer when the left run fits, otherwise in place.
+    //*********************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_sort(TIterator first, TIterator last, TBufferIterator buffer, size_t buffer_size, TCompare compare)
+    {
+      typedef typename tpn::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t n = last - first;
+
+      for (difference_t i = 0; i < n; i += INSERTION_SORT_THRESHOLD)
+      {
+        private_sort::insertion_sort(first + i, first + tpn::min(i + INSERTION_SORT_THRESHOLD, n), compare);
+      }
+
+      for (difference_t width = INSERTION_SORT_THRESHOLD; width < n; width *= 2)
+      {
+        for (difference_t low = 0; low < (n - width); low += (2 * width))
+        {
+          TIterator begin  = first + low;
+          TIterator middle = begin + width;
+          TIterator end    = first + tpn::min(low + (2 * width), n);
+
+          // Already in order?
+          if (!compare(*middle, *(middle - 1)))
+          {
+            continue;
+          }
+
+          if (size_t(width) <= buffer_size)
+          {
+            merge_with_buffer(begin, middle, end, buffer, compare);
+          }
+          else
+          {
+            merge_without_buffer(begin, middle, end, width, difference_t(end - middle), compare);
+          }
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using introsort.
+  /// Quicksort with a median of three pivot, falling back to heap sort when
+  /// the recursion gets too deep, and finishing with insertion sort.
+  /// O(N log N) worst case. Not stable. Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    if ((last - first) < 2)
+    {
+      return;
+    }
+
+    private_sort::intro_sort_loop(first, last, private_sort::intro_sort_depth_limit(size_t(last - first)), compare);
+    private_sort::insertion_sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using introsort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last)
+  {
+    tpn::intro_sort(first, last, tpn::less<typename tpn::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using an in-place merge sort.
+  /// Stable. O(N log² N) moves. Requires random access iterators. No extra memory.
+  /// Supply a scratch buffer to the span overload for O(N log N).
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename tpn::iterator_traits<TIterator>::value_type value_type;
+
+    private_sort::merge_sort(first, last, static_cast<value_type*>(TYPHOON_NULLPTR), 0U, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using an in-place merge sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last)
+  {
+    tpn::merge_sort(first, last, tpn::less<typename tpn::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort with a caller supplied scratch buffer.
+  /// Stable. O(N log N) when the buffer holds at least half of the range.
+  /// Merges that do not fit the buffer are done in place.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, tpn::span<T, Extent> buffer, TCompare compare)
+  {
+    private_sort::merge_sort(first, last, buffer.data(), buffer.size(), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort with a caller supplied scratch buffer.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent>
+  void merge_sort(TIterator first, TIterator last, tpn::span<T, Extent> buffer)
+  {
+    tpn::merge_sort(first, last, buffer, tpn::less<typename tpn::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses the caller supplied scratch buffer instead of the heap.
+  /// A buffer of half the range length gives O(N log N).
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, tpn::span<T, Extent> buffer, TCompare compare)
+  {
+    tpn::merge_sort(first, last, buffer, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses the caller supplied scratch buffer instead of the heap.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent>
+  void stable_sort(TIterator first, TIterator last, tpn::span<T, Extent> buffer)
+  {
+    tpn::merge_sort(first, last, buffer, tpn::less<typename tpn::iterator_traits<TIterator>::value_type>());
+  }
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
@@ -47,6 +47,7 @@ SOFTWARE.
 #include "exception.hpp"
 #include "binary.hpp"
 #include "flags.hpp"
+#include "private/string_search.hpp"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -1354,16 +1355,7 @@ namespace tpn
         return npos;
       }
 
-      const_iterator iposition = tpn::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return tpn::distance(begin(), iposition);
-      }
+      return found_at(pos, private_string_search::search(p_buffer + pos, size() - pos, str.data(), str.size()));
     }
 
     //*********************************************************************
@@ -1380,16 +1372,12 @@ namespace tpn
       }
 #endif
 
-      const_iterator iposition = tpn::search(begin() + pos, end(), s, s + tpn::strlen(s));
-
-      if (iposition == end())
+      if (pos > size())
       {
         return npos;
       }
-      else
-      {
-        return tpn::distance(begin(), iposition);
-      }
+
+      return found_at(pos, private_string_search::search(p_buffer + pos, size() - pos, s, tpn::strlen(s)));
     }
 
     //*********************************************************************
@@ -1407,16 +1395,12 @@ namespace tpn
       }
 #endif
 
-      const_iterator iposition = tpn::search(begin() + pos, end(), s, s + n);
-
-      if (iposition == end())
+      if (pos > size())
       {
         return npos;
       }
-      else
-      {
-        return tpn::distance(begin(), iposition);
-      }
+
+      return found_at(pos, private_string_search::search(p_buffer + pos, size() - pos, s, n));
     }
 
     //*********************************************************************
@@ -1426,16 +1410,12 @@ namespace tpn
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = tpn::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return tpn::distance(begin(), i);
-      }
-      else
+      if (position >= size())
       {
         return npos;
       }
+
+      return found_at(position, private_string_search::find(p_buffer + position, size() - position, c));
     }
 
     //*********************************************************************
@@ -1450,23 +1430,9 @@ namespace tpn
         return npos;
       }
 
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
+      position = tpn::min(position, size());
 
-      const_reverse_iterator iposition = tpn::search(rbegin() + position, rend(), str.rbegin(), str.rend());
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - str.size() - tpn::distance(rbegin(), iposition);
-      }
+      return private_string_search::rsearch(p_buffer, position, str.data(), str.size());
     }
 
     //*********************************************************************
@@ -1483,26 +1449,9 @@ namespace tpn
         return npos;
       }
 
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
+      position = tpn::min(position, size());
 
-      const_reverse_iterator srbegin(s + len);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = tpn::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - len - tpn::distance(rbegin(), iposition);
-      }
+      return private_string_search::rsearch(p_buffer, position, s, len);
     }
 
     //*********************************************************************
@@ -1517,26 +1466,9 @@ namespace tpn
         return npos;
       }
 
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + length_);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = tpn::search(rbegin() + position, rend(), srbegin, srend);
+      position = tpn::min(position, size());
 
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - length_ - tpn::distance(rbegin(), iposition);
-      }
+      return private_string_search::rsearch(p_buffer, position, s, length_);
     }
 
     //*********************************************************************
@@ -1546,23 +1478,9 @@ namespace tpn
     //*********************************************************************
     size_type rfind(T c, size_type position = npos) const
     {
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator i = tpn::find(rbegin() + position, rend(), c);
+      position = tpn::min(position, size());
 
-      if (i != rend())
-      {
-        return size() - tpn::distance(rbegin(), i) - 1;
-      }
-      else
-      {
-        return npos;
-      }
+      return private_string_search::rfind(p_buffer, position, c);
     }
 
     //*********************************************************************
@@ -1889,16 +1807,7 @@ namespace tpn
     {
       if (position < size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
+        return found_at(position, private_string_search::find_of(p_buffer + position, size() - position, s, n));
       }
 
       return npos;
@@ -1913,13 +1822,7 @@ namespace tpn
     {
       if (position < size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
+        return found_at(position, private_string_search::find(p_buffer + position, size() - position, c));
       }
 
       return npos;
@@ -1960,23 +1863,7 @@ namespace tpn
 
       position = tpn::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return private_string_search::rfind_of(p_buffer, position + 1U, s, n);
     }
 
     //*********************************************************************
@@ -1993,20 +1880,7 @@ namespace tpn
 
       position = tpn::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        if (p_buffer[position] == c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return private_string_search::rfind(p_buffer, position + 1U, c);
     }
 
     //*********************************************************************
@@ -2039,23 +1913,7 @@ namespace tpn
     {
       if (position < size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
+        return found_at(position, private_string_search::find_of(p_buffer + position, size() - position, s, n, false));
       }
 
       return npos;
@@ -2070,13 +1928,7 @@ namespace tpn
     {
       if (position < size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] != c)
-          {
-            return i;
-          }
-        }
+        return found_at(position, private_string_search::find(p_buffer + position, size() - position, c, false));
       }
 
       return npos;
@@ -2117,30 +1969,7 @@ namespace tpn
 
       position = tpn::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return private_string_search::rfind_of(p_buffer, position + 1U, s, n, false);
     }
 
     //*********************************************************************
@@ -2155,20 +1984,7 @@ namespace tpn
 
       position = tpn::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        if (p_buffer[position] != c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return private_string_search::rfind(p_buffer, position + 1U, c, false);
     }
 
     //*************************************************************************
@@ -2291,6 +2107,14 @@ namespace tpn
 
   private:
 
+    //*************************************************************************
+    /// Converts a search result relative to 'position' to an index.
+    //*************************************************************************
+    static size_type found_at(size_type position, size_t index)
+    {
+      return (index == private_string_search::npos) ? npos : position + index;
+    }
+
     //*************************************************************************
     /// Compare helper function
     //*************************************************************************
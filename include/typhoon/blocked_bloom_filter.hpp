@@ -0,0 +1,366 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2014 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_BLOCKED_BLOOM_FILTER_HPP
+#define TYPHOON_BLOCKED_BLOOM_FILTER_HPP
+
+#include "platform.hpp"
+#include "parameter_type.hpp"
+#include "algorithm.hpp"
+#include "hash.hpp"
+#include "murmur3.hpp"
+#include "span.hpp"
+#include "binary.hpp"
+#include "log.hpp"
+#include "static_assert.hpp"
+
+#include <stdint.h>
+#include <stddef.h>
+
+///\defgroup blocked_bloom_filter blocked_bloom_filter
+/// A Bloom filter that keeps the bits for each key in one cache line.
+///\ingroup containers
+
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+  #define TYPHOON_BLOCKED_BLOOM_FILTER_PREFETCH(p) __builtin_prefetch(p)
+#else
+  #define TYPHOON_BLOCKED_BLOOM_FILTER_PREFETCH(p)
+#endif
+
+namespace tpn
+{
+  //***************************************************************************
+  /// A blocked Bloom filter.
+  /// Each key sets 'Hash_Count' bits within one 64 byte block, so adding or
+  /// testing a key touches a single cache line. The bit positions are
+  /// h1 + i * h2 (Kirsch-Mitzenmacher), where h1 and h2 come from one call
+  /// of THash. 'Hash_Count' and the size are chosen at compile time from
+  /// the number of keys and the wanted false positive rate.
+  ///\tparam TKey                  The key type.
+  ///\tparam VCapacity             The number of keys the filter is sized for.
+  ///\tparam VFalse_Positive_Ratio One false positive in this many lookups, when full. Default 100 (1%).
+  ///\tparam THash                 The hash for the key. Default tpn::hash<TKey>.
+  ///\ingroup blocked_bloom_filter
+  //***************************************************************************
+  template <typename TKey, size_t VCapacity, size_t VFalse_Positive_Ratio = 100U, typename THash = tpn::hash<TKey> >
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename tpn::parameter_type<TKey>::type parameter_t;
+
+  public:
+
+    TYPHOON_STATIC_ASSERT(VCapacity > 0U, "Zero capacity");
+
+    typedef TKey  key_type;
+    typedef THash hasher;
+
+    //*************************************************************************
+    /// A key is probed log2(ratio) times. The standard filter needs
+    /// 1.44 bits per probe per key for that rate. Confining the probes to a
+    /// block makes some blocks fuller than the average, which costs more as
+    /// the number of probes grows, so k/40 more bits are used to keep to the
+    /// rate.
+    //*************************************************************************
+    static TYPHOON_CONSTANT size_t Hash_Count   = tpn::log2<VFalse_Positive_Ratio - 1U>::value + 1U;
+    static TYPHOON_CONSTANT size_t Bits_Per_Key = ((Hash_Count * 1443U * (40U + Hash_Count)) + 39999U) / 40000U;
+    static TYPHOON_CONSTANT size_t Block_Bits   = 512U;
+    static TYPHOON_CONSTANT size_t Blocks       = ((VCapacity * Bits_Per_Key) + Block_Bits - 1U) / Block_Bits;
+    static TYPHOON_CONSTANT size_t Bits         = Blocks * Block_Bits;
+    static TYPHOON_CONSTANT size_t Batch_Size   = 16U;
+
+    TYPHOON_STATIC_ASSERT(VFalse_Positive_Ratio >= 2U, "False positive ratio must be at least 2");
+    TYPHOON_STATIC_ASSERT(Hash_Count <= 24U, "False positive ratio too small for a blocked filter");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    blocked_bloom_filter()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the filter of all entries.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Blocks; ++i)
+      {
+        for (size_t j = 0U; j < Block_Words; ++j)
+        {
+          blocks[i].words[j] = 0U;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //*************************************************************************
+    void add(parameter_t key)
+    {
+      set(locate(key));
+    }
+
+    //*************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key may be in the filter, <b>false</b> if it is not.
+    //*************************************************************************
+    bool exists(parameter_t key) const
+    {
+      return test(locate(key));
+    }
+
+    //*************************************************************************
+    /// Adds the keys to the filter.
+    /// The blocks for a batch of keys are prefetched before any are written,
+    /// so that the cache misses overlap.
+    //*************************************************************************
+    void add_batch(tpn::span<const TKey> keys)
+    {
+      probe probes[Batch_Size];
+
+      for (size_t first = 0U; first < keys.size(); first += Batch_Size)
+      {
+        const size_t n = tpn::min(Batch_Size, keys.size() - first);
+
+        locate_batch(keys.data() + first, n, probes);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          set(probes[i]);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Tests the keys, writing the result for each key to 'results'.
+    /// Tests min(keys.size(), results.size()) keys.
+    /// The blocks for a batch of keys are prefetched before any are read,
+    /// so that the cache misses overlap.
+    ///\return The number of keys that may be in the filter.
+    //*************************************************************************
+    size_t exists_batch(tpn::span<const TKey> keys, tpn::span<bool> results) const
+    {
+      probe  probes[Batch_Size];
+      size_t found = 0U;
+      size_t size  = tpn::min(keys.size(), results.size());
+
+      for (size_t first = 0U; first < size; first += Batch_Size)
+      {
+        const size_t n = tpn::min(Batch_Size, size - first);
+
+        locate_batch(keys.data() + first, n, probes);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const bool exists = test(probes[i]);
+
+          results[first + i] = exists;
+          found += exists ? 1U : 0U;
+        }
+      }
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Returns the width of the filter, in bits.
+    //*************************************************************************
+    size_t width() const
+    {
+      return Bits;
+    }
+
+    //*************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //*************************************************************************
+    size_t usage() const
+    {
+      return (100U * count()) / Bits;
+    }
+
+    //*************************************************************************
+    /// Returns the number of filter bits set.
+    //*************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < Blocks; ++i)
+      {
+        for (size_t j = 0U; j < Block_Words; ++j)
+        {
+          n += tpn::count_bits(blocks[i].words[j]);
+        }
+      }
+
+      return n;
+    }
+
+  private:
+
+    static TYPHOON_CONSTANT size_t Block_Words = Block_Bits / 64U;
+    static TYPHOON_CONSTANT size_t Block_Shift = tpn::log2<Block_Bits>::value;
+
+    //*************************************************************************
+    /// One cache line of filter bits.
+    //*************************************************************************
+    struct block
+    {
+      alignas(64) uint64_t words[Block_Words];
+    };
+
+    //*************************************************************************
+    /// The block for a key and its two base hashes.
+    //*************************************************************************
+    struct probe
+    {
+      const block* p_block;
+      uint32_t     h1;
+      uint32_t     h2;
+    };
+
+    //*************************************************************************
+    /// Hashes a key.
+    /// The hash is spread by the murmur3 finaliser, so that keys with
+    /// identity hashes, such as integers, use the whole filter.
+    /// The high half of the hash selects the block. The low half is h1, and
+    /// h2 is taken from a multiple of the hash, made odd so that the probes
+    /// of a key do not repeat.
+    //*************************************************************************
+    probe locate(parameter_t key) const
+    {
+      const uint64_t h     = private_murmur3::fmix(static_cast<uint64_t>(THash()(key)));
+      const uint64_t index = (static_cast<uint64_t>(static_cast<uint32_t>(h >> 32U)) * Blocks) >> 32U;
+
+      probe result;
+      result.p_block = &blocks[index];
+      result.h1      = static_cast<uint32_t>(h);
+      result.h2      = static_cast<uint32_t>((h * 0x9E3779B97F4A7C15ULL) >> 32U) | 1U;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Hashes a batch of keys and prefetches their blocks.
+    //*************************************************************************
+    void locate_batch(const TKey* keys, size_t n, probe* probes) const
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        probes[i] = locate(keys[i]);
+        TYPHOON_BLOCKED_BLOOM_FILTER_PREFETCH(probes[i].p_block);
+      }
+    }
+
+    //*************************************************************************
+    /// The bit within the block for the probe 'g' = h1 + i * h2.
+    /// Each probe is mixed before its top bits are taken. The raw sequence
+    /// is a straight line within the block, and lines overlap far more often
+    /// than random bits do.
+    //*************************************************************************
+    static uint32_t bit_index(uint32_t g)
+    {
+      g ^= (g >> 15U);
+      g *= 0x2C1B3C6DU;
+
+      return g >> (32U - Block_Shift);
+    }
+
+    //*************************************************************************
+    void set(const probe& p)
+    {
+      block&   b = blocks[p.p_block - blocks];
+      uint32_t g = p.h1;
+
+      for (size_t i = 0U; i < Hash_Count; ++i)
+      {
+        const uint32_t index = bit_index(g);
+        b.words[index / 64U] |= uint64_t(1U) << (index % 64U);
+        g += p.h2;
+      }
+    }
+
+    //*************************************************************************
+    /// Stops at the first clear bit, so most absent keys are rejected by
+    /// the first probe or two.
+    //*************************************************************************
+    static bool test(const probe& p)
+    {
+      uint32_t g = p.h1;
+
+      for (size_t i = 0U; i < Hash_Count; ++i)
+      {
+        const uint32_t index = bit_index(g);
+
+        if ((p.p_block->words[index / 64U] & (uint64_t(1U) << (index % 64U))) == 0U)
+        {
+          return false;
+        }
+
+        g += p.h2;
+      }
+
+      return true;
+    }
+
+    /// The filter bits.
+    block blocks[Blocks];
+  };
+
+  template <typename TKey, size_t VCapacity, size_t VFalse_Positive_Ratio, typename THash>
+  TYPHOON_CONSTANT size_t blocked_bloom_filter<TKey, VCapacity, VFalse_Positive_Ratio, THash>::Hash_Count;
+
+  template <typename TKey, size_t VCapacity, size_t VFalse_Positive_Ratio, typename THash>
+  TYPHOON_CONSTANT size_t blocked_bloom_filter<TKey, VCapacity, VFalse_Positive_Ratio, THash>::Bits_Per_Key;
+
+  template <typename TKey, size_t VCapacity, size_t VFalse_Positive_Ratio, typename THash>
+  TYPHOON_CONSTANT size_t blocked_bloom_filter<TKey, VCapacity, VFalse_Positive_Ratio, THash>::Block_Bits;
+
+  template <typename TKey, size_t VCapacity, size_t VFalse_Positive_Ratio, typename THash>
+  TYPHOON_CONSTANT size_t blocked_bloom_filter<TKey, VCapacity, VFalse_Positive_Ratio, THash>::Blocks;
+
+  template <typename TKey, size_t VCapacity, size_t VFalse_Positive_Ratio, typename THash>
+  TYPHOON_CONSTANT size_t blocked_bloom_filter<TKey, VCapacity, VFalse_Positive_Ratio, THash>::Bits;
+
+  template <typename TKey, size_t VCapacity, size_t VFalse_Positive_Ratio, typename THash>
+  TYPHOON_CONSTANT size_t blocked_bloom_filter<TKey, VCapacity, VFalse_Positive_Ratio, THash>::Batch_Size;
+
+  template <typename TKey, size_t VCapacity, size_t VFalse_Positive_Ratio, typename THash>
+  TYPHOON_CONSTANT size_t blocked_bloom_filter<TKey, VCapacity, VFalse_Positive_Ratio, THash>::Block_Words;
+}
+
+#undef TYPHOON_BLOCKED_BLOOM_FILTER_PREFETCH
+
+#endif
@@ -0,0 +1,1190 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2021 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_BTREE_MAP_HPP
+#define TYPHOON_BTREE_MAP_HPP
+
+#include "platform.hpp"
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "functional.hpp"
+#include "pool.hpp"
+#include "exception.hpp"
+#include "error_handler.hpp"
+#include "nullptr.hpp"
+#include "type_traits.hpp"
+#include "nth_type.hpp"
+#include "parameter_type.hpp"
+#include "utility.hpp"
+#include "placement_new.hpp"
+#include "initializer_list.hpp"
+
+#include "private/btree_base.hpp"
+#include "private/comparator_is_transparent.hpp"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// A map with the capacity defined at compile time, held in a B+ tree.
+/// Each node holds many keys in one contiguous block, so a lookup visits a
+/// few cache lines per level rather than one per comparison, and ordered
+/// iteration walks the values in place along the linked leaves.
+/// Nodes come from fixed capacity pools sized for the worst case.
+/// Inserting or erasing an element may move others within or between
+/// nodes, which invalidates iterators to them.
+///\ingroup containers
+//*****************************************************************************
+
+namespace tpn
+{
+  //***************************************************************************
+  /// Exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_exception : public tpn::exception
+  {
+  public:
+
+    btree_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : tpn::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_full : public tpn::btree_map_exception
+  {
+  public:
+
+    btree_map_full(string_type file_name_, numeric_type line_number_)
+      : tpn::btree_map_exception(TYPHOON_ERROR_TEXT("btree_map:full", TYPHOON_BTREE_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_out_of_bounds : public tpn::btree_map_exception
+  {
+  public:
+
+    btree_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : tpn::btree_map_exception(TYPHOON_ERROR_TEXT("btree_map:bounds", TYPHOON_BTREE_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A templated base for all tpn::btree_map types.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = tpn::less<TKey> >
+  class ibtree_map : public tpn::btree_base<TKey,
+                                            TYPHOON_OR_STD::pair<const TKey, TMapped>,
+                                            tpn::select1st<TYPHOON_OR_STD::pair<const TKey, TMapped> >,
+                                            TKeyCompare,
+                                            true>
+  {
+  private:
+
+    typedef tpn::btree_base<TKey,
+                            TYPHOON_OR_STD::pair<const TKey, TMapped>,
+                            tpn::select1st<TYPHOON_OR_STD::pair<const TKey, TMapped> >,
+                            TKeyCompare,
+                            true> base;
+
+    typedef typename base::position position;
+
+  public:
+
+    typedef TKey                                      key_type;
+    typedef TYPHOON_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TMapped                                   mapped_type;
+    typedef TKeyCompare                               key_compare;
+    typedef value_type&                               reference;
+    typedef const value_type&                         const_reference;
+#if TYPHOON_USING_CPP11
+    typedef value_type&&                              rvalue_reference;
+#endif
+    typedef value_type*                               pointer;
+    typedef const value_type*                         const_pointer;
+    typedef size_t                                    size_type;
+
+    using base::size;
+    using base::full;
+    using base::capacity;
+
+    class value_compare
+    {
+    public:
+
+      bool operator()(const_reference lhs, const_reference rhs) const
+      {
+        return (kcompare(lhs.first, rhs.first));
+      }
+
+    private:
+
+      key_compare kcompare;
+    };
+
+  protected:
+
+    /// Defines the key value parameter type
+    typedef const TKey& key_parameter_t;
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public tpn::iterator<TYPHOON_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class ibtree_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_map(TYPHOON_NULLPTR)
+      {
+        pos.p_leaf = TYPHOON_NULLPTR;
+        pos.index  = 0U;
+      }
+
+      iterator(ibtree_map& map, position pos_)
+        : p_map(&map)
+        , pos(pos_)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        pos = base::next_position(pos);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        pos = base::next_position(pos);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        pos = p_map->previous_position(pos);
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        pos = p_map->previous_position(pos);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return pos.p_leaf->values()[pos.index];
+      }
+
+      pointer operator &() const
+      {
+        return &(pos.p_leaf->values()[pos.index]);
+      }
+
+      pointer operator ->() const
+      {
+        return &(pos.p_leaf->values()[pos.index]);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_map == rhs.p_map) && (lhs.pos.p_leaf == rhs.pos.p_leaf) && (lhs.pos.index == rhs.pos.index);
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      // Pointer to map associated with this iterator
+      ibtree_map* p_map;
+
+      // The leaf and slot of the current element
+      position pos;
+    };
+
+    friend class iterator;
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public tpn::iterator<TYPHOON_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree_map;
+
+      const_iterator()
+        : p_map(TYPHOON_NULLPTR)
+      {
+        pos.p_leaf = TYPHOON_NULLPTR;
+        pos.index  = 0U;
+      }
+
+      const_iterator(const ibtree_map& map, position pos_)
+        : p_map(&map)
+        , pos(pos_)
+      {
+      }
+
+      const_iterator(const typename ibtree_map::iterator& other)
+        : p_map(other.p_map)
+        , pos(other.pos)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        pos = base::next_position(pos);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        pos = base::next_position(pos);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        pos = p_map->previous_position(pos);
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        pos = p_map->previous_position(pos);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return pos.p_leaf->values()[pos.index];
+      }
+
+      const_pointer operator &() const
+      {
+        return &(pos.p_leaf->values()[pos.index]);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &(pos.p_leaf->values()[pos.index]);
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_map == rhs.p_map) && (lhs.pos.p_leaf == rhs.pos.p_leaf) && (lhs.pos.index == rhs.pos.index);
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      // Pointer to map associated with this iterator
+      const ibtree_map* p_map;
+
+      // The leaf and slot of the current element
+      position pos;
+    };
+
+    friend class const_iterator;
+
+    typedef typename tpn::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef TYPHOON_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef TYPHOON_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the map.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, base::first_position());
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the map.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, base::first_position());
+    }
+
+    //*************************************************************************
+    /// Gets the end of the map.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, base::end_position());
+    }
+
+    //*************************************************************************
+    /// Gets the end of the map.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, base::end_position());
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the map.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, base::first_position());
+    }
+
+    //*************************************************************************
+    /// Gets the end of the map.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, base::end_position());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits btree_map_full if the key
+    /// is not present and the map is full.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      iterator i_element = find(key);
+
+      if (i_element == end())
+      {
+        // Doesn't exist, so create a new one.
+        i_element = insert(TYPHOON_OR_STD::make_pair(key, mapped_type())).first;
+      }
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits btree_map_out_of_bounds if the key is not present.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator i_element = find(key);
+
+      TYPHOON_ASSERT(i_element != end(), TYPHOON_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_type& at(const K& key)
+    {
+      iterator i_element = find(key);
+
+      TYPHOON_ASSERT(i_element != end(), TYPHOON_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits btree_map_out_of_bounds if the key is not present.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator i_element = find(key);
+
+      TYPHOON_ASSERT(i_element != end(), TYPHOON_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const mapped_type& at(const K& key) const
+    {
+      const_iterator i_element = find(key);
+
+      TYPHOON_ASSERT(i_element != end(), TYPHOON_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Assigns values that are already sorted by key, with no repeated keys.
+    /// The tree is built bottom up with evenly filled nodes.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(tpn::sorted_unique_t, TIterator first, TIterator last)
+    {
+      clear();
+      insert(tpn::sorted_unique_t(), first, last);
+    }
+
+    //*************************************************************************
+    /// Clears the map.
+    //*************************************************************************
+    void clear()
+    {
+      base::clear_all();
+    }
+
+    //*********************************************************************
+    /// Counts the number of elements that contain the key specified.
+    ///\param key The key to search for.
+    ///\return 1 if element was found, 0 otherwise.
+    //*********************************************************************
+    size_type count(key_parameter_t key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type count(const K& key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns two iterators with bounding (lower bound, upper bound) the key
+    /// provided
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      return TYPHOON_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    TYPHOON_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return TYPHOON_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns two const iterators with bounding (lower bound, upper bound)
+    /// the key provided.
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      return TYPHOON_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    TYPHOON_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return TYPHOON_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the value at the specified position.
+    ///\return An iterator to the element that followed the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      return iterator(*this, base::erase_position(position.pos));
+    }
+
+    //*************************************************************************
+    // Erase the key specified.
+    //*************************************************************************
+    size_type erase(key_parameter_t key)
+    {
+      return base::erase_key(key) ? 1U : 0U;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type erase(K&& key)
+    {
+      return base::erase_key(key) ? 1U : 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    /// Erasing may move the elements after the one erased, so the range is
+    /// counted first.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      difference_type n = tpn::distance(first, last);
+      position        pos = first.pos;
+
+      while (n-- != 0)
+      {
+        pos = base::erase_position(pos);
+      }
+
+      return iterator(*this, pos);
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return iterator(*this, base::find_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& k)
+    {
+      return iterator(*this, base::find_position(k));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return const_iterator(*this, base::find_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& k) const
+    {
+      return const_iterator(*this, base::find_position(k));
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      TYPHOON_OR_STD::pair<position, bool> result = base::insert_unique(value.first, private_btree::create_copy<value_type>(value));
+
+      TYPHOON_ASSERT(result.first.p_leaf != TYPHOON_NULLPTR, TYPHOON_ERROR(btree_map_full));
+
+      return TYPHOON_OR_STD::make_pair(iterator(*this, result.first), result.second);
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      TYPHOON_OR_STD::pair<position, bool> result = base::insert_unique(value.first, private_btree::create_move<value_type>(value));
+
+      TYPHOON_ASSERT(result.first.p_leaf != TYPHOON_NULLPTR, TYPHOON_ERROR(btree_map_full));
+
+      return TYPHOON_OR_STD::make_pair(iterator(*this, result.first), result.second);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// The position hint is not used, as the search from the root is only
+    /// a few node visits.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(tpn::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values that is already sorted by key, with no
+    /// repeated keys.
+    /// If the map is empty the tree is built bottom up in one pass, with
+    /// evenly filled leaves, rather than by splitting nodes as it grows.
+    /// Otherwise the values are inserted one at a time.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the map does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(tpn::sorted_unique_t, TIterator first, TIterator last)
+    {
+      if (this->empty())
+      {
+        const size_t n = static_cast<size_t>(tpn::distance(first, last));
+
+        TYPHOON_ASSERT(n <= capacity(), TYPHOON_ERROR(btree_map_full));
+
+        base::build_sorted(first, (n <= capacity()) ? n : capacity());
+      }
+      else
+      {
+        insert(first, last);
+      }
+    }
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go before the key provided or end()
+    /// if all keys are considered to go before the key provided.
+    ///\return An iterator pointing to the element not before key or end()
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      return iterator(*this, base::lower_bound_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return iterator(*this, base::lower_bound_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go before the key provided
+    /// or end() if all keys are considered to go before the key provided.
+    ///\return An const_iterator pointing to the element not before key or end()
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return const_iterator(*this, base::lower_bound_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_iterator(*this, base::lower_bound_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is considered to go after the key provided or end()
+    /// if none are found.
+    ///\return An iterator pointing to the element after key or end()
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      return iterator(*this, base::upper_bound_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return iterator(*this, base::upper_bound_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is considered to go after the key provided or end()
+    /// if none are found.
+    ///\return An const_iterator pointing to the element after key or end()
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return const_iterator(*this, base::upper_bound_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_iterator(*this, base::upper_bound_position(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// The source is already in order, so the tree is built bottom up.
+    //*************************************************************************
+    ibtree_map& operator = (const ibtree_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(tpn::sorted_unique_t(), rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (ibtree_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(tpn::sorted_unique_t(), tpn::move_iterator<iterator>(rhs.begin()), tpn::move_iterator<iterator>(rhs.end()));
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return this->kcompare;
+    }
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+    //*************************************************************************
+    /// Check if the map contains the key.
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return find(key) != end();
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& k) const
+    {
+      return find(k) != end();
+    }
+#endif
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_map(tpn::ipool& leaf_pool, tpn::ipool& branch_pool, size_t max_size_)
+      : base(leaf_pool, branch_pool, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibtree_map(const ibtree_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(TYPHOON_POLYMORPHIC_BTREE_MAP) || defined(TYPHOON_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_map()
+    {
+    }
+#else
+  protected:
+    ~ibtree_map()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated btree_map implementation that uses fixed size node pools.
+  /// The pools are sized for the most nodes that MAX_SIZE elements can
+  /// need, with every node other than the root half full.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = tpn::less<TKey> >
+  class btree_map : public tpn::ibtree_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef tpn::ibtree_map<TKey, TValue, TCompare> base;
+
+  public:
+
+    static TYPHOON_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_map()
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+      base::insert(tpn::sorted_unique_t(), other.cbegin(), other.cend());
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_map(btree_map&& other)
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+      base::insert(tpn::sorted_unique_t(), tpn::move_iterator<typename base::iterator>(other.begin()), tpn::move_iterator<typename base::iterator>(other.end()));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first, TIterator last)
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+      base::insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted by key,
+    /// with no repeated keys.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(tpn::sorted_unique_t, TIterator first, TIterator last)
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+      base::insert(tpn::sorted_unique_t(), first, last);
+    }
+
+#if TYPHOON_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<typename base::value_type> init)
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+      base::insert(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator = (const btree_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_map& operator = (btree_map&& rhs)
+    {
+      base::operator=(tpn::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    typedef typename base::template node_count<MAX_SIZE_> node_count;
+
+    /// The pool of leaves, which hold the elements.
+    tpn::pool<typename base::leaf_node, node_count::Leaves> leaf_pool;
+
+    /// The pool of branches, which hold the keys that guide a search.
+    tpn::pool<typename base::branch_node, node_count::Branches> branch_pool;
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if TYPHOON_USING_CPP17 && TYPHOON_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  btree_map(TPairs...) -> btree_map<typename tpn::nth_type_t<0, TPairs...>::first_type,
+                                    typename tpn::nth_type_t<0, TPairs...>::second_type,
+                                    sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if TYPHOON_USING_CPP11 && TYPHOON_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TMapped, typename TKeyCompare = tpn::less<TKey>, typename... TPairs>
+  constexpr auto make_btree_map(TPairs&&... pairs) -> tpn::btree_map<TKey, TMapped, sizeof...(TPairs), TKeyCompare>
+  {
+    return { {tpn::forward<TPairs>(pairs)...} };
+  }
+#endif
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && tpn::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first map is lexicographically less than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator <(const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return tpn::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //*************************************************************************
+  /// Greater than operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first map is lexicographically greater than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator >(const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //*************************************************************************
+  /// Less than or equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first map is lexicographically less than or equal
+  /// to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator <=(const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //*************************************************************************
+  /// Greater than or equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first map is lexicographically greater than or
+  /// equal to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator >=(const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const tpn::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,1076 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2021 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_BTREE_SET_HPP
+#define TYPHOON_BTREE_SET_HPP
+
+#include "platform.hpp"
+#include "algorithm.hpp"
+#include "iterator.hpp"
+#include "functional.hpp"
+#include "pool.hpp"
+#include "exception.hpp"
+#include "error_handler.hpp"
+#include "nullptr.hpp"
+#include "type_traits.hpp"
+#include "nth_type.hpp"
+#include "parameter_type.hpp"
+#include "utility.hpp"
+#include "placement_new.hpp"
+#include "initializer_list.hpp"
+
+#include "private/btree_base.hpp"
+#include "private/comparator_is_transparent.hpp"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup btree_set btree_set
+/// A set with the capacity defined at compile time, held in a B+ tree.
+/// Each node holds many keys in one contiguous block, so a lookup visits a
+/// few cache lines per level rather than one per comparison, and ordered
+/// iteration walks the values in place along the linked leaves.
+/// Nodes come from fixed capacity pools sized for the worst case.
+/// Inserting or erasing an element may move others within or between
+/// nodes, which invalidates iterators to them.
+///\ingroup containers
+//*****************************************************************************
+
+namespace tpn
+{
+  //***************************************************************************
+  /// Exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_exception : public tpn::exception
+  {
+  public:
+
+    btree_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : tpn::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_full : public tpn::btree_set_exception
+  {
+  public:
+
+    btree_set_full(string_type file_name_, numeric_type line_number_)
+      : tpn::btree_set_exception(TYPHOON_ERROR_TEXT("btree_set:full", TYPHOON_BTREE_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A templated base for all tpn::btree_set types.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = tpn::less<TKey> >
+  class ibtree_set : public tpn::btree_base<TKey, TKey, private_btree::key_of_value<TKey>, TKeyCompare, false>
+  {
+  private:
+
+    typedef tpn::btree_base<TKey, TKey, private_btree::key_of_value<TKey>, TKeyCompare, false> base;
+
+    typedef typename base::position position;
+
+  public:
+
+    typedef TKey              key_type;
+    typedef TKey              value_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if TYPHOON_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    using base::size;
+    using base::full;
+    using base::capacity;
+
+  protected:
+
+    /// Defines the key value parameter type
+    typedef typename tpn::parameter_type<TKey>::type key_parameter_t;
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public tpn::iterator<TYPHOON_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class ibtree_set;
+      friend class const_iterator;
+
+      iterator()
+        : p_set(TYPHOON_NULLPTR)
+      {
+        pos.p_leaf = TYPHOON_NULLPTR;
+        pos.index  = 0U;
+      }
+
+      iterator(ibtree_set& set, position pos_)
+        : p_set(&set)
+        , pos(pos_)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        pos = base::next_position(pos);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        pos = base::next_position(pos);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        pos = p_set->previous_position(pos);
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        pos = p_set->previous_position(pos);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return pos.p_leaf->values()[pos.index];
+      }
+
+      const_pointer operator &() const
+      {
+        return &(pos.p_leaf->values()[pos.index]);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &(pos.p_leaf->values()[pos.index]);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_set == rhs.p_set) && (lhs.pos.p_leaf == rhs.pos.p_leaf) && (lhs.pos.index == rhs.pos.index);
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      // Pointer to set associated with this iterator
+      ibtree_set* p_set;
+
+      // The leaf and slot of the current element
+      position pos;
+    };
+
+    friend class iterator;
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public tpn::iterator<TYPHOON_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree_set;
+
+      const_iterator()
+        : p_set(TYPHOON_NULLPTR)
+      {
+        pos.p_leaf = TYPHOON_NULLPTR;
+        pos.index  = 0U;
+      }
+
+      const_iterator(const ibtree_set& set, position pos_)
+        : p_set(&set)
+        , pos(pos_)
+      {
+      }
+
+      const_iterator(const typename ibtree_set::iterator& other)
+        : p_set(other.p_set)
+        , pos(other.pos)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        pos = base::next_position(pos);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        pos = base::next_position(pos);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        pos = p_set->previous_position(pos);
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        pos = p_set->previous_position(pos);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return pos.p_leaf->values()[pos.index];
+      }
+
+      const_pointer operator &() const
+      {
+        return &(pos.p_leaf->values()[pos.index]);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &(pos.p_leaf->values()[pos.index]);
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_set == rhs.p_set) && (lhs.pos.p_leaf == rhs.pos.p_leaf) && (lhs.pos.index == rhs.pos.index);
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      // Pointer to set associated with this iterator
+      const ibtree_set* p_set;
+
+      // The leaf and slot of the current element
+      position pos;
+    };
+
+    friend class const_iterator;
+
+    typedef typename tpn::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef TYPHOON_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef TYPHOON_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, base::first_position());
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, base::first_position());
+    }
+
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, base::end_position());
+    }
+
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, base::end_position());
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, base::first_position());
+    }
+
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, base::end_position());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*********************************************************************
+    /// Assigns values to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Assigns values that are already sorted by key, with no repeated keys.
+    /// The tree is built bottom up with evenly filled nodes.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(tpn::sorted_unique_t, TIterator first, TIterator last)
+    {
+      clear();
+      insert(tpn::sorted_unique_t(), first, last);
+    }
+
+    //*************************************************************************
+    /// Clears the set.
+    //*************************************************************************
+    void clear()
+    {
+      base::clear_all();
+    }
+
+    //*********************************************************************
+    /// Counts the number of elements that contain the key specified.
+    ///\param key The key to search for.
+    ///\return 1 if element was found, 0 otherwise.
+    //*********************************************************************
+    size_type count(key_parameter_t key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type count(const K& key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns two iterators with bounding (lower bound, upper bound) the key
+    /// provided
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      return TYPHOON_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    TYPHOON_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return TYPHOON_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns two const iterators with bounding (lower bound, upper bound)
+    /// the key provided.
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      return TYPHOON_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    TYPHOON_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return TYPHOON_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the value at the specified position.
+    ///\return An iterator to the element that followed the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      return iterator(*this, base::erase_position(position.pos));
+    }
+
+    //*************************************************************************
+    // Erase the key specified.
+    //*************************************************************************
+    size_type erase(key_parameter_t key)
+    {
+      return base::erase_key(key) ? 1U : 0U;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type erase(K&& key)
+    {
+      return base::erase_key(key) ? 1U : 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    /// Erasing may move the elements after the one erased, so the range is
+    /// counted first.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      difference_type n = tpn::distance(first, last);
+      position        pos = first.pos;
+
+      while (n-- != 0)
+      {
+        pos = base::erase_position(pos);
+      }
+
+      return iterator(*this, pos);
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return iterator(*this, base::find_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& k)
+    {
+      return iterator(*this, base::find_position(k));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return const_iterator(*this, base::find_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& k) const
+    {
+      return const_iterator(*this, base::find_position(k));
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      TYPHOON_OR_STD::pair<position, bool> result = base::insert_unique(value, private_btree::create_copy<value_type>(value));
+
+      TYPHOON_ASSERT(result.first.p_leaf != TYPHOON_NULLPTR, TYPHOON_ERROR(btree_set_full));
+
+      return TYPHOON_OR_STD::make_pair(iterator(*this, result.first), result.second);
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      TYPHOON_OR_STD::pair<position, bool> result = base::insert_unique(value, private_btree::create_move<value_type>(value));
+
+      TYPHOON_ASSERT(result.first.p_leaf != TYPHOON_NULLPTR, TYPHOON_ERROR(btree_set_full));
+
+      return TYPHOON_OR_STD::make_pair(iterator(*this, result.first), result.second);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// The position hint is not used, as the search from the root is only
+    /// a few node visits.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(tpn::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values that is already sorted by key, with no
+    /// repeated keys.
+    /// If the set is empty the tree is built bottom up in one pass, with
+    /// evenly filled leaves, rather than by splitting nodes as it grows.
+    /// Otherwise the values are inserted one at a time.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(tpn::sorted_unique_t, TIterator first, TIterator last)
+    {
+      if (this->empty())
+      {
+        const size_t n = static_cast<size_t>(tpn::distance(first, last));
+
+        TYPHOON_ASSERT(n <= capacity(), TYPHOON_ERROR(btree_set_full));
+
+        base::build_sorted(first, (n <= capacity()) ? n : capacity());
+      }
+      else
+      {
+        insert(first, last);
+      }
+    }
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go before the key provided or end()
+    /// if all keys are considered to go before the key provided.
+    ///\return An iterator pointing to the element not before key or end()
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      return iterator(*this, base::lower_bound_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return iterator(*this, base::lower_bound_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go before the key provided
+    /// or end() if all keys are considered to go before the key provided.
+    ///\return An const_iterator pointing to the element not before key or end()
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return const_iterator(*this, base::lower_bound_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_iterator(*this, base::lower_bound_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is considered to go after the key provided or end()
+    /// if none are found.
+    ///\return An iterator pointing to the element after key or end()
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      return iterator(*this, base::upper_bound_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return iterator(*this, base::upper_bound_position(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is considered to go after the key provided or end()
+    /// if none are found.
+    ///\return An const_iterator pointing to the element after key or end()
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return const_iterator(*this, base::upper_bound_position(key));
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_iterator(*this, base::upper_bound_position(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// The source is already in order, so the tree is built bottom up.
+    //*************************************************************************
+    ibtree_set& operator = (const ibtree_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(tpn::sorted_unique_t(), rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_set& operator = (ibtree_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(tpn::sorted_unique_t(), tpn::move_iterator<iterator>(rhs.begin()), tpn::move_iterator<iterator>(rhs.end()));
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return this->kcompare;
+    }
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return this->kcompare;
+    }
+
+    //*************************************************************************
+    /// Check if the set contains the key.
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return find(key) != end();
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, tpn::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& k) const
+    {
+      return find(k) != end();
+    }
+#endif
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_set(tpn::ipool& leaf_pool, tpn::ipool& branch_pool, size_t max_size_)
+      : base(leaf_pool, branch_pool, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibtree_set(const ibtree_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(TYPHOON_POLYMORPHIC_BTREE_SET) || defined(TYPHOON_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_set()
+    {
+    }
+#else
+  protected:
+    ~ibtree_set()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated btree_set implementation that uses fixed size node pools.
+  /// The pools are sized for the most nodes that MAX_SIZE elements can
+  /// need, with every node other than the root half full.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare = tpn::less<TKey> >
+  class btree_set : public tpn::ibtree_set<TKey, TCompare>
+  {
+  private:
+
+    typedef tpn::ibtree_set<TKey, TCompare> base;
+
+  public:
+
+    static TYPHOON_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_set()
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_set(const btree_set& other)
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+      base::insert(tpn::sorted_unique_t(), other.cbegin(), other.cend());
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_set(btree_set&& other)
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+      base::insert(tpn::sorted_unique_t(), tpn::move_iterator<typename base::iterator>(other.begin()), tpn::move_iterator<typename base::iterator>(other.end()));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set(TIterator first, TIterator last)
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+      base::insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted by key,
+    /// with no repeated keys.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set(tpn::sorted_unique_t, TIterator first, TIterator last)
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+      base::insert(tpn::sorted_unique_t(), first, last);
+    }
+
+#if TYPHOON_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_set(std::initializer_list<typename base::value_type> init)
+      : base(leaf_pool, branch_pool, MAX_SIZE)
+    {
+      base::insert(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_set()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_set& operator = (const btree_set& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_set& operator = (btree_set&& rhs)
+    {
+      base::operator=(tpn::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    typedef typename base::template node_count<MAX_SIZE_> node_count;
+
+    /// The pool of leaves, which hold the elements.
+    tpn::pool<typename base::leaf_node, node_count::Leaves> leaf_pool;
+
+    /// The pool of branches, which hold the keys that guide a search.
+    tpn::pool<typename base::branch_node, node_count::Branches> branch_pool;
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if TYPHOON_USING_CPP17 && TYPHOON_HAS_INITIALIZER_LIST
+  template <typename T, typename... Ts>
+  btree_set(T, Ts...) -> btree_set<T, 1U + sizeof...(Ts)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if TYPHOON_USING_CPP11 && TYPHOON_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TKeyCompare = tpn::less<TKey>, typename... T>
+  constexpr auto make_btree_set(T&&... keys) -> tpn::btree_set<TKey, sizeof...(T), TKeyCompare>
+  {
+    return { {tpn::forward<T>(keys)...} };
+  }
+#endif
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator ==(const tpn::ibtree_set<TKey, TKeyCompare>& lhs, const tpn::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && tpn::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator !=(const tpn::ibtree_set<TKey, TKeyCompare>& lhs, const tpn::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first set is lexicographically less than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator <(const tpn::ibtree_set<TKey, TKeyCompare>& lhs, const tpn::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return tpn::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //*************************************************************************
+  /// Greater than operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first set is lexicographically greater than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator >(const tpn::ibtree_set<TKey, TKeyCompare>& lhs, const tpn::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //*************************************************************************
+  /// Less than or equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first set is lexicographically less than or equal
+  /// to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator <=(const tpn::ibtree_set<TKey, TKeyCompare>& lhs, const tpn::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //*************************************************************************
+  /// Greater than or equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first set is lexicographically greater than or
+  /// equal to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator >=(const tpn::ibtree_set<TKey, TKeyCompare>& lhs, const tpn::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+}
+
+#endif
@@ -35,6 +35,7 @@ SOFTWARE.
 #include "function.hpp"
 #include "static_assert.hpp"
 #include "timer.hpp"
+#include "timer_list.hpp"
 #include "atomic.hpp"
 #include "error_handler.hpp"
 #include "placement_new.hpp"
@@ -191,191 +192,13 @@ namespace tpn
     callback_timer_data& operator =(const callback_timer_data& other);
   };
 
-  namespace private_callback_timer
-  {
-    //*************************************************************************
-    /// A specialised intrusive linked list for timer data.
-    //*************************************************************************
-    class list
-    {
-    public:
-
-      //*******************************
-      list(tpn::callback_timer_data* ptimers_)
-        : head(tpn::timer::id::NO_TIMER),
-          tail(tpn::timer::id::NO_TIMER),
-          current(tpn::timer::id::NO_TIMER),
-          ptimers(ptimers_)
-      {
-      }
-
-      //*******************************
-      bool empty() const
-      {
-        return head == tpn::timer::id::NO_TIMER;
-      }
-
-      //*******************************
-      // Inserts the timer at the correct delta position
-      //*******************************
-      void insert(tpn::timer::id::type id_)
-      {
-        tpn::callback_timer_data& timer = ptimers[id_];
-
-        if (head == tpn::timer::id::NO_TIMER)
-        {
-          // No entries yet.
-          head = id_;
-          tail = id_;
-          timer.previous = tpn::timer::id::NO_TIMER;
-          timer.next     = tpn::timer::id::NO_TIMER;
-        }
-        else
-        {
-          // We already have entries.
-          tpn::timer::id::type test_id = begin();
-
-          while (test_id != tpn::timer::id::NO_TIMER)
-          {
-            tpn::callback_timer_data& test = ptimers[test_id];
-
-            // Find the correct place to insert.
-            if (timer.delta <= test.delta)
-            {
-              if (test.id == head)
-              {
-                head = timer.id;
-              }
-
-              // Insert before test.
-              timer.previous = test.previous;
-              test.previous  = timer.id;
-              timer.next     = test.id;
-
-              // Adjust the next delta to compensate.
-              test.delta -= timer.delta;
-
-              if (timer.previous != tpn::timer::id::NO_TIMER)
-              {
-                ptimers[timer.previous].next = timer.id;
-              }
-              break;
-            }
-            else
-            {
-              timer.delta -= test.delta;
-            }
-
-            test_id = next(test_id);
-          }
-
-          // Reached the end?
-          if (test_id == tpn::timer::id::NO_TIMER)
-          {
-            // Tag on to the tail.
-            ptimers[tail].next = timer.id;
-            timer.previous     = tail;
-            timer.next         = tpn::timer::id::NO_TIMER;
-            tail               = timer.id;
-          }
-        }
-      }
-
-      //*******************************
-      void remove(tpn::timer::id::type id_, bool has_expired)
-      {
-        tpn::callback_timer_data& timer = ptimers[id_];
-
-        if (head == id_)
-        {
-          head = timer.next;
-        }
-        else
-        {
-          ptimers[timer.previous].next = timer.next;
-        }
-
-        if (tail == id_)
-        {
-          tail = timer.previous;
-        }
-        else
-        {
-          ptimers[timer.next].previous = timer.previous;
-        }
-
-        if (!has_expired)
-        {
-          // Adjust the next delta.
-          if (timer.next != tpn::timer::id::NO_TIMER)
-          {
-            ptimers[timer.next].delta += timer.delta;
-          }
-        }
-
-        timer.previous = tpn::timer::id::NO_TIMER;
-        timer.next     = tpn::timer::id::NO_TIMER;
-        timer.delta    = tpn::timer::state::INACTIVE;
-      }
-
-      //*******************************
-      tpn::callback_timer_data& front()
-      {
-        return ptimers[head];
-      }
-
-      //*******************************
-      tpn::timer::id::type begin()
-      {
-        current = head;
-        return current;
-      }
-
-      //*******************************
-      tpn::timer::id::type previous(tpn::timer::id::type last)
-      {
-        current = ptimers[last].previous;
-        return current;
-      }
-
-      //*******************************
-      tpn::timer::id::type next(tpn::timer::id::type last)
-      {
-        current = ptimers[last].next;
-        return current;
-      }
-
-      //*******************************
-      void clear()
-      {
-        tpn::timer::id::type id = begin();
-
-        while (id != tpn::timer::id::NO_TIMER)
-        {
-          tpn::callback_timer_data& timer = ptimers[id];
-          id = next(id);
-          timer.next = tpn::timer::id::NO_TIMER;
-        }
-
-        head    = tpn::timer::id::NO_TIMER;
-        tail    = tpn::timer::id::NO_TIMER;
-        current = tpn::timer::id::NO_TIMER;
-      }
-
-    private:
-
-      tpn::timer::id::type head;
-      tpn::timer::id::type tail;
-      tpn::timer::id::type current;
-
-      tpn::callback_timer_data* const ptimers;
-    };
-  }
-
   //***************************************************************************
-  /// Interface for callback timer
+  /// Interface for callback timer.
+  /// TTimerList is the active timer list policy.
+  /// See tpn::timer_delta_list and tpn::timer_wheel.
   //***************************************************************************
-  class icallback_timer
+  template <typename TTimerList>
+  class ibasic_callback_timer
   {
   public:
 
@@ -555,55 +378,41 @@ namespace tpn
       {
         if (TYPHOON_TIMER_UPDATES_ENABLED)
         {
-          // We have something to do?
-          bool has_active = !active_list.empty();
+          tpn::timer::id::type id = active_list.next_expired(count);
 
-          if (has_active)
+          while (id != tpn::timer::id::NO_TIMER)
           {
-            while (has_active && (count >= active_list.front().delta))
-            {
-              tpn::callback_timer_data& timer = active_list.front();
-
-              count -= timer.delta;
+            tpn::callback_timer_data& timer = timer_array[id];
 
-              active_list.remove(timer.id, true);
+            if (timer.repeating)
+            {
+              // Reinsert the timer.
+              timer.delta = timer.period;
+              active_list.insert(timer.id);
+            }
 
-              if (timer.repeating)
+            if (timer.p_callback != TYPHOON_NULLPTR)
+            {
+              if (timer.cbk_type == callback_timer_data::C_CALLBACK)
               {
-                // Reinsert the timer.
-                timer.delta = timer.period;
-                active_list.insert(timer.id);
+                // Call the C callback.
+                reinterpret_cast<void(*)()>(timer.p_callback)();
               }
-
-              if (timer.p_callback != TYPHOON_NULLPTR)
+              else if(timer.cbk_type == callback_timer_data::IFUNCTION)
               {
-                if (timer.cbk_type == callback_timer_data::C_CALLBACK)
-                {
-                  // Call the C callback.
-                  reinterpret_cast<void(*)()>(timer.p_callback)();
-                }
-                else if(timer.cbk_type == callback_timer_data::IFUNCTION)
-                {
-                  // Call the function wrapper callback.
-                  (*reinterpret_cast<tpn::ifunction<void>*>(timer.p_callback))();
-                }
+                // Call the function wrapper callback.
+                (*reinterpret_cast<tpn::ifunction<void>*>(timer.p_callback))();
+              }
 #if TYPHOON_USING_CPP11
-                else if(timer.cbk_type == callback_timer_data::DELEGATE)
-                {
-                    // Call the delegate callback.
-                    (*reinterpret_cast<callback_type*>(timer.p_callback))();
-                }
-#endif
+              else if(timer.cbk_type == callback_timer_data::DELEGATE)
+              {
+                  // Call the delegate callback.
+                  (*reinterpret_cast<callback_type*>(timer.p_callback))();
               }
-
-              has_active = !active_list.empty();
+#endif
             }
 
-            if (has_active)
-            {
-              // Subtract any remainder from the next due timeout.
-              active_list.front().delta -= count;
-            }
+            id = active_list.next_expired(count);
           }
 
           return true;
@@ -711,7 +520,7 @@ namespace tpn
     //*******************************************
     /// Constructor.
     //*******************************************
-    icallback_timer(callback_timer_data* const timer_array_, const uint_least8_t  MAX_TIMERS_)
+    ibasic_callback_timer(callback_timer_data* const timer_array_, const uint_least8_t  MAX_TIMERS_)
       : timer_array(timer_array_),
         active_list(timer_array_),
         enabled(false),
@@ -729,7 +538,7 @@ namespace tpn
     callback_timer_data* const timer_array;
 
     // The list of active timers.
-    private_callback_timer::list active_list;
+    typename TTimerList::template list<tpn::callback_timer_data> active_list;
 
     volatile bool enabled;
 #if defined(TYPHOON_CALLBACK_TIMER_USE_ATOMIC_LOCK)
@@ -753,11 +562,16 @@ namespace tpn
     const uint_least8_t MAX_TIMERS;
   };
 
+  //***************************************************************************
+  /// Interface for callback timer using the delta list.
+  //***************************************************************************
+  typedef tpn::ibasic_callback_timer<tpn::timer_delta_list> icallback_timer;
+
   //***************************************************************************
   /// The callback timer
   //***************************************************************************
-  template <const uint_least8_t MAX_TIMERS_>
-  class callback_timer : public tpn::icallback_timer
+  template <const uint_least8_t MAX_TIMERS_, typename TTimerList = tpn::timer_delta_list>
+  class callback_timer : public tpn::ibasic_callback_timer<TTimerList>
   {
   public:
 
@@ -767,7 +581,7 @@ namespace tpn
     /// Constructor.
     //*******************************************
     callback_timer()
-      : icallback_timer(timer_array, MAX_TIMERS_)
+      : tpn::ibasic_callback_timer<TTimerList>(timer_array, MAX_TIMERS_)
     {
     }
 
@@ -35,6 +35,7 @@ SOFTWARE.
 #include "function.hpp"
 #include "static_assert.hpp"
 #include "timer.hpp"
+#include "timer_list.hpp"
 #include "error_handler.hpp"
 #include "placement_new.hpp"
 #include "delegate.hpp"
@@ -46,7 +47,7 @@ namespace tpn
   //***************************************************************************
   /// Interface for callback timer
   //***************************************************************************
-  template <typename TSemaphore>
+  template <typename TSemaphore, typename TTimerList = tpn::timer_delta_list>
   class icallback_timer_atomic
   {
   public:
@@ -161,40 +162,26 @@ namespace tpn
       {
         if (process_semaphore == 0U)
         {
-          // We have something to do?
-          bool has_active = !active_list.empty();
+          tpn::timer::id::type id = active_list.next_expired(count);
 
-          if (has_active)
+          while (id != tpn::timer::id::NO_TIMER)
           {
-            while (has_active && (count >= active_list.front().delta))
-            {
-              timer_data& timer = active_list.front();
-
-              count -= timer.delta;
-
-              active_list.remove(timer.id, true);
-
-              if (timer.callback.is_valid())
-              {
-                // Call the delegate callback.
-                timer.callback();
-              }
+            timer_data& timer = timer_array[id];
 
-              if (timer.repeating)
-              {
-                // Reinsert the timer.
-                timer.delta = timer.period;
-                active_list.insert(timer.id);
-              }
-
-              has_active = !active_list.empty();
+            if (timer.callback.is_valid())
+            {
+              // Call the delegate callback.
+              timer.callback();
             }
 
-            if (has_active)
+            if (timer.repeating)
             {
-              // Subtract any remainder from the next due timeout.
-              active_list.front().delta -= count;
+              // Reinsert the timer.
+              timer.delta = timer.period;
+              active_list.insert(timer.id);
             }
+
+            id = active_list.next_expired(count);
           }
 
           return true;
@@ -378,189 +365,11 @@ namespace tpn
 
   private:
 
-    //*************************************************************************
-    /// A specialised intrusive linked list for timer data.
-    //*************************************************************************
-    class timer_list
-    {
-    public:
-
-      //*******************************
-      timer_list(timer_data* ptimers_)
-        : head(tpn::timer::id::NO_TIMER)
-        , tail(tpn::timer::id::NO_TIMER)
-        , current(tpn::timer::id::NO_TIMER)
-        , ptimers(ptimers_)
-      {
-      }
-
-      //*******************************
-      bool empty() const
-      {
-        return head == tpn::timer::id::NO_TIMER;
-      }
-
-      //*******************************
-      // Inserts the timer at the correct delta position
-      //*******************************
-      void insert(tpn::timer::id::type id_)
-      {
-        timer_data& timer = ptimers[id_];
-
-        if (head == tpn::timer::id::NO_TIMER)
-        {
-          // No entries yet.
-          head = id_;
-          tail = id_;
-          timer.previous = tpn::timer::id::NO_TIMER;
-          timer.next = tpn::timer::id::NO_TIMER;
-        }
-        else
-        {
-          // We already have entries.
-          tpn::timer::id::type test_id = begin();
-
-          while (test_id != tpn::timer::id::NO_TIMER)
-          {
-            timer_data& test = ptimers[test_id];
-
-            // Find the correct place to insert.
-            if (timer.delta <= test.delta)
-            {
-              if (test.id == head)
-              {
-                head = timer.id;
-              }
-
-              // Insert before test.
-              timer.previous = test.previous;
-              test.previous = timer.id;
-              timer.next = test.id;
-
-              // Adjust the next delta to compensate.
-              test.delta -= timer.delta;
-
-              if (timer.previous != tpn::timer::id::NO_TIMER)
-              {
-                ptimers[timer.previous].next = timer.id;
-              }
-              break;
-            }
-            else
-            {
-              timer.delta -= test.delta;
-            }
-
-            test_id = next(test_id);
-          }
-
-          // Reached the end?
-          if (test_id == tpn::timer::id::NO_TIMER)
-          {
-            // Tag on to the tail.
-            ptimers[tail].next = timer.id;
-            timer.previous = tail;
-            timer.next = tpn::timer::id::NO_TIMER;
-            tail = timer.id;
-          }
-        }
-      }
-
-      //*******************************
-      void remove(tpn::timer::id::type id_, bool has_expired)
-      {
-        timer_data& timer = ptimers[id_];
-
-        if (head == id_)
-        {
-          head = timer.next;
-        }
-        else
-        {
-          ptimers[timer.previous].next = timer.next;
-        }
-
-        if (tail == id_)
-        {
-          tail = timer.previous;
-        }
-        else
-        {
-          ptimers[timer.next].previous = timer.previous;
-        }
-
-        if (!has_expired)
-        {
-          // Adjust the next delta.
-          if (timer.next != tpn::timer::id::NO_TIMER)
-          {
-            ptimers[timer.next].delta += timer.delta;
-          }
-        }
-
-        timer.previous = tpn::timer::id::NO_TIMER;
-        timer.next = tpn::timer::id::NO_TIMER;
-        timer.delta = tpn::timer::state::INACTIVE;
-      }
-
-      //*******************************
-      timer_data& front()
-      {
-        return ptimers[head];
-      }
-
-      //*******************************
-      tpn::timer::id::type begin()
-      {
-        current = head;
-        return current;
-      }
-
-      //*******************************
-      tpn::timer::id::type previous(tpn::timer::id::type last)
-      {
-        current = ptimers[last].previous;
-        return current;
-      }
-
-      //*******************************
-      tpn::timer::id::type next(tpn::timer::id::type last)
-      {
-        current = ptimers[last].next;
-        return current;
-      }
-
-      //*******************************
-      void clear()
-      {
-        tpn::timer::id::type id = begin();
-
-        while (id != tpn::timer::id::NO_TIMER)
-        {
-          timer_data& timer = ptimers[id];
-          id = next(id);
-          timer.next = tpn::timer::id::NO_TIMER;
-        }
-
-        head = tpn::timer::id::NO_TIMER;
-        tail = tpn::timer::id::NO_TIMER;
-        current = tpn::timer::id::NO_TIMER;
-      }
-
-    private:
-
-      tpn::timer::id::type head;
-      tpn::timer::id::type tail;
-      tpn::timer::id::type current;
-
-      timer_data* const ptimers;
-    };
-
     // The array of timer data structures.
     timer_data* const timer_array;
 
     // The list of active timers.
-    timer_list active_list;
+    typename TTimerList::template list<timer_data> active_list;
 
     volatile bool enabled;
     volatile TSemaphore process_semaphore;
@@ -574,8 +383,8 @@ namespace tpn
   //***************************************************************************
   /// The callback timer
   //***************************************************************************
-  template <uint_least8_t MAX_TIMERS_, typename TSemaphore>
-  class callback_timer_atomic : public tpn::icallback_timer_atomic<TSemaphore>
+  template <uint_least8_t MAX_TIMERS_, typename TSemaphore, typename TTimerList = tpn::timer_delta_list>
+  class callback_timer_atomic : public tpn::icallback_timer_atomic<TSemaphore, TTimerList>
   {
   public:
 
@@ -585,13 +394,13 @@ namespace tpn
     /// Constructor.
     //*******************************************
     callback_timer_atomic()
-      : icallback_timer_atomic<TSemaphore>(timer_array, MAX_TIMERS_)
+      : icallback_timer_atomic<TSemaphore, TTimerList>(timer_array, MAX_TIMERS_)
     {
     }
 
   private:
 
-    typename tpn::icallback_timer_atomic<TSemaphore>::timer_data timer_array[MAX_TIMERS_];
+    typename tpn::icallback_timer_atomic<TSemaphore, TTimerList>::timer_data timer_array[MAX_TIMERS_];
   };
 }
 
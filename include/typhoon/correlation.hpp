@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.hpp"
 #include "functional.hpp"
 #include "type_traits.hpp"
+#include "span.hpp"
+#include "private/statistics.hpp"
 
 #include <math.h>
 #include <stdint.h>
@@ -118,12 +120,33 @@ namespace tpn
     //*********************************
     void add(TInput value1, TInput value2)
     {
-      inner_product   += TCalc(value1 * value2);
-      sum_of_squares1 += TCalc(value1 * value1);
-      sum_of_squares2 += TCalc(value2 * value2);
-      sum1            += TCalc(value1);
-      sum2            += TCalc(value2);
-      ++counter;
+      accumulator.add(value1, value2);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Add contiguous blocks of paired values.
+    /// Adds min(values1.size(), values2.size()) pairs.
+    /// Floating point values are summed a vector at a time.
+    //*********************************
+    void add(tpn::span<const TInput> values1, tpn::span<const TInput> values2)
+    {
+      const size_t n = (values1.size() < values2.size()) ? values1.size() : values2.size();
+
+      if (n != 0U)
+      {
+        accumulator.add(values1.data(), values2.data(), n);
+        recalculate = true;
+      }
+    }
+
+    //*********************************
+    /// Add the values from another correlation,
+    /// as if they had been added to this one.
+    //*********************************
+    void merge(const correlation& other)
+    {
+      accumulator.merge(other.accumulator);
       recalculate = true;
     }
 
@@ -193,7 +216,7 @@ namespace tpn
     //*********************************
     size_t count() const
     {
-      return size_t(counter);
+      return size_t(accumulator.counter);
     }
 
     //*********************************
@@ -201,12 +224,7 @@ namespace tpn
     //*********************************
     void clear()
     {
-      inner_product     = calc_t(0);
-      sum_of_squares1   = calc_t(0);
-      sum_of_squares2   = calc_t(0);
-      sum1              = calc_t(0);
-      sum2              = calc_t(0);
-      counter           = 0U;
+      accumulator.clear();
       covariance_value  = 0.0;
       correlation_value = 0.0;
       recalculate       = true;
@@ -224,16 +242,10 @@ namespace tpn
         correlation_value = 0.0;
         covariance_value  = 0.0;
 
-        if (counter != 0)
+        if (accumulator.counter != 0)
         {
-          double n = double(counter);
-          double adjustment = 1.0 / (n * (n - Adjustment));
-
-          double square_of_sum1 = (sum1 * sum1);
-          double square_of_sum2 = (sum2 * sum2);
-
-          double variance1 = ((n * sum_of_squares1) - square_of_sum1) * adjustment;
-          double variance2 = ((n * sum_of_squares2) - square_of_sum2) * adjustment;
+          double variance1 = accumulator.variance1(Adjustment);
+          double variance2 = accumulator.variance2(Adjustment);
 
           double stddev1 = 0.0;
           double stddev2 = 0.0;
@@ -248,7 +260,7 @@ namespace tpn
             stddev2 = sqrt(variance2);
           }
 
-          covariance_value = ((n * inner_product) - (sum1 * sum2)) * adjustment;
+          covariance_value = accumulator.covariance(Adjustment);
 
           if ((stddev1 > 0.0) && (stddev2 > 0.0))
           {            
@@ -260,12 +272,7 @@ namespace tpn
       }
     }
 
-    calc_t   inner_product;
-    calc_t   sum_of_squares1;
-    calc_t   sum_of_squares2;
-    calc_t   sum1;
-    calc_t   sum2;
-    uint32_t counter;
+    private_statistics::co_moments<calc_t> accumulator;
     mutable double covariance_value;
     mutable double correlation_value;
     mutable bool   recalculate;
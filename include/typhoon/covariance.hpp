@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.hpp"
 #include "functional.hpp"
 #include "type_traits.hpp"
+#include "span.hpp"
+#include "private/statistics.hpp"
 
 #include <math.h>
 #include <stdint.h>
@@ -118,10 +120,33 @@ namespace tpn
     //*********************************
     void add(TInput value1, TInput value2)
     {
-      inner_product += TCalc(value1 * value2);
-      sum1          += TCalc(value1);
-      sum2          += TCalc(value2);
-      ++counter;
+      accumulator.add(value1, value2);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Add contiguous blocks of paired values.
+    /// Adds min(values1.size(), values2.size()) pairs.
+    /// Floating point values are summed a vector at a time.
+    //*********************************
+    void add(tpn::span<const TInput> values1, tpn::span<const TInput> values2)
+    {
+      const size_t n = (values1.size() < values2.size()) ? values1.size() : values2.size();
+
+      if (n != 0U)
+      {
+        accumulator.add(values1.data(), values2.data(), n);
+        recalculate = true;
+      }
+    }
+
+    //*********************************
+    /// Add the values from another covariance,
+    /// as if they had been added to this one.
+    //*********************************
+    void merge(const covariance& other)
+    {
+      accumulator.merge(other.accumulator);
       recalculate = true;
     }
 
@@ -167,12 +192,9 @@ namespace tpn
       {
         covariance_value = 0.0;
 
-        if (counter != 0)
+        if (accumulator.counter != 0)
         {
-          double n = double(counter);
-          double adjustment = 1.0 / (n * (n - Adjustment));
-
-          covariance_value = ((n * inner_product) - (sum1 * sum2)) * adjustment;
+          covariance_value = accumulator.covariance(Adjustment);
 
           recalculate = false;
         }
@@ -194,7 +216,7 @@ namespace tpn
     //*********************************
     size_t count() const
     {
-      return size_t(counter);
+      return size_t(accumulator.counter);
     }
 
     //*********************************
@@ -202,20 +224,14 @@ namespace tpn
     //*********************************
     void clear()
     {
-      inner_product    = calc_t(0);
-      sum1             = calc_t(0);
-      sum2             = calc_t(0);
-      counter          = 0U;
+      accumulator.clear();
       covariance_value = 0.0;
       recalculate      = true;
     }
 
   private:
   
-    calc_t   inner_product;
-    calc_t   sum1;
-    calc_t   sum2;
-    uint32_t counter;
+    private_statistics::co_moments<calc_t> accumulator;
     mutable double covariance_value;
     mutable bool   recalculate;
   };
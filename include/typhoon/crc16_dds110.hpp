@@ -70,6 +70,10 @@ namespace tpn
   };
 #endif
 
+#if TYPHOON_USING_CPP11
+  typedef tpn::crc16_dds110_t<4096U> crc16_dds110_t4096;
+  typedef tpn::crc16_dds110_t<2048U> crc16_dds110_t2048;
+#endif
   typedef tpn::crc16_dds110_t<256U> crc16_dds110_t256;
   typedef tpn::crc16_dds110_t<16U>  crc16_dds110_t16;
   typedef tpn::crc16_dds110_t<4U>   crc16_dds110_t4;
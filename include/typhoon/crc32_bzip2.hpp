@@ -70,6 +70,10 @@ namespace tpn
   };
 #endif
 
+#if TYPHOON_USING_CPP11
+  typedef tpn::crc32_bzip2_t<4096U> crc32_bzip2_t4096;
+  typedef tpn::crc32_bzip2_t<2048U> crc32_bzip2_t2048;
+#endif
   typedef tpn::crc32_bzip2_t<256U> crc32_bzip2_t256;
   typedef tpn::crc32_bzip2_t<16U>  crc32_bzip2_t16;
   typedef tpn::crc32_bzip2_t<4U>   crc32_bzip2_t4;
@@ -70,9 +70,19 @@ namespace tpn
   };
 #endif
 
+#if TYPHOON_USING_CPP11
+  typedef tpn::crc32_c_t<4096U> crc32_c_t4096;
+  typedef tpn::crc32_c_t<2048U> crc32_c_t2048;
+#endif
   typedef tpn::crc32_c_t<256U> crc32_c_t256;
   typedef tpn::crc32_c_t<16U>  crc32_c_t16;
   typedef tpn::crc32_c_t<4U>   crc32_c_t4;
   typedef crc32_c_t256         crc32_c;
+
+#if TYPHOON_CRC32_C_HARDWARE
+  /// CRC32-C using the CPU's CRC32-C instructions.
+  /// Unless tpn::crc32_c already uses them, check that the CPU has them first.
+  typedef tpn::crc_type<tpn::private_crc::crc32_c_parameters, 256U, tpn::private_crc::crc32_c_hardware_policy> crc32_c_hardware;
+#endif
 }
 #endif
@@ -28,8 +28,8 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 ******************************************************************************/
 
-#ifndef TYPHOON_CRC32_D_HPP
-#define TYPHOON_CRC32_D_HPP
+#ifndef TYPHOON_CRC32_Q_HPP
+#define TYPHOON_CRC32_Q_HPP
 
 #include "platform.hpp"
 #include "private/crc_implementation.hpp"
@@ -70,6 +70,10 @@ namespace tpn
   };
 #endif
 
+#if TYPHOON_USING_CPP11
+  typedef tpn::crc32_q_t<4096U> crc32_q_t4096;
+  typedef tpn::crc32_q_t<2048U> crc32_q_t2048;
+#endif
   typedef tpn::crc32_q_t<256U> crc32_q_t256;
   typedef tpn::crc32_q_t<16U>  crc32_q_t16;
   typedef tpn::crc32_q_t<4U>   crc32_q_t4;
@@ -70,6 +70,10 @@ namespace tpn
   };
 #endif
 
+#if TYPHOON_USING_CPP11
+  typedef tpn::crc64_ecma_t<4096U> crc64_ecma_t4096;
+  typedef tpn::crc64_ecma_t<2048U> crc64_ecma_t2048;
+#endif
   typedef tpn::crc64_ecma_t<256U> crc64_ecma_t256;
   typedef tpn::crc64_ecma_t<16U>  crc64_ecma_t16;
   typedef tpn::crc64_ecma_t<4U>   crc64_ecma_t4;
@@ -70,6 +70,10 @@ namespace tpn
   };
 #endif
     
+#if TYPHOON_USING_CPP11
+  typedef tpn::crc8_maxim_t<4096U> crc8_maxim_t4096;
+  typedef tpn::crc8_maxim_t<2048U> crc8_maxim_t2048;
+#endif
   typedef tpn::crc8_maxim_t<256U> crc8_maxim_t256;
   typedef tpn::crc8_maxim_t<16U>  crc8_maxim_t16;
   typedef tpn::crc8_maxim_t<4U>   crc8_maxim_t4;
@@ -0,0 +1,432 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2014 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_CUCKOO_FILTER_HPP
+#define TYPHOON_CUCKOO_FILTER_HPP
+
+#include "platform.hpp"
+#include "parameter_type.hpp"
+#include "hash.hpp"
+#include "murmur3.hpp"
+#include "smallest.hpp"
+#include "power.hpp"
+#include "static_assert.hpp"
+
+#include <stdint.h>
+#include <stddef.h>
+
+///\defgroup cuckoo_filter cuckoo_filter
+/// A membership filter that allows keys to be removed.
+///\ingroup containers
+
+#if TYPHOON_USING_64BIT_TYPES
+
+namespace tpn
+{
+  //***************************************************************************
+  /// A cuckoo filter.
+  /// Stores a fingerprint of each key in one of two buckets of four slots.
+  /// Unlike a Bloom filter, a key may be erased, so a set of live keys can be
+  /// tracked without rebuilding the filter.
+  /// The second bucket is the first XOR a hash of the fingerprint, so either
+  /// bucket can be found from the other when a fingerprint is moved.
+  /// When both buckets are full, a random fingerprint is kicked out to its
+  /// other bucket, and so on, for at most 'Max_Kicks' moves. If the chain
+  /// does not end, the last fingerprint is kept aside and the filter reports
+  /// full to later inserts. Each erase adds it again, with a new chain of
+  /// kicks, until one ends.
+  ///
+  /// A lookup that misses checks eight slots, so the false positive rate is
+  /// at most 8 / 2^VFingerprint_Bits; 1 in 8192 for 16 bit fingerprints.
+  ///
+  /// Inserting the same key twice stores two fingerprints; erase removes one.
+  /// Erasing a key that was never inserted may remove a key that shares its
+  /// fingerprint.
+  ///\tparam TKey              The key type.
+  ///\tparam VCapacity         The number of keys the filter is sized for.
+  ///\tparam VFingerprint_Bits The bits stored per key. Default 16.
+  ///\tparam THash             The hash for the key. Default tpn::hash<TKey>.
+  ///\ingroup cuckoo_filter
+  //***************************************************************************
+  template <typename TKey, size_t VCapacity, size_t VFingerprint_Bits = 16U, typename THash = tpn::hash<TKey> >
+  class cuckoo_filter
+  {
+  private:
+
+    typedef typename tpn::parameter_type<TKey>::type parameter_t;
+
+  public:
+
+    typedef TKey  key_type;
+    typedef THash hasher;
+    typedef typename tpn::smallest_uint_for_bits<VFingerprint_Bits>::type fingerprint_type;
+
+    TYPHOON_STATIC_ASSERT(VCapacity > 0U, "Zero capacity");
+    TYPHOON_STATIC_ASSERT((VFingerprint_Bits >= 4U) && (VFingerprint_Bits <= 32U), "Fingerprint bits must be 4 to 32");
+
+    //*************************************************************************
+    /// The buckets are a power of 2, enough to hold the capacity at 95% full.
+    /// A bucket is 4, 8 or 16 bytes, so no bucket straddles a cache line.
+    //*************************************************************************
+    static TYPHOON_CONSTANT size_t Bucket_Size = 4U;
+    static TYPHOON_CONSTANT size_t Buckets     = tpn::power_of_2_round_up<((VCapacity * 100U) + (95U * Bucket_Size) - 1U) / (95U * Bucket_Size)>::value;
+    static TYPHOON_CONSTANT size_t Slots       = Buckets * Bucket_Size;
+    static TYPHOON_CONSTANT size_t Max_Kicks   = 500U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    cuckoo_filter()
+      : random(0x9E3779B9U)
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Clears the filter of all entries.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Buckets; ++i)
+      {
+        for (size_t j = 0U; j < Bucket_Size; ++j)
+        {
+          buckets[i].slots[j] = Empty;
+        }
+      }
+
+      victim.fingerprint = Empty;
+      victim.index       = 0U;
+      count              = 0U;
+    }
+
+    //*************************************************************************
+    /// Inserts a key.
+    ///\param key The key to insert.
+    ///\return <b>true</b> if the key was inserted, <b>false</b> if the filter is full.
+    //*************************************************************************
+    bool insert(parameter_t key)
+    {
+      if (victim.fingerprint != Empty)
+      {
+        return false;
+      }
+
+      const location l = locate(key);
+
+      add(l.index, l.fingerprint);
+      ++count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key may be in the filter, <b>false</b> if it is not.
+    //*************************************************************************
+    bool contains(parameter_t key) const
+    {
+      const location l  = locate(key);
+      const size_t   i2 = alternate(l.index, l.fingerprint);
+
+      const bool found = has(l.index, l.fingerprint) | has(i2, l.fingerprint);
+
+      return found || ((victim.fingerprint == l.fingerprint) && ((victim.index == l.index) || (victim.index == i2)));
+    }
+
+    //*************************************************************************
+    /// Erases a key.
+    /// Only erase keys that were inserted.
+    ///\param  key The key to erase.
+    ///\return <b>true</b> if a fingerprint for the key was found and removed.
+    //*************************************************************************
+    bool erase(parameter_t key)
+    {
+      const location l  = locate(key);
+      const size_t   i2 = alternate(l.index, l.fingerprint);
+
+      if (remove(l.index, l.fingerprint) || remove(i2, l.fingerprint))
+      {
+        --count;
+
+        // There may now be room for the fingerprint kept aside. The free
+        // slot need not be in one of its buckets, so it is added again with
+        // a chain of kicks, which keeps it aside once more if that fails.
+        if (victim.fingerprint != Empty)
+        {
+          const stash kept = victim;
+          victim.fingerprint = Empty;
+
+          add(kept.index, kept.fingerprint);
+        }
+
+        return true;
+      }
+
+      if ((victim.fingerprint == l.fingerprint) && ((victim.index == l.index) || (victim.index == i2)))
+      {
+        victim.fingerprint = Empty;
+        --count;
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Returns the number of keys in the filter.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Checks if the filter is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the filter is full.
+    /// A full filter will not accept inserts until a key is erased.
+    //*************************************************************************
+    bool full() const
+    {
+      return victim.fingerprint != Empty;
+    }
+
+    //*************************************************************************
+    /// Returns the number of keys the filter was sized for.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return VCapacity;
+    }
+
+    //*************************************************************************
+    /// Returns the number of fingerprint slots.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Slots;
+    }
+
+  private:
+
+    static TYPHOON_CONSTANT fingerprint_type Empty            = 0U;
+    static TYPHOON_CONSTANT uint64_t         Fingerprint_Mask = (uint64_t(1U) << VFingerprint_Bits) - 1U;
+
+    //*************************************************************************
+    /// Four fingerprint slots.
+    //*************************************************************************
+    struct bucket
+    {
+      fingerprint_type slots[Bucket_Size];
+    };
+
+    //*************************************************************************
+    /// The first bucket and fingerprint for a key.
+    //*************************************************************************
+    struct location
+    {
+      size_t           index;
+      fingerprint_type fingerprint;
+    };
+
+    //*************************************************************************
+    /// The fingerprint kept aside when a chain of kicks does not end.
+    //*************************************************************************
+    struct stash
+    {
+      size_t           index;
+      fingerprint_type fingerprint;
+    };
+
+    //*************************************************************************
+    /// Hashes a key.
+    /// The hash is mixed, as tpn::hash of an integer may be the integer.
+    /// The low bits give the fingerprint and the high bits the bucket.
+    /// Zero marks an empty slot, so a zero fingerprint is made one.
+    //*************************************************************************
+    static location locate(parameter_t key)
+    {
+      const uint64_t h = private_murmur3::fmix(static_cast<uint64_t>(THash()(key)));
+
+      location l;
+      l.index       = static_cast<size_t>(h >> 32U) & (Buckets - 1U);
+      l.fingerprint = static_cast<fingerprint_type>(h & Fingerprint_Mask);
+
+      if (l.fingerprint == Empty)
+      {
+        l.fingerprint = 1U;
+      }
+
+      return l;
+    }
+
+    //*************************************************************************
+    /// The other bucket for a fingerprint.
+    //*************************************************************************
+    static size_t alternate(size_t index, fingerprint_type fingerprint)
+    {
+      return (index ^ private_murmur3::fmix(static_cast<uint32_t>(fingerprint))) & (Buckets - 1U);
+    }
+
+    //*************************************************************************
+    /// Adds a fingerprint to one of its buckets.
+    /// When both are full, fingerprints are kicked along their chain for at
+    /// most 'Max_Kicks' moves. If the chain does not end, the last
+    /// fingerprint moved is kept aside.
+    //*************************************************************************
+    void add(size_t index, fingerprint_type fingerprint)
+    {
+      if (place(index, fingerprint) || place(alternate(index, fingerprint), fingerprint))
+      {
+        return;
+      }
+
+      // Both buckets are full. Kick fingerprints along their chain.
+      index = (next_random() & 1U) ? index : alternate(index, fingerprint);
+
+      for (size_t kick = 0U; kick < Max_Kicks; ++kick)
+      {
+        fingerprint_type& slot    = buckets[index].slots[next_random() % Bucket_Size];
+        const fingerprint_type kicked = slot;
+        slot        = fingerprint;
+        fingerprint = kicked;
+        index       = alternate(index, fingerprint);
+
+        if (place(index, fingerprint))
+        {
+          return;
+        }
+      }
+
+      // The chain did not end. The last fingerprint moved has nowhere to go.
+      victim.fingerprint = fingerprint;
+      victim.index       = index;
+    }
+
+    //*************************************************************************
+    /// Puts a fingerprint in an empty slot of the bucket, if there is one.
+    //*************************************************************************
+    bool place(size_t index, fingerprint_type fingerprint)
+    {
+      bucket& b = buckets[index];
+
+      for (size_t j = 0U; j < Bucket_Size; ++j)
+      {
+        if (b.slots[j] == Empty)
+        {
+          b.slots[j] = fingerprint;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Empties one slot of the bucket holding the fingerprint, if there is one.
+    //*************************************************************************
+    bool remove(size_t index, fingerprint_type fingerprint)
+    {
+      bucket& b = buckets[index];
+
+      for (size_t j = 0U; j < Bucket_Size; ++j)
+      {
+        if (b.slots[j] == fingerprint)
+        {
+          b.slots[j] = Empty;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Checks all of the slots without branching.
+    //*************************************************************************
+    bool has(size_t index, fingerprint_type fingerprint) const
+    {
+      const bucket& b = buckets[index];
+
+      return (b.slots[0] == fingerprint) | (b.slots[1] == fingerprint) |
+             (b.slots[2] == fingerprint) | (b.slots[3] == fingerprint);
+    }
+
+    //*************************************************************************
+    /// xorshift32, to choose which fingerprint is kicked out.
+    //*************************************************************************
+    uint32_t next_random()
+    {
+      random ^= random << 13U;
+      random ^= random >> 17U;
+      random ^= random << 5U;
+
+      return random;
+    }
+
+    /// The fingerprints. Aligned so that buckets do not straddle cache lines.
+    alignas(64) bucket buckets[Buckets];
+
+    stash    victim;
+    size_t   count;
+    uint32_t random;
+  };
+
+  template <typename TKey, size_t VCapacity, size_t VFingerprint_Bits, typename THash>
+  TYPHOON_CONSTANT size_t cuckoo_filter<TKey, VCapacity, VFingerprint_Bits, THash>::Bucket_Size;
+
+  template <typename TKey, size_t VCapacity, size_t VFingerprint_Bits, typename THash>
+  TYPHOON_CONSTANT size_t cuckoo_filter<TKey, VCapacity, VFingerprint_Bits, THash>::Buckets;
+
+  template <typename TKey, size_t VCapacity, size_t VFingerprint_Bits, typename THash>
+  TYPHOON_CONSTANT size_t cuckoo_filter<TKey, VCapacity, VFingerprint_Bits, THash>::Slots;
+
+  template <typename TKey, size_t VCapacity, size_t VFingerprint_Bits, typename THash>
+  TYPHOON_CONSTANT size_t cuckoo_filter<TKey, VCapacity, VFingerprint_Bits, THash>::Max_Kicks;
+
+  template <typename TKey, size_t VCapacity, size_t VFingerprint_Bits, typename THash>
+  TYPHOON_CONSTANT typename cuckoo_filter<TKey, VCapacity, VFingerprint_Bits, THash>::fingerprint_type cuckoo_filter<TKey, VCapacity, VFingerprint_Bits, THash>::Empty;
+
+  template <typename TKey, size_t VCapacity, size_t VFingerprint_Bits, typename THash>
+  TYPHOON_CONSTANT uint64_t cuckoo_filter<TKey, VCapacity, VFingerprint_Bits, THash>::Fingerprint_Mask;
+}
+
+#endif
+
+#endif
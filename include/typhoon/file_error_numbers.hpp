@@ -100,5 +100,11 @@ SOFTWARE.
 #define TYPHOON_BIP_BUFFER_SPSC_ATOMIC_FILE_ID "67"
 #define TYPHOON_REFERENCE_COUNTED_OBJECT_FILE_ID "68"
 #define TYPHOON_TO_ARITHMETIC_FILE_ID "69"
+#define TYPHOON_FLAT_HASH_MAP_FILE_ID "70"
+#define TYPHOON_FLAT_HASH_SET_FILE_ID "71"
+#define TYPHOON_POOL_TELEMETRY_FILE_ID "72"
+#define TYPHOON_BTREE_MAP_FILE_ID "73"
+#define TYPHOON_BTREE_SET_FILE_ID "74"
+#define TYPHOON_QUEUED_MESSAGE_ROUTER_FILE_ID "75"
 
 #endif
@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.hpp"
 #include "imemory_block_allocator.hpp"
 #include "generic_pool.hpp"
+#include "pool_atomic.hpp"
 #include "alignment.hpp"
 
 namespace tpn
@@ -109,6 +110,82 @@ namespace tpn
     /// The generic pool from which allocate memory blocks.
     tpn::generic_pool<Block_Size, Alignment, Size> pool;
   };
+
+#if TYPHOON_HAS_ATOMIC
+  //*************************************************************************
+  /// The fixed sized memory block pool.
+  /// The allocated memory blocks are all the same size.
+  /// Blocks may be allocated and released by threads and interrupt handlers
+  /// without a lock.
+  //*************************************************************************
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  class fixed_sized_memory_block_allocator_atomic : public imemory_block_allocator
+  {
+  public:
+    static TYPHOON_CONSTANT size_t Block_Size = VBlock_Size;
+    static TYPHOON_CONSTANT size_t Alignment  = VAlignment;
+    static TYPHOON_CONSTANT size_t Size       = VSize;
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    fixed_sized_memory_block_allocator_atomic()
+    {
+    }
+
+  private:
+
+    /// A structure that has the size Block_Size.
+    struct block
+    {
+      char data[Block_Size];
+    };
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) TYPHOON_OVERRIDE
+    {
+      if ((required_alignment <= Alignment) &&
+          (required_size <= Block_Size))
+      {
+        // Another thread may take the last block after a check for full().
+        return pool.template try_allocate<block>();
+      }
+      else
+      {
+        return TYPHOON_NULLPTR;
+      }
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) TYPHOON_OVERRIDE
+    {
+      if (pool.is_in_pool(pblock))
+      {
+        pool.release(static_cast<const block* const>(pblock));
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const TYPHOON_OVERRIDE
+    {
+      return pool.is_in_pool(pblock);
+    }
+
+    /// The generic pool from which allocate memory blocks.
+    tpn::generic_pool_atomic<Block_Size, Alignment, Size> pool;
+  };
+#endif
 }
 
 #endif
@@ -0,0 +1,1272 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2016 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_FLAT_HASH_SET_HPP
+#define TYPHOON_FLAT_HASH_SET_HPP
+
+#include "platform.hpp"
+#include "algorithm.hpp"
+#include "alignment.hpp"
+#include "iterator.hpp"
+#include "functional.hpp"
+#include "utility.hpp"
+#include "hash.hpp"
+#include "type_traits.hpp"
+#include "nth_type.hpp"
+#include "error_handler.hpp"
+#include "exception.hpp"
+#include "debug_count.hpp"
+#include "nullptr.hpp"
+#include "placement_new.hpp"
+#include "initializer_list.hpp"
+
+#include "private/flat_hash_group.hpp"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup flat_hash_set flat_hash_set
+/// An open addressing hash set with the capacity defined at compile time.
+/// The elements are held in a flat array of slots, with a control byte per
+/// slot that holds 7 bits of the key's hash. Lookups compare a group of
+/// control bytes at a time and only touch the keys that match, and
+/// iteration skips empty slots a group at a time.
+/// Elements do not move once inserted, so iterators stay valid until the
+/// element they refer to is erased.
+///\ingroup containers
+//*****************************************************************************
+
+namespace tpn
+{
+  //***************************************************************************
+  /// Exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_exception : public tpn::exception
+  {
+  public:
+
+    flat_hash_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : tpn::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_full : public tpn::flat_hash_set_exception
+  {
+  public:
+
+    flat_hash_set_full(string_type file_name_, numeric_type line_number_)
+      : tpn::flat_hash_set_exception(TYPHOON_ERROR_TEXT("flat_hash_set:full", TYPHOON_FLAT_HASH_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_out_of_range : public tpn::flat_hash_set_exception
+  {
+  public:
+
+    flat_hash_set_out_of_range(string_type file_name_, numeric_type line_number_)
+      : tpn::flat_hash_set_exception(TYPHOON_ERROR_TEXT("flat_hash_set:range", TYPHOON_FLAT_HASH_SET_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_iterator : public tpn::flat_hash_set_exception
+  {
+  public:
+
+    flat_hash_set_iterator(string_type file_name_, numeric_type line_number_)
+      : tpn::flat_hash_set_exception(TYPHOON_ERROR_TEXT("flat_hash_set:iterator", TYPHOON_FLAT_HASH_SET_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_hash_set.
+  /// Can be used as a reference type for all flat_hash_set containing a specific type.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  template <typename TKey, typename THash = tpn::hash<TKey>, typename TKeyEqual = tpn::equal_to<TKey> >
+  class iflat_hash_set
+  {
+  public:
+
+    typedef TKey              value_type;
+    typedef TKey              key_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if TYPHOON_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef const TKey& key_parameter_t;
+
+  protected:
+
+    typedef tpn::private_flat_hash::control control_t;
+
+  public:
+
+    //*********************************************************************
+    class iterator : public tpn::iterator<TYPHOON_OR_STD::forward_iterator_tag, TKey>
+    {
+    public:
+
+      typedef typename tpn::iterator<TYPHOON_OR_STD::forward_iterator_tag, TKey>::value_type value_type;
+      typedef typename iflat_hash_set::key_type        key_type;
+      typedef typename iflat_hash_set::hasher          hasher;
+      typedef typename iflat_hash_set::key_equal       key_equal;
+      typedef typename iflat_hash_set::reference       reference;
+      typedef typename iflat_hash_set::const_reference const_reference;
+      typedef typename iflat_hash_set::pointer         pointer;
+      typedef typename iflat_hash_set::const_pointer   const_pointer;
+      typedef typename iflat_hash_set::size_type       size_type;
+
+      friend class iflat_hash_set;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pmap(TYPHOON_NULLPTR)
+      {
+        position.index = 0U;
+        position.first = 0U;
+        position.done  = 0U;
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : pmap(other.pmap)
+        , position(other.position)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        pmap->ctrl.advance(position);
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator =(const iterator& other)
+      {
+        pmap     = other.pmap;
+        position = other.position;
+        return *this;
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return pmap->pslots[position.index];
+      }
+
+      //*********************************
+      pointer operator &() const
+      {
+        return &(pmap->pslots[position.index]);
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return &(pmap->pslots[position.index]);
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.position.index == rhs.position.index;
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(iflat_hash_set* pmap_, const typename control_t::cursor& position_)
+        : pmap(pmap_)
+        , position(position_)
+      {
+      }
+
+      iflat_hash_set*             pmap;
+      typename control_t::cursor position;
+    };
+
+    //*********************************************************************
+    class const_iterator : public tpn::iterator<TYPHOON_OR_STD::forward_iterator_tag, const TKey>
+    {
+    public:
+
+      typedef typename tpn::iterator<TYPHOON_OR_STD::forward_iterator_tag, const TKey>::value_type value_type;
+      typedef typename iflat_hash_set::key_type        key_type;
+      typedef typename iflat_hash_set::hasher          hasher;
+      typedef typename iflat_hash_set::key_equal       key_equal;
+      typedef typename iflat_hash_set::reference       reference;
+      typedef typename iflat_hash_set::const_reference const_reference;
+      typedef typename iflat_hash_set::pointer         pointer;
+      typedef typename iflat_hash_set::const_pointer   const_pointer;
+      typedef typename iflat_hash_set::size_type       size_type;
+
+      friend class iflat_hash_set;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pmap(TYPHOON_NULLPTR)
+      {
+        position.index = 0U;
+        position.first = 0U;
+        position.done  = 0U;
+      }
+
+      //*********************************
+      const_iterator(const typename iflat_hash_set::iterator& other)
+        : pmap(other.pmap)
+        , position(other.position)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : pmap(other.pmap)
+        , position(other.position)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        pmap->ctrl.advance(position);
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        pmap     = other.pmap;
+        position = other.position;
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return pmap->pslots[position.index];
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return &(pmap->pslots[position.index]);
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &(pmap->pslots[position.index]);
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.position.index == rhs.position.index;
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const iflat_hash_set* pmap_, const typename control_t::cursor& position_)
+        : pmap(pmap_)
+        , position(position_)
+      {
+      }
+
+      const iflat_hash_set*      pmap;
+      typename control_t::cursor position;
+    };
+
+    typedef typename tpn::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the flat_hash_set.
+    ///\return An iterator to the beginning of the flat_hash_set.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(this, first_position());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the flat_hash_set.
+    ///\return A const iterator to the beginning of the flat_hash_set.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, first_position());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the flat_hash_set.
+    ///\return A const iterator to the beginning of the flat_hash_set.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, first_position());
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the flat_hash_set.
+    ///\return An iterator to the end of the flat_hash_set.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(this, position_of(ctrl.size()));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the flat_hash_set.
+    ///\return A const iterator to the end of the flat_hash_set.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, position_of(ctrl.size()));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the flat_hash_set.
+    ///\return A const iterator to the end of the flat_hash_set.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, position_of(ctrl.size()));
+    }
+
+    //*********************************************************************
+    /// Returns the number of slots.
+    /// There are no chained buckets, so each slot counts as one.
+    ///\return The number of slots.
+    //*********************************************************************
+    size_type max_bucket_count() const
+    {
+      return ctrl.size();
+    }
+
+    //*********************************************************************
+    /// Returns the number of slots.
+    /// There are no chained buckets, so each slot counts as one.
+    ///\return The number of slots.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return ctrl.size();
+    }
+
+    //*********************************************************************
+    /// Assigns values to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if TYPHOON_IS_DEBUG_BUILD
+      difference_type d = tpn::distance(first_, last_);
+      TYPHOON_ASSERT(d >= 0, TYPHOON_ERROR(flat_hash_set_iterator));
+      TYPHOON_ASSERT(size_t(d) <= max_size(), TYPHOON_ERROR(flat_hash_set_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<iterator, bool> insert(const_reference key)
+    {
+      TYPHOON_OR_STD::pair<iterator, bool> result(end(), false);
+
+      const size_t h     = hash_of(key);
+      size_t       index = find_index(key, h);
+
+      if (index == control_t::npos)
+      {
+        TYPHOON_ASSERT(!full(), TYPHOON_ERROR(flat_hash_set_full));
+
+        if (!full())
+        {
+          index = insert_index(h);
+          ::new (pslots + index) value_type(key);
+          TYPHOON_INCREMENT_DEBUG_COUNT
+
+          result.first  = iterator(this, position_of(index));
+          result.second = true;
+        }
+      }
+      else
+      {
+        result.first = iterator(this, position_of(index));
+      }
+
+      return result;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<iterator, bool> insert(rvalue_reference key)
+    {
+      TYPHOON_OR_STD::pair<iterator, bool> result(end(), false);
+
+      const size_t h     = hash_of(key);
+      size_t       index = find_index(key, h);
+
+      if (index == control_t::npos)
+      {
+        TYPHOON_ASSERT(!full(), TYPHOON_ERROR(flat_hash_set_full));
+
+        if (!full())
+        {
+          index = insert_index(h);
+          ::new (pslots + index) value_type(tpn::move(key));
+          TYPHOON_INCREMENT_DEBUG_COUNT
+
+          result.first  = iterator(this, position_of(index));
+          result.second = true;
+        }
+      }
+      else
+      {
+        result.first = iterator(this, position_of(index));
+      }
+
+      return result;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key)
+    {
+      return insert(key).first;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key)
+    {
+      return insert(tpn::move(key)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set does not have enough free space.
+    ///\param position The position to insert at.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      const size_t index = find_index(key, hash_of(key));
+
+      if (index == control_t::npos)
+      {
+        return 0U;
+      }
+
+      erase_index(index);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param ielement Iterator to the element.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      iterator inext(this, ielement.position);
+      ++inext;
+
+      erase_index(ielement.position.index);
+
+      return inext;
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Erasing everything?
+      if ((first_ == begin()) && (last_ == end()))
+      {
+        clear();
+        return end();
+      }
+
+      iterator itr(this, first_.position);
+
+      while (itr.position.index != last_.position.index)
+      {
+        const size_t index = itr.position.index;
+        ++itr;
+        erase_index(index);
+      }
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Clears the flat_hash_set.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find_index(key, hash_of(key)) == control_t::npos) ? 0 : 1;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      const size_t index = find_index(key, hash_of(key));
+
+      return (index == control_t::npos) ? end() : iterator(this, position_of(index));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const size_t index = find_index(key, hash_of(key));
+
+      return (index == control_t::npos) ? end() : const_iterator(this, position_of(index));
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return TYPHOON_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    TYPHOON_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return TYPHOON_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the flat_hash_set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return number_of_elements;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the flat_hash_set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return max_elements;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the flat_hash_set.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return max_elements;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the flat_hash_set is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return number_of_elements == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the flat_hash_set is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return number_of_elements == max_elements;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_elements - number_of_elements;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_hash_set& operator = (const iflat_hash_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_hash_set& operator = (iflat_hash_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_hash_set(void* pslots_, uint8_t* pctrl_, size_t number_of_slots_, size_t max_elements_, hasher key_hash_function_, key_equal key_equal_function_)
+      : ctrl(pctrl_, number_of_slots_)
+      , pslots(static_cast<pointer>(pslots_))
+      , number_of_elements(0U)
+      , number_of_deleted(0U)
+      , max_elements(max_elements_)
+      , growth_limit(number_of_slots_ - (number_of_slots_ / 16U))
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+      ctrl.reset();
+    }
+
+    //*********************************************************************
+    /// Initialise the flat_hash_set.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        typename control_t::cursor position = first_position();
+
+        while (position.index != ctrl.size())
+        {
+          pslots[position.index].~value_type();
+          TYPHOON_DECREMENT_DEBUG_COUNT
+          ctrl.advance(position);
+        }
+      }
+
+      ctrl.reset();
+      number_of_elements = 0U;
+      number_of_deleted  = 0U;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+      while (first != last)
+      {
+        iterator temp = first;
+        ++temp;
+        insert(tpn::move(*first));
+        first = temp;
+      }
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// The mixed hash of a key.
+    //*********************************************************************
+    size_t hash_of(key_parameter_t key) const
+    {
+      return tpn::private_flat_hash::mix(key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// The position of the first element.
+    //*********************************************************************
+    typename control_t::cursor first_position() const
+    {
+      typename control_t::cursor position;
+      ctrl.seek(position, 0U);
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// The position of the element in slot 'index', or of the end.
+    //*********************************************************************
+    typename control_t::cursor position_of(size_t index) const
+    {
+      typename control_t::cursor position;
+      ctrl.locate(position, index);
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// The slot holding 'key', or npos.
+    //*********************************************************************
+    size_t find_index(key_parameter_t key, size_t h) const
+    {
+      const uint8_t     fragment = tpn::private_flat_hash::h2(h);
+      control_t::probe  seq      = ctrl.make_probe(h);
+
+      while (!seq.done())
+      {
+        const tpn::private_flat_hash::group group = ctrl.load(seq.first_slot());
+
+        typename tpn::private_flat_hash::group::mask_type mask = group.match(fragment);
+
+        while (mask != 0U)
+        {
+          const size_t index = seq.first_slot() + tpn::private_flat_hash::group::lowest(mask);
+
+          if (key_equal_function(key, pslots[index]))
+          {
+            return index;
+          }
+
+          mask &= (mask - 1U);
+        }
+
+        // A key is never placed beyond a group with an empty slot.
+        if (group.match_empty() != 0U)
+        {
+          break;
+        }
+
+        seq.next();
+      }
+
+      return control_t::npos;
+    }
+
+    //*********************************************************************
+    /// Claims a slot for a new element with hash 'h'.
+    /// The caller constructs the element in the slot.
+    //*********************************************************************
+    size_t insert_index(size_t h)
+    {
+      size_t index = ctrl.find_first_non_full(h);
+
+      // Using up an empty slot. If too few are left, lookups for missing
+      // keys would have to probe too far, so clear out the tombstones.
+      // The load is at most 7/8, so at least 1/16 of the slots are
+      // tombstones by then, which keeps the cost of this per erase small.
+      if (ctrl.is_empty(index) && ((number_of_elements + number_of_deleted) >= growth_limit))
+      {
+        drop_deleted();
+        index = ctrl.find_first_non_full(h);
+      }
+
+      if (ctrl.is_deleted(index))
+      {
+        --number_of_deleted;
+      }
+
+      ctrl.set(index, tpn::private_flat_hash::h2(h));
+      ++number_of_elements;
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Destroys the element in a slot.
+    //*********************************************************************
+    void erase_index(size_t index)
+    {
+      pslots[index].~value_type();
+      TYPHOON_DECREMENT_DEBUG_COUNT
+
+      if (ctrl.erase(index))
+      {
+        ++number_of_deleted;
+      }
+
+      --number_of_elements;
+    }
+
+    //*********************************************************************
+    /// Re-places every element in the table, in place, so that the
+    /// tombstones left by erase become empty slots again.
+    //*********************************************************************
+    void drop_deleted()
+    {
+      typename tpn::aligned_storage<sizeof(value_type), tpn::alignment_of<value_type>::value>::type temp_storage;
+      pointer ptemp = reinterpret_cast<pointer>(&temp_storage);
+
+      ctrl.convert_for_rehash();
+      number_of_deleted = 0U;
+
+      // The elements still to be placed are now marked as deleted.
+      size_t index = 0U;
+
+      while (index < ctrl.size())
+      {
+        if (!ctrl.is_deleted(index))
+        {
+          ++index;
+          continue;
+        }
+
+        const size_t h      = hash_of(pslots[index]);
+        const size_t target = ctrl.find_first_non_full(h);
+
+        if (control_t::group_of(target) == control_t::group_of(index))
+        {
+          // Already in the best group it can be in.
+          ctrl.set(index, tpn::private_flat_hash::h2(h));
+          ++index;
+        }
+        else if (ctrl.is_empty(target))
+        {
+          ::new (pslots + target) value_type(tpn::move(pslots[index]));
+          pslots[index].~value_type();
+          ctrl.set(target, tpn::private_flat_hash::h2(h));
+          ctrl.set(index, tpn::private_flat_hash::ctrl_empty);
+          ++index;
+        }
+        else
+        {
+          // The target holds another element still to be placed.
+          // Swap them, then look at what is now in this slot.
+          ::new (ptemp) value_type(tpn::move(pslots[target]));
+          pslots[target].~value_type();
+          ::new (pslots + target) value_type(tpn::move(pslots[index]));
+          pslots[index].~value_type();
+          ::new (pslots + index) value_type(tpn::move(*ptemp));
+          ptemp->~value_type();
+          ctrl.set(target, tpn::private_flat_hash::h2(h));
+        }
+      }
+    }
+
+    // Disable copy construction.
+    iflat_hash_set(const iflat_hash_set&);
+
+    /// The control bytes.
+    control_t ctrl;
+
+    /// The slots that hold the elements.
+    pointer pslots;
+
+    /// The number of elements.
+    size_t number_of_elements;
+
+    /// The number of erased slots that are not yet free for new keys.
+    size_t number_of_deleted;
+
+    /// The maximum number of elements.
+    const size_t max_elements;
+
+    /// The number of slots that may be full or deleted before the tombstones are cleared.
+    const size_t growth_limit;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    TYPHOON_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(TYPHOON_POLYMORPHIC_FLAT_HASH_SET) || defined(TYPHOON_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_hash_set()
+    {
+    }
+#else
+  protected:
+    ~iflat_hash_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first flat_hash_set.
+  ///\param rhs Reference to the second flat_hash_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator ==(const tpn::iflat_hash_set<TKey, THash, TKeyEqual>& lhs, const tpn::iflat_hash_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    typedef typename tpn::iflat_hash_set<TKey, THash, TKeyEqual>::const_iterator const_iterator;
+
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    for (const_iterator itr = lhs.begin(); itr != lhs.end(); ++itr)
+    {
+      if (rhs.find(*itr) == rhs.end())
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_hash_set.
+  ///\param rhs Reference to the second flat_hash_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator !=(const tpn::iflat_hash_set<TKey, THash, TKeyEqual>& lhs, const tpn::iflat_hash_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated flat_hash_set implementation that uses a fixed size buffer.
+  /// The slot count is the smallest power of 2 number of groups that keeps
+  /// the load at or below 7/8 when full.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename THash = tpn::hash<TKey>, typename TKeyEqual = tpn::equal_to<TKey> >
+  class flat_hash_set : public tpn::iflat_hash_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef iflat_hash_set<TKey, THash, TKeyEqual> base;
+
+  public:
+
+    static TYPHOON_CONSTANT size_t MAX_SIZE  = MAX_SIZE_;
+    static TYPHOON_CONSTANT size_t MAX_SLOTS = tpn::private_flat_hash::slot_count<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    flat_hash_set(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slot_buffer, ctrl_buffer, MAX_SLOTS, MAX_SIZE, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_hash_set(const flat_hash_set& other)
+      : base(slot_buffer, ctrl_buffer, MAX_SLOTS, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_hash_set(flat_hash_set&& other)
+      : base(slot_buffer, ctrl_buffer, MAX_SLOTS, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_hash_set(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slot_buffer, ctrl_buffer, MAX_SLOTS, MAX_SIZE, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if TYPHOON_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    flat_hash_set(std::initializer_list<TKey> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slot_buffer, ctrl_buffer, MAX_SLOTS, MAX_SIZE, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_hash_set()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_hash_set& operator = (const flat_hash_set& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_hash_set& operator = (flat_hash_set&& rhs)
+    {
+      base::operator=(tpn::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The slots that hold the elements.
+    typename tpn::aligned_storage<sizeof(typename base::value_type), tpn::alignment_of<typename base::value_type>::value>::type slot_buffer[MAX_SLOTS];
+
+    /// The control bytes, one per slot.
+    uint8_t ctrl_buffer[MAX_SLOTS];
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if TYPHOON_USING_CPP17 && TYPHOON_HAS_INITIALIZER_LIST
+  template <typename... T>
+  flat_hash_set(T...) -> flat_hash_set<tpn::nth_type_t<0, T...>, sizeof...(T)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if TYPHOON_USING_CPP11 && TYPHOON_HAS_INITIALIZER_LIST
+  template <typename TKey, typename THash = tpn::hash<TKey>, typename TKeyEqual = tpn::equal_to<TKey>, typename... T>
+  constexpr auto make_flat_hash_set(T&&... keys) -> tpn::flat_hash_set<TKey, sizeof...(T), THash, TKeyEqual>
+  {
+    return { {tpn::forward<T>(keys)...} };
+  }
+#endif
+}
+
+#endif
@@ -215,11 +215,7 @@ namespace tpn
 
       clear();
 
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -300,19 +296,28 @@ namespace tpn
 
     //*********************************************************************
     /// Inserts a range of values to the flat_set.
+    /// The range is sorted and merged with the existing values in one pass.
     /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values that is already sorted by key, with no repeated keys.
+    /// The range is merged with the existing values without being sorted.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(tpn::sorted_unique_t, TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*************************************************************************
@@ -914,6 +919,58 @@ namespace tpn
 
   private:
 
+    //*********************************************************************
+    /// Range inserts construct their values in the storage.
+    //*********************************************************************
+    class storage_policy
+    {
+    public:
+
+      explicit storage_policy(iflat_set& container_)
+        : container(container_)
+        , created(0)
+      {
+      }
+
+      template <typename TValue>
+      value_type* create(const TValue& value)
+      {
+        value_type* pvalue = container.storage.template allocate<value_type>();
+        ::new (pvalue) value_type(value);
+        ++created;
+        return pvalue;
+      }
+
+      template <typename TValue>
+      void insert(const TValue& value)
+      {
+        container.insert(value);
+      }
+
+      void discard(value_type* pvalue)
+      {
+        pvalue->~value_type();
+        container.storage.release(pvalue);
+        --created;
+      }
+
+      iflat_set& container;
+      int32_t created;
+    };
+
+    //*********************************************************************
+    /// Inserts a range in batches.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool sorted)
+    {
+      storage_policy policy(*this);
+
+      refset_t::insert_batches(first, last, sorted, policy);
+
+      TYPHOON_ADD_DEBUG_COUNT(policy.created)
+    }
+
     // Disable copy construction.
     iflat_set(const iflat_set&);
 
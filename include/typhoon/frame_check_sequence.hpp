@@ -88,6 +88,28 @@ namespace tpn
 
       TFCS* p_fcs;
     };
+
+    //***************************************************
+    /// Detects a policy that can add a contiguous block
+    /// of bytes in one call.
+    /// The policy declares 'typedef void supports_block_add;'
+    /// and 'value_type add(value_type, const uint8_t*, size_t) const'.
+    //***************************************************
+    template <typename TPolicy>
+    struct has_block_add
+    {
+    private:
+
+      typedef char yes;
+      struct no { char c[2]; };
+
+      template <typename U> static yes test(typename U::supports_block_add*);
+      template <typename U> static no  test(...);
+
+    public:
+
+      static TYPHOON_CONSTANT bool value = (sizeof(test<TPolicy>(0)) == sizeof(yes));
+    };
   }
 
   //***************************************************************************
@@ -146,11 +168,10 @@ namespace tpn
     {
       TYPHOON_STATIC_ASSERT(sizeof(typename tpn::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin);
-        ++begin;
-      }
+      typedef tpn::integral_constant<bool, tpn::is_pointer<TIterator>::value &&
+                                           private_frame_check_sequence::has_block_add<policy_type>::value> use_block_add;
+
+      add_range(begin, end, use_block_add());
     }
 
     //*************************************************************************
@@ -187,6 +208,28 @@ namespace tpn
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, tpn::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin);
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range as a single block.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, tpn::true_type)
+    {
+      frame_check = policy.add(frame_check, reinterpret_cast<const uint8_t*>(begin), size_t(end - begin));
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
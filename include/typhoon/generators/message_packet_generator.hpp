@@ -96,17 +96,17 @@ namespace tpn
   public:
 
     //********************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
     /// 
     //********************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename T>
     explicit message_packet(T&& msg)
       : valid(true)
@@ -138,7 +138,7 @@ namespace tpn
         TYPHOON_STATIC_ASSERT(IsInMessageList<T>, "Message not in packet type list");
       }
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //**********************************************
     void copy(const message_packet& other)
@@ -424,15 +424,15 @@ namespace tpn
     cog.outl("public:")
     cog.outl("")
     cog.outl("  //********************************************")
-    cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
     cog.outl("  message_packet()")
     cog.outl("    : valid(false)")
     cog.outl("  {")
     cog.outl("  }")
-    cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
     cog.outl("")
     cog.outl("  //********************************************")
-    cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
     cog.outl("  explicit message_packet(const tpn::imessage& msg)")
     cog.outl("  {")
     cog.outl("    if (accepts(msg))")
@@ -447,11 +447,11 @@ namespace tpn
     cog.outl("")
     cog.outl("    TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));")
     cog.outl("  }")
-    cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
     cog.outl("")
     cog.outl("#if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
     cog.outl("  //********************************************")
-    cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
     cog.outl("  explicit message_packet(tpn::imessage&& msg)")
     cog.outl("  {")
     cog.outl("    if (accepts(msg))")
@@ -466,12 +466,12 @@ namespace tpn
     cog.outl("")
     cog.outl("    TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));")
     cog.outl("  }")
-    cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
     cog.outl("#endif")
     cog.outl("")
     cog.outl("#if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)")
     cog.outl("  //********************************************")
-    cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
     cog.out("  template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<")
     for n in range(1, int(Handlers)):
         cog.out("T%s, " % n)
@@ -486,10 +486,10 @@ namespace tpn
     cog.outl("  {")
     generate_static_assert_cpp11(int(Handlers))
     cog.outl("  }")
-    cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
     cog.outl("#else")
     cog.outl("  //********************************************")
-    cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
     cog.outl("  template <typename TMessage>")
     cog.out("  explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<")
     for n in range(1, int(Handlers)):
@@ -504,11 +504,11 @@ namespace tpn
     cog.outl("  {")
     generate_static_assert_cpp03(int(Handlers))
     cog.outl("  }")
-    cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
     cog.outl("#endif")
     cog.outl("")
     cog.outl("  //**********************************************")
-    cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
     cog.outl("  message_packet(const message_packet& other)")
     cog.outl("    : valid(other.is_valid())")
     cog.outl("  {")
@@ -517,11 +517,11 @@ namespace tpn
     cog.outl("      add_new_message(other.get());")
     cog.outl("    }")
     cog.outl("  }")
-    cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
     cog.outl("")
     cog.outl("#if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
     cog.outl("  //**********************************************")
-    cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
     cog.outl("  message_packet(message_packet&& other)")
     cog.outl("    : valid(other.is_valid())")
     cog.outl("  {")
@@ -530,7 +530,7 @@ namespace tpn
     cog.outl("      add_new_message(tpn::move(other.get()));")
     cog.outl("    }")
     cog.outl("  }")
-    cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+    cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
     cog.outl("#endif")
     cog.outl("")
     cog.outl("  //**********************************************")
@@ -706,15 +706,15 @@ namespace tpn
         cog.outl("public:")
         cog.outl("")
         cog.outl("  //********************************************")
-        cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
         cog.outl("  message_packet()")
         cog.outl("    : valid(false)")
         cog.outl("  {")
         cog.outl("  }")
-        cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
         cog.outl("")
         cog.outl("  //********************************************")
-        cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
         cog.outl("  explicit message_packet(const tpn::imessage& msg)")
         cog.outl("  {")
         cog.outl("    if (accepts(msg))")
@@ -729,11 +729,11 @@ namespace tpn
         cog.outl("")
         cog.outl("    TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));")
         cog.outl("  }")
-        cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
         cog.outl("")
         cog.outl("#if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
         cog.outl("  //********************************************")
-        cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
         cog.outl("  explicit message_packet(tpn::imessage&& msg)")
         cog.outl("  {")
         cog.outl("    if (accepts(msg))")
@@ -748,12 +748,12 @@ namespace tpn
         cog.outl("")
         cog.outl("    TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));")
         cog.outl("  }")
-        cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
         cog.outl("#endif")
         cog.outl("")
         cog.outl("#if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)")
         cog.outl("  //********************************************")
-        cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
         cog.out("  template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<")
         for t in range(1, n):
             cog.out("T%s, " % t)
@@ -768,10 +768,10 @@ namespace tpn
         cog.outl("  {")
         generate_static_assert_cpp11(n)
         cog.outl("  }")
-        cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
         cog.outl("#else")
         cog.outl("  //********************************************")
-        cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
         cog.outl("  template <typename TMessage>")
         cog.out("  explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<")
         for t in range(1, n):
@@ -786,11 +786,11 @@ namespace tpn
         cog.outl("  {")
         generate_static_assert_cpp03(n)
         cog.outl("  }")
-        cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
         cog.outl("#endif")
         cog.outl("")
         cog.outl("  //**********************************************")
-        cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
         cog.outl("  message_packet(const message_packet& other)")
         cog.outl("    : valid(other.is_valid())")
         cog.outl("  {")
@@ -799,11 +799,11 @@ namespace tpn
         cog.outl("      add_new_message(other.get());")
         cog.outl("    }")
         cog.outl("  }")
-        cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
         cog.outl("")
         cog.outl("#if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)")
         cog.outl("  //**********************************************")
-        cog.outl("#include \"tpn/private/diagnostic_uninitialized_push.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_uninitialized_push.h\"")
         cog.outl("  message_packet(message_packet&& other)")
         cog.outl("    : valid(other.is_valid())")
         cog.outl("  {")
@@ -812,7 +812,7 @@ namespace tpn
         cog.outl("      add_new_message(tpn::move(other.get()));")
         cog.outl("    }")
         cog.outl("  }")
-        cog.outl("#include \"tpn/private/diagnostic_pop.h\"")
+        cog.outl("#include \"typhoon/private/diagnostic_pop.h\"")
         cog.outl("#endif")
         cog.outl("")
         cog.outl("  //**********************************************")
@@ -36,7 +36,12 @@ SOFTWARE.
 #if TYPHOON_USING_8BIT_TYPES
 
 // The default hash calculation.
+// Strings and other blocks of bytes are hashed a word at a time by wyhash,
+// where 64 bit types are available. Define TYPHOON_HASH_USE_FNV_1A to use
+// the byte at a time FNV-1a hash instead, such as where hash values must
+// match those of earlier versions.
 #include "fnv_1.hpp"
+#include "wyhash.hpp"
 #include "type_traits.hpp"
 #include "static_assert.hpp"
 
@@ -71,7 +76,11 @@ namespace tpn
     typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if TYPHOON_USING_64BIT_TYPES && !defined(TYPHOON_HASH_USE_FNV_1A)
+      return wyhash_32(begin, end);
+#else
       return fnv_1a_32(begin, end);
+#endif
     }
 
 #if TYPHOON_USING_64BIT_TYPES
@@ -83,7 +92,11 @@ namespace tpn
     typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if defined(TYPHOON_HASH_USE_FNV_1A)
       return fnv_1a_64(begin, end);
+#else
+      return wyhash_64(begin, end);
+#endif
     }
 #endif
 
@@ -43,6 +43,19 @@ SOFTWARE.
 
 namespace tpn
 {
+#if defined(TYPHOON_POOL_TELEMETRY)
+  class pool_telemetry;
+
+  namespace private_pool_telemetry
+  {
+    // Defined in pool_telemetry.hpp, which is included at the end of this file.
+    inline uint32_t start(const tpn::pool_telemetry* p_telemetry);
+    inline void allocated(tpn::pool_telemetry* p_telemetry, const void* p, uint32_t start_cycles);
+    inline void released(tpn::pool_telemetry* p_telemetry, uint32_t start_cycles);
+    inline void released_all(tpn::pool_telemetry* p_telemetry);
+  }
+#endif
+
   //***************************************************************************
   /// The base class for pool exceptions.
   ///\ingroup pool
@@ -250,6 +263,10 @@ namespace tpn
       items_allocated = 0;
       items_initialised = 0;
       p_next = p_buffer;
+
+#if defined(TYPHOON_POOL_TELEMETRY)
+      private_pool_telemetry::released_all(p_telemetry);
+#endif
     }
 
     //*************************************************************************
@@ -313,6 +330,32 @@ namespace tpn
       return items_allocated == Max_Size;
     }
 
+#if defined(TYPHOON_POOL_TELEMETRY)
+    //*************************************************************************
+    /// Attaches telemetry that records the pool's allocations and releases.
+    //*************************************************************************
+    void set_telemetry(tpn::pool_telemetry& telemetry)
+    {
+      p_telemetry = &telemetry;
+    }
+
+    //*************************************************************************
+    /// Detaches the telemetry.
+    //*************************************************************************
+    void clear_telemetry()
+    {
+      p_telemetry = TYPHOON_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns the attached telemetry, or a null pointer.
+    //*************************************************************************
+    const tpn::pool_telemetry* get_telemetry() const
+    {
+      return p_telemetry;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -325,6 +368,9 @@ namespace tpn
       items_initialised(0),
       Item_Size(item_size_),
       Max_Size(max_size_)
+#if defined(TYPHOON_POOL_TELEMETRY)
+      , p_telemetry(TYPHOON_NULLPTR)
+#endif
     {
     }
 
@@ -335,6 +381,10 @@ namespace tpn
     //*************************************************************************
     char* allocate_item()
     {
+#if defined(TYPHOON_POOL_TELEMETRY)
+      const uint32_t start = private_pool_telemetry::start(p_telemetry);
+#endif
+
       char* p_value = TYPHOON_NULLPTR;
 
       // Any free space left?
@@ -366,9 +416,18 @@ namespace tpn
       }
       else
       {
+#if defined(TYPHOON_POOL_TELEMETRY)
+        // Record the failure before the assert can throw.
+        private_pool_telemetry::allocated(p_telemetry, TYPHOON_NULLPTR, start);
+#endif
         TYPHOON_ASSERT(false, TYPHOON_ERROR(pool_no_allocation));
+        return p_value;
       }
 
+#if defined(TYPHOON_POOL_TELEMETRY)
+      private_pool_telemetry::allocated(p_telemetry, p_value, start);
+#endif
+
       return p_value;
     }
 
@@ -377,6 +436,10 @@ namespace tpn
     //*************************************************************************
     void release_item(char* p_value)
     {
+#if defined(TYPHOON_POOL_TELEMETRY)
+      const uint32_t start = private_pool_telemetry::start(p_telemetry);
+#endif
+
       // Does it belong to us?
       TYPHOON_ASSERT(is_item_in_pool(p_value), TYPHOON_ERROR(pool_object_not_in_pool));
 
@@ -394,6 +457,10 @@ namespace tpn
       p_next = p_value;
 
       --items_allocated;
+
+#if defined(TYPHOON_POOL_TELEMETRY)
+      private_pool_telemetry::released(p_telemetry, start);
+#endif
     }
 
     //*************************************************************************
@@ -429,6 +496,10 @@ namespace tpn
     const uint32_t Item_Size;    ///< The size of allocated items.
     const uint32_t Max_Size;     ///< The maximum number of objects that can be allocated.
 
+#if defined(TYPHOON_POOL_TELEMETRY)
+    tpn::pool_telemetry* p_telemetry; ///< Records the allocations and releases, if attached.
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -446,5 +517,9 @@ namespace tpn
   };
 }
 
+#if defined(TYPHOON_POOL_TELEMETRY)
+  #include "pool_telemetry.hpp"
+#endif
+
 #endif
 
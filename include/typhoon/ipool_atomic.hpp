@@ -0,0 +1,610 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2014 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_IPOOL_ATOMIC_HPP
+#define TYPHOON_IPOOL_ATOMIC_HPP
+
+#include "platform.hpp"
+#include "ipool.hpp"
+#include "atomic.hpp"
+#include "error_handler.hpp"
+#include "utility.hpp"
+#include "memory.hpp"
+#include "placement_new.hpp"
+#include "algorithm.hpp"
+
+#include <stdint.h>
+#include <limits.h>
+
+#define TYPHOON_POOL_CPP03_CODE 0
+
+#if TYPHOON_HAS_ATOMIC
+
+namespace tpn
+{
+  //***************************************************************************
+  /// A pool that may be shared by threads and interrupt handlers without a lock.
+  /// The free items form a lock free stack. Its head holds the index of the
+  /// first free item in the low half of a word and a tag in the high half.
+  /// The tag changes on every push and pop, so an allocation that was
+  /// pre-empted between reading the head and swapping it cannot install a
+  /// stale 'next' item (the ABA problem).
+  /// The head is one pointer sized word, so it is lock free wherever pointers
+  /// are. This limits a pool to 65535 items on 32 bit targets.
+  ///\ingroup pool
+  //***************************************************************************
+  class ipool_atomic
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// tpn::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        TYPHOON_ASSERT(false, TYPHOON_ERROR(tpn::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// Returns a null pointer if there are no more free items.
+    /// Unlike checking full() before allocate(), this cannot fail an assert
+    /// when another thread takes the last item in between.
+    //*************************************************************************
+    template <typename T>
+    T* try_allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        TYPHOON_ASSERT(false, TYPHOON_ERROR(tpn::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(take_item());
+    }
+
+#if TYPHOON_CPP11_NOT_SUPPORTED || TYPHOON_POOL_CPP03_CODE || TYPHOON_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// tpn::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// tpn::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(tpn::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        TYPHOON_ASSERT(false, TYPHOON_ERROR(tpn::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an tpn::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      release_item((char*)p);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to 'n' items from the pool in one operation.
+    /// Does not assert when the pool runs out.
+    /// \param items Receives the addresses of the items.
+    /// \param n     The number of items wanted.
+    /// \return The number of items allocated.
+    //*************************************************************************
+    size_t allocate_n(void** items, size_t n)
+    {
+      size_t count = take_free_items(items, n);
+
+      if (count < n)
+      {
+        count += take_unused_items(items + count, n - count);
+      }
+
+      items_allocated.fetch_add(uint32_t(count), tpn::memory_order_relaxed);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Release 'n' items back to the pool in one operation.
+    /// If asserts or exceptions are enabled and an item does not belong to this
+    /// pool then an tpn::pool_object_not_in_pool is thrown.
+    /// \param items The addresses of the items.
+    /// \param n     The number of items.
+    //*************************************************************************
+    void release_n(void* const* items, size_t n)
+    {
+      if (n == 0U)
+      {
+        return;
+      }
+
+      // Link the items together, then push the chain with one exchange.
+      for (size_t i = 0U; i < n; ++i)
+      {
+        TYPHOON_ASSERT(is_item_in_pool(static_cast<const char*>(items[i])), TYPHOON_ERROR(pool_object_not_in_pool));
+
+        if ((i + 1U) < n)
+        {
+          *static_cast<head_type*>(items[i]) = index_of(static_cast<const char*>(items[i + 1U]));
+        }
+      }
+
+      head_type* const p_last = static_cast<head_type*>(items[n - 1U]);
+      const head_type  first  = index_of(static_cast<const char*>(items[0]));
+
+      head_type head = free_head.load(tpn::memory_order_relaxed);
+
+      do
+      {
+        *p_last = head & Max_Items;
+      } while (!free_head.compare_exchange_weak(head, next_head(head, first), tpn::memory_order_release, tpn::memory_order_relaxed));
+
+      items_allocated.fetch_sub(uint32_t(n), tpn::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Release all objects in the pool.
+    /// Not safe to call while any other thread or interrupt may use the pool.
+    //*************************************************************************
+    void release_all()
+    {
+      free_head.store(0U, tpn::memory_order_relaxed);
+      items_initialised.store(0U, tpn::memory_order_relaxed);
+      items_allocated.store(0U, tpn::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* const p_object) const
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      return is_item_in_pool((const char*)p);
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated.load(tpn::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    /// \return <b>true</b> if there are none allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// Due to concurrency, this is a guess.
+    /// \return <b>true</b> if there are none free.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == Max_Size;
+    }
+
+  protected:
+
+    /// The type of the free list head.
+    typedef uintptr_t head_type;
+
+    /// The number of bits of the head that hold the item index.
+    static TYPHOON_CONSTANT size_t Index_Bits = (sizeof(head_type) * CHAR_BIT) / 2U;
+
+    /// The largest number of items that a pool may hold.
+    static TYPHOON_CONSTANT head_type Max_Items = (head_type(1) << Index_Bits) - 1U;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ipool_atomic(char* p_buffer_, uint32_t item_size_, uint32_t max_size_)
+      : p_buffer(p_buffer_),
+      free_head(0U),
+      items_allocated(0U),
+      items_initialised(0U),
+      Item_Size(item_size_),
+      Max_Size(max_size_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocate an item from the pool.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      char* p_value = take_item();
+
+      if (p_value == TYPHOON_NULLPTR)
+      {
+        TYPHOON_ASSERT(false, TYPHOON_ERROR(pool_no_allocation));
+      }
+
+      return p_value;
+    }
+
+    //*************************************************************************
+    /// Take an item from the pool, or return a null pointer if there are none.
+    /// Free items are reused first. When there are none, an item that has
+    /// never been used is taken from the end of the initialised region.
+    //*************************************************************************
+    char* take_item()
+    {
+      head_type head = free_head.load(tpn::memory_order_acquire);
+
+      while (true)
+      {
+        const head_type index = head & Max_Items;
+
+        if (index != 0U)
+        {
+          char* p_value = item_at(index);
+
+          // If another thread pops this item first, 'next' may be stale, but
+          // the tag will have changed and the exchange will fail.
+          const head_type next = *reinterpret_cast<const head_type*>(p_value);
+
+          if (free_head.compare_exchange_weak(head, next_head(head, next), tpn::memory_order_acquire, tpn::memory_order_acquire))
+          {
+            items_allocated.fetch_add(1U, tpn::memory_order_relaxed);
+            return p_value;
+          }
+        }
+        else
+        {
+          uint32_t initialised = items_initialised.load(tpn::memory_order_relaxed);
+
+          if (initialised < Max_Size)
+          {
+            if (items_initialised.compare_exchange_weak(initialised, initialised + 1U, tpn::memory_order_relaxed))
+            {
+              items_allocated.fetch_add(1U, tpn::memory_order_relaxed);
+              return p_buffer + (initialised * Item_Size);
+            }
+          }
+          else
+          {
+            // Every item is in use, unless one was released since the head was read.
+            const head_type latest = free_head.load(tpn::memory_order_acquire);
+
+            if (latest == head)
+            {
+              return TYPHOON_NULLPTR;
+            }
+          }
+
+          head = free_head.load(tpn::memory_order_acquire);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Release an item back to the pool.
+    //*************************************************************************
+    void release_item(char* p_value)
+    {
+      // Does it belong to us?
+      TYPHOON_ASSERT(is_item_in_pool(p_value), TYPHOON_ERROR(pool_object_not_in_pool));
+
+      const head_type index = index_of(p_value);
+
+      head_type head = free_head.load(tpn::memory_order_relaxed);
+
+      do
+      {
+        // Point it to the current free item.
+        *reinterpret_cast<head_type*>(p_value) = head & Max_Items;
+      } while (!free_head.compare_exchange_weak(head, next_head(head, index), tpn::memory_order_release, tpn::memory_order_relaxed));
+
+      items_allocated.fetch_sub(1U, tpn::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Pop up to 'n' items from the free list with one exchange.
+    //*************************************************************************
+    size_t take_free_items(void** items, size_t n)
+    {
+      head_type head = free_head.load(tpn::memory_order_acquire);
+
+      while (true)
+      {
+        size_t    count = 0U;
+        head_type next  = head & Max_Items;
+
+        // The links may be stale if another thread pops the items first, so a
+        // link that is out of range ends the walk. The exchange then fails.
+        while ((next != 0U) && (next <= Max_Size) && (count < n))
+        {
+          char* p_value = item_at(next);
+          items[count++] = p_value;
+          next = *reinterpret_cast<const head_type*>(p_value);
+        }
+
+        if (count == 0U)
+        {
+          return 0U;
+        }
+
+        if (free_head.compare_exchange_weak(head, next_head(head, next), tpn::memory_order_acquire, tpn::memory_order_acquire))
+        {
+          return count;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Take up to 'n' items that have never been used.
+    //*************************************************************************
+    size_t take_unused_items(void** items, size_t n)
+    {
+      uint32_t initialised = items_initialised.load(tpn::memory_order_relaxed);
+
+      while (initialised < Max_Size)
+      {
+        const uint32_t count = uint32_t(tpn::min(n, size_t(Max_Size - initialised)));
+
+        if (items_initialised.compare_exchange_weak(initialised, initialised + count, tpn::memory_order_relaxed))
+        {
+          for (uint32_t i = 0U; i < count; ++i)
+          {
+            items[i] = p_buffer + ((initialised + i) * Item_Size);
+          }
+
+          return count;
+        }
+      }
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// The head that makes 'index' the first free item.
+    //*************************************************************************
+    static head_type next_head(head_type head, head_type index)
+    {
+      return (((head >> Index_Bits) + 1U) << Index_Bits) | index;
+    }
+
+    //*************************************************************************
+    /// The item with the one based index.
+    //*************************************************************************
+    char* item_at(head_type index) const
+    {
+      return p_buffer + ((index - 1U) * Item_Size);
+    }
+
+    //*************************************************************************
+    /// The one based index of the item.
+    //*************************************************************************
+    head_type index_of(const char* p_value) const
+    {
+      return head_type((p_value - p_buffer) / Item_Size) + 1U;
+    }
+
+    //*************************************************************************
+    /// Check if the item belongs to this pool.
+    //*************************************************************************
+    bool is_item_in_pool(const char* p) const
+    {
+      // Within the range of the buffer?
+      intptr_t distance = p - p_buffer;
+      bool is_within_range = (distance >= 0) && (distance <= intptr_t((Item_Size * Max_Size) - Item_Size));
+
+      // Modulus and division can be slow on some architectures, so only do this in debug.
+#if TYPHOON_IS_DEBUG_BUILD
+      // Is the address on a valid object boundary?
+      bool is_valid_address = ((distance % Item_Size) == 0);
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+    // Disable copy construction and assignment.
+    ipool_atomic(const ipool_atomic&);
+    ipool_atomic& operator =(const ipool_atomic&);
+
+    char* p_buffer;
+
+    tpn::atomic<head_type> free_head;         ///< The first free item and the tag.
+    tpn::atomic<uint32_t>  items_allocated;   ///< The number of items allocated.
+    tpn::atomic<uint32_t>  items_initialised; ///< The number of items that have been used at least once.
+
+    const uint32_t Item_Size;    ///< The size of allocated items.
+    const uint32_t Max_Size;     ///< The maximum number of objects that can be allocated.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(TYPHOON_POLYMORPHIC_POOL) || defined(TYPHOON_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ipool_atomic()
+    {
+    }
+#else
+  protected:
+    ~ipool_atomic()
+    {
+    }
+#endif
+  };
+}
+
+#endif
+
+#endif
@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.hpp"
 #include "functional.hpp"
 #include "type_traits.hpp"
+#include "span.hpp"
+#include "private/statistics.hpp"
 
 #include <math.h>
 #include <stdint.h>
@@ -112,6 +114,28 @@ namespace tpn
       recalculate = true;
     }
 
+    //*********************************
+    /// Add a contiguous block of values.
+    /// Floating point values are summed a vector at a time.
+    //*********************************
+    void add(tpn::span<const TInput> values)
+    {
+      sum         += private_statistics::sum<calc_t>(values.data(), values.size());
+      counter     += uint32_t(values.size());
+      recalculate  = true;
+    }
+
+    //*********************************
+    /// Add the values from another mean,
+    /// as if they had been added to this one.
+    //*********************************
+    void merge(const mean& other)
+    {
+      sum         += other.sum;
+      counter     += other.counter;
+      recalculate  = true;
+    }
+
     //*********************************
     /// Add a range.
     //*********************************
@@ -248,6 +248,56 @@ namespace tpn
       }
     }
 
+    //*******************************************
+    /// Passes a batch of messages to the subscribers.
+    /// Each subscriber is passed the messages it subscribed to as batches,
+    /// in order, before the next subscriber is passed any.
+    /// The messages are not shared, so a tpn::queued_message_router cannot
+    /// take them and emits a 'not shared' error. Do not batch to one.
+    //*******************************************
+    virtual void receive_batch(tpn::span<const tpn::imessage* const> messages) TYPHOON_OVERRIDE
+    {
+      // Scan the subscription lists.
+      subscription* sub = static_cast<subscription*>(head.get_next());
+
+      while (sub != TYPHOON_NULLPTR)
+      {
+        message_id_span_t message_ids = sub->message_id_list();
+        tpn::imessage_router& router  = *sub->get_router();
+
+        const size_t size  = messages.size();
+        size_t       first = 0U;
+
+        while (first != size)
+        {
+          size_t last = first;
+
+          while ((last != size) && (tpn::find(message_ids.begin(), message_ids.end(), messages[last]->get_message_id()) != message_ids.end()))
+          {
+            ++last;
+          }
+
+          if (last != first)
+          {
+            router.receive_batch(messages.subspan(first, last - first));
+            first = last;
+          }
+          else
+          {
+            ++first;
+          }
+        }
+
+        sub = sub->next_subscription();
+      }
+
+      // Always pass the messages on to the successor.
+      if (has_successor())
+      {
+        get_successor().receive_batch(messages);
+      }
+    }
+
     using imessage_router::accepts;
 
     //*******************************************
@@ -38,6 +38,7 @@ SOFTWARE.
 #include "message_types.hpp"
 #include "message.hpp"
 #include "message_router.hpp"
+#include "span.hpp"
 
 #include <stdint.h>
 
@@ -152,7 +153,11 @@ namespace tpn
     //*******************************************
     virtual void receive(tpn::shared_message   shared_msg) TYPHOON_OVERRIDE
     {
+#if TYPHOON_USING_CPP11
+      receive(tpn::imessage_router::ALL_MESSAGE_ROUTERS, tpn::move(shared_msg));
+#else
       receive(tpn::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg);
+#endif
     }
 
     //********************************************
@@ -315,6 +320,30 @@ namespace tpn
       }
     }
 
+    //*******************************************
+    /// Broadcasts a batch of messages to all routers.
+    /// Each router is passed the messages it accepts as batches, in order,
+    /// before the next router is passed any.
+    /// The messages are not shared, so a tpn::queued_message_router cannot
+    /// take them and emits a 'not shared' error. Do not batch to one.
+    //*******************************************
+    virtual void receive_batch(tpn::span<const tpn::imessage* const> messages) TYPHOON_OVERRIDE
+    {
+      router_list_t::iterator irouter = router_list.begin();
+
+      while (irouter != router_list.end())
+      {
+        receive_accepted(**irouter, messages);
+
+        ++irouter;
+      }
+
+      if (has_successor())
+      {
+        receive_accepted(get_successor(), messages);
+      }
+    }
+
     using imessage_router::accepts;
 
     //*******************************************
@@ -394,6 +423,35 @@ namespace tpn
       }
     };
 
+    //*******************************************
+    /// Passes each run of messages that the router accepts as one batch.
+    //*******************************************
+    static void receive_accepted(tpn::imessage_router& router, tpn::span<const tpn::imessage* const> messages)
+    {
+      const size_t size  = messages.size();
+      size_t       first = 0U;
+
+      while (first != size)
+      {
+        size_t last = first;
+
+        while ((last != size) && router.accepts(messages[last]->get_message_id()))
+        {
+          ++last;
+        }
+
+        if (last != first)
+        {
+          router.receive_batch(messages.subspan(first, last - first));
+          first = last;
+        }
+        else
+        {
+          ++first;
+        }
+      }
+    }
+
     router_list_t& router_list;
   };
 
@@ -84,17 +84,17 @@ namespace tpn
   public:
 
     //********************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
     /// 
     //********************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename T>
     explicit message_packet(T&& msg)
       : valid(true)
@@ -126,7 +126,7 @@ namespace tpn
         TYPHOON_STATIC_ASSERT(IsInMessageList<T>, "Message not in packet type list");
       }
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //**********************************************
     void copy(const message_packet& other)
@@ -334,15 +334,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -357,11 +357,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -376,12 +376,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, int>::type>
@@ -395,10 +395,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -412,11 +412,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -425,11 +425,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -438,7 +438,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -625,15 +625,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -648,11 +648,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -667,12 +667,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, int>::type>
@@ -686,10 +686,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -703,11 +703,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -716,11 +716,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -729,7 +729,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -914,15 +914,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -937,11 +937,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -956,12 +956,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, int>::type>
@@ -975,10 +975,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -992,11 +992,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -1005,11 +1005,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -1018,7 +1018,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -1201,15 +1201,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -1224,11 +1224,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -1243,12 +1243,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, int>::type>
@@ -1262,10 +1262,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -1279,11 +1279,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -1292,11 +1292,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -1305,7 +1305,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -1485,15 +1485,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -1508,11 +1508,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -1527,12 +1527,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, int>::type>
@@ -1546,10 +1546,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -1563,11 +1563,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -1576,11 +1576,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -1589,7 +1589,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -1764,15 +1764,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -1787,11 +1787,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -1806,12 +1806,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, int>::type>
@@ -1825,10 +1825,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -1842,11 +1842,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -1855,11 +1855,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -1868,7 +1868,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -2041,15 +2041,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -2064,11 +2064,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -2083,12 +2083,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, int>::type>
@@ -2102,10 +2102,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -2119,11 +2119,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -2132,11 +2132,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -2145,7 +2145,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -2316,15 +2316,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -2339,11 +2339,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -2358,12 +2358,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, int>::type>
@@ -2377,10 +2377,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8, T9> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -2394,11 +2394,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -2407,11 +2407,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -2420,7 +2420,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -2588,15 +2588,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -2611,11 +2611,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -2630,12 +2630,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8>::value, int>::type>
@@ -2649,10 +2649,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7, T8> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -2666,11 +2666,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -2679,11 +2679,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -2692,7 +2692,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -2855,15 +2855,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -2878,11 +2878,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -2897,12 +2897,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6, T7>::value, int>::type>
@@ -2916,10 +2916,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6, T7> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -2933,11 +2933,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -2946,11 +2946,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -2959,7 +2959,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -3120,15 +3120,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -3143,11 +3143,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -3162,12 +3162,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5, T6>::value, int>::type>
@@ -3181,10 +3181,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5, T6> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -3198,11 +3198,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -3211,11 +3211,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -3224,7 +3224,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -3383,15 +3383,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -3406,11 +3406,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -3425,12 +3425,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4, T5>::value, int>::type>
@@ -3444,10 +3444,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4, T5> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -3461,11 +3461,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -3474,11 +3474,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -3487,7 +3487,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -3643,15 +3643,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -3666,11 +3666,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -3685,12 +3685,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3, T4>::value, int>::type>
@@ -3704,10 +3704,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3, T4> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -3721,11 +3721,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -3734,11 +3734,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -3747,7 +3747,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -3898,15 +3898,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -3921,11 +3921,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -3940,12 +3940,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2, T3>::value, int>::type>
@@ -3959,10 +3959,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2, T3> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -3976,11 +3976,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -3989,11 +3989,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -4002,7 +4002,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -4151,15 +4151,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -4174,11 +4174,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -4193,12 +4193,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1, T2>::value, int>::type>
@@ -4212,10 +4212,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1, T2> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -4229,11 +4229,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -4242,11 +4242,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -4255,7 +4255,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
@@ -4402,15 +4402,15 @@ namespace tpn
   public:
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet()
       : valid(false)
     {
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(const tpn::imessage& msg)
     {
       if (accepts(msg))
@@ -4425,11 +4425,11 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     explicit message_packet(tpn::imessage&& msg)
     {
       if (accepts(msg))
@@ -4444,12 +4444,12 @@ namespace tpn
 
       TYPHOON_ASSERT(valid, TYPHOON_ERROR(unhandled_message_exception));
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION) && !defined(TYPHOON_COMPILER_GREEN_HILLS)
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage, typename = typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1> >::value &&
                                                                     !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
                                                                     !tpn::is_one_of<typename tpn::remove_reference<TMessage>::type, T1>::value, int>::type>
@@ -4463,10 +4463,10 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #else
     //********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename TMessage>
     explicit message_packet(const TMessage& /*msg*/, typename tpn::enable_if<!tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::message_packet<T1> >::value &&
                                                                          !tpn::is_same<typename tpn::remove_reference<TMessage>::type, tpn::imessage>::value &&
@@ -4480,11 +4480,11 @@ namespace tpn
 
       TYPHOON_STATIC_ASSERT(Enabled, "Message not in packet type list");
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(const message_packet& other)
       : valid(other.is_valid())
     {
@@ -4493,11 +4493,11 @@ namespace tpn
         add_new_message(other.get());
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
 
   #if TYPHOON_USING_CPP11 && !defined(TYPHOON_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION)
     //**********************************************
-  #include "tpn/private/diagnostic_uninitialized_push.hpp"
+  #include "typhoon/private/diagnostic_uninitialized_push.hpp"
     message_packet(message_packet&& other)
       : valid(other.is_valid())
     {
@@ -4506,7 +4506,7 @@ namespace tpn
         add_new_message(tpn::move(other.get()));
       }
     }
-  #include "tpn/private/diagnostic_pop.hpp"
+  #include "typhoon/private/diagnostic_pop.hpp"
   #endif
 
     //**********************************************
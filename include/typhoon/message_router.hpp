@@ -64,6 +64,8 @@ SOFTWARE.
 #include "placement_new.hpp"
 #include "successor.hpp"
 #include "type_traits.hpp"
+#include "smallest.hpp"
+#include "span.hpp"
 
 #include <stdint.h>
 
@@ -136,7 +138,24 @@ namespace tpn
     {
       if ((destination_router_id == get_message_router_id()) || (destination_router_id == imessage_router::ALL_MESSAGE_ROUTERS))
       {
+#if TYPHOON_USING_CPP11
+        receive(tpn::move(shared_msg));
+#else
         receive(shared_msg);
+#endif
+      }
+    }
+
+    //********************************************
+    /// Receives a batch of messages, in order.
+    /// Routers that can dispatch a batch more cheaply than one message at a
+    /// time override this.
+    //********************************************
+    virtual void receive_batch(tpn::span<const tpn::imessage* const> messages)
+    {
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        receive(*messages[i]);
       }
     }
 
@@ -382,6 +401,242 @@ namespace tpn
 // For C++17 and above.
 //*************************************************************************************************
 #if TYPHOON_USING_CPP17 && !defined(TYPHOON_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// Compile time lookup from message id to the index of the message type
+    /// in the router's type list.
+    /// Uses a jump table indexed by id when at least half of the id range is
+    /// handled, otherwise a binary search over the sorted ids.
+    /// Membership is tested with a bitmap when the id range is small.
+    //*************************************************************************
+    template <typename... TMessageTypes>
+    class message_id_lookup
+    {
+    public:
+
+      static constexpr size_t Size = sizeof...(TMessageTypes);
+
+      /// Returned by index_of when the id is not handled.
+      static constexpr size_t Not_Found = Size;
+
+    private:
+
+      typedef typename tpn::smallest_uint_for_value<Size>::type index_type;
+
+      static constexpr tpn::message_id_t ids[Size] = { tpn::message_id_t(TMessageTypes::ID)... };
+
+      //*******************************************
+      static constexpr tpn::message_id_t min_id()
+      {
+        tpn::message_id_t result = ids[0];
+
+        for (size_t i = 1U; i < Size; ++i)
+        {
+          result = (ids[i] < result) ? ids[i] : result;
+        }
+
+        return result;
+      }
+
+      //*******************************************
+      static constexpr tpn::message_id_t max_id()
+      {
+        tpn::message_id_t result = ids[0];
+
+        for (size_t i = 1U; i < Size; ++i)
+        {
+          result = (ids[i] > result) ? ids[i] : result;
+        }
+
+        return result;
+      }
+
+    public:
+
+      static constexpr tpn::message_id_t Min_Id = min_id();
+      static constexpr tpn::message_id_t Max_Id = max_id();
+      static constexpr size_t            Range  = size_t(Max_Id - Min_Id) + 1U;
+
+      static constexpr bool Use_Jump_Table = (Range <= (2U * Size));
+      static constexpr bool Use_Bitmap     = (Range <= 256U);
+
+    private:
+
+      static constexpr size_t Bitmap_Words = Use_Bitmap ? ((Range + 31U) / 32U) : 1U;
+      static constexpr size_t Jump_Size    = Use_Jump_Table ? Range : 1U;
+      static constexpr size_t Sorted_Size  = Use_Jump_Table ? 1U : Size;
+
+      //*******************************************
+      struct bitmap_t
+      {
+        uint32_t words[Bitmap_Words];
+      };
+
+      struct jump_table_t
+      {
+        index_type index[Jump_Size];
+      };
+
+      struct sorted_table_t
+      {
+        tpn::message_id_t id[Sorted_Size];
+        index_type        index[Sorted_Size];
+      };
+
+      //*******************************************
+      static constexpr bitmap_t make_bitmap()
+      {
+        bitmap_t bitmap = {};
+
+        if (Use_Bitmap)
+        {
+          for (size_t i = 0U; i < Size; ++i)
+          {
+            const size_t bit = size_t(ids[i] - Min_Id);
+            bitmap.words[bit / 32U] |= (uint32_t(1U) << (bit % 32U));
+          }
+        }
+
+        return bitmap;
+      }
+
+      //*******************************************
+      static constexpr jump_table_t make_jump_table()
+      {
+        jump_table_t table = {};
+
+        if (Use_Jump_Table)
+        {
+          for (size_t i = 0U; i < Range; ++i)
+          {
+            table.index[i] = index_type(Not_Found);
+          }
+
+          // Iterate backwards so that the first type with a duplicated id wins.
+          for (size_t i = Size; i-- > 0U;)
+          {
+            table.index[size_t(ids[i] - Min_Id)] = index_type(i);
+          }
+        }
+
+        return table;
+      }
+
+      //*******************************************
+      static constexpr sorted_table_t make_sorted_table()
+      {
+        sorted_table_t table = {};
+
+        if (!Use_Jump_Table)
+        {
+          // Stable insertion sort, so that the first type with a duplicated id is found first.
+          for (size_t i = 0U; i < Size; ++i)
+          {
+            size_t j = i;
+
+            while ((j > 0U) && (table.id[j - 1U] > ids[i]))
+            {
+              table.id[j]    = table.id[j - 1U];
+              table.index[j] = table.index[j - 1U];
+              --j;
+            }
+
+            table.id[j]    = ids[i];
+            table.index[j] = index_type(i);
+          }
+        }
+
+        return table;
+      }
+
+      static constexpr bitmap_t       bitmap       = make_bitmap();
+      static constexpr jump_table_t   jump_table   = make_jump_table();
+      static constexpr sorted_table_t sorted_table = make_sorted_table();
+
+    public:
+
+      //*******************************************
+      /// Returns the index of the first message type with this id, or Not_Found.
+      //*******************************************
+      static size_t index_of(tpn::message_id_t id)
+      {
+        if constexpr (Use_Jump_Table)
+        {
+          // Ids below Min_Id wrap to a large value.
+          const size_t offset = size_t(id) - size_t(Min_Id);
+
+          return (offset < Range) ? size_t(jump_table.index[offset]) : Not_Found;
+        }
+        else
+        {
+          size_t first = 0U;
+          size_t count = Size;
+
+          while (count > 0U)
+          {
+            const size_t step = count / 2U;
+
+            if (sorted_table.id[first + step] < id)
+            {
+              first += step + 1U;
+              count -= step + 1U;
+            }
+            else
+            {
+              count = step;
+            }
+          }
+
+          return ((first < Size) && (sorted_table.id[first] == id)) ? size_t(sorted_table.index[first]) : Not_Found;
+        }
+      }
+
+      //*******************************************
+      /// Returns true if a message type with this id is in the list.
+      //*******************************************
+      static bool contains(tpn::message_id_t id)
+      {
+        if constexpr (Use_Bitmap)
+        {
+          const size_t offset = size_t(id) - size_t(Min_Id);
+
+          return (offset < Range) && ((bitmap.words[offset / 32U] & (uint32_t(1U) << (offset % 32U))) != 0U);
+        }
+        else
+        {
+          return index_of(id) != Not_Found;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// A router with no message types handles no ids.
+    //*************************************************************************
+    template <>
+    class message_id_lookup<>
+    {
+    public:
+
+      static constexpr size_t Size = 0U;
+
+      /// Returned by index_of when the id is not handled.
+      static constexpr size_t Not_Found = Size;
+
+      //*******************************************
+      static size_t index_of(tpn::message_id_t)
+      {
+        return Not_Found;
+      }
+
+      //*******************************************
+      static bool contains(tpn::message_id_t)
+      {
+        return false;
+      }
+    };
+  }
+
   //***************************************************************************
   // The definition for all message types.
   //***************************************************************************
@@ -423,17 +678,66 @@ namespace tpn
 
     void receive(const tpn::imessage& msg) TYPHOON_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
-
-      if (!was_handled)
+      if constexpr (lookup_t::Size != 0U)
       {
-        if (has_successor())
+        const size_t index = lookup_t::index_of(msg.get_message_id());
+
+        if (index != lookup_t::Not_Found)
         {
-          get_successor().receive(msg);
+          static constexpr handler_t handlers[] = { &message_router::template receive_message_type<TMessageTypes>... };
+
+          handlers[index](*this, msg);
+          return;
         }
-        else
+      }
+
+      if (has_successor())
+      {
+        get_successor().receive(msg);
+      }
+      else
+      {
+        static_cast<TDerived*>(this)->on_receive_unknown(msg);
+      }
+    }
+
+    //**********************************************
+    /// Looks up the handler once for each run of messages with the same id.
+    //**********************************************
+    void receive_batch(tpn::span<const tpn::imessage* const> messages) TYPHOON_OVERRIDE
+    {
+      if constexpr (lookup_t::Size == 0U)
+      {
+        // Nothing is handled here, so each message goes on as it would alone.
+        imessage_router::receive_batch(messages);
+      }
+      else
+      {
+        static constexpr handler_t handlers[] = { &message_router::template receive_message_type<TMessageTypes>... };
+
+        const tpn::imessage* const* p_msg = messages.data();
+        const tpn::imessage* const* const p_end = messages.data() + messages.size();
+
+        while (p_msg != p_end)
         {
-          static_cast<TDerived*>(this)->on_receive_unknown(msg);
+          const tpn::message_id_t id    = (*p_msg)->get_message_id();
+          const size_t            index = lookup_t::index_of(id);
+
+          if (index != lookup_t::Not_Found)
+          {
+            const handler_t handler = handlers[index];
+
+            do
+            {
+              handler(*this, **p_msg);
+              ++p_msg;
+            } while ((p_msg != p_end) && ((*p_msg)->get_message_id() == id));
+          }
+          else
+          {
+            receive(**p_msg);
+            ++p_msg;
+          }
         }
       }
     }
@@ -463,7 +767,21 @@ namespace tpn
 
     bool accepts(tpn::message_id_t id) const TYPHOON_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      if (lookup_t::contains(id))
+      {
+        return true;
+      }
+      else
+      {
+        if (has_successor())
+        {
+          return get_successor().accepts(id);
+        }
+        else
+        {
+          return false;
+        }
+      }
     }
 
     //********************************************
@@ -486,40 +804,15 @@ namespace tpn
 
   private:
 
-    //********************************************
-    template <typename TMessage>
-    bool receive_message_type(const tpn::imessage& msg)
-    {
-      if (TMessage::ID == msg.get_message_id())
-      {
-        static_cast<TDerived*>(this)->on_receive(static_cast<const TMessage&>(msg));
-        return true;
-      }
-      else
-      {
-        return false;
-      }
-    }
+    typedef private_message_router::message_id_lookup<TMessageTypes...> lookup_t;
+
+    typedef void (*handler_t)(message_router&, const tpn::imessage&);
 
     //********************************************
     template <typename TMessage>
-    bool accepts_type(tpn::message_id_t id) const
+    static void receive_message_type(message_router& router, const tpn::imessage& msg)
     {
-      if (TMessage::ID == id)
-      {
-        return true;
-      }
-      else
-      {
-        if (has_successor())
-        {
-          return get_successor().accepts(id);
-        }
-        else
-        {
-          return false;
-        }
-      }
+      static_cast<TDerived&>(router).on_receive(static_cast<const TMessage&>(msg));
     }
   };
 #else
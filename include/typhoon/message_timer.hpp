@@ -37,6 +37,7 @@ SOFTWARE.
 #include "message_bus.hpp"
 #include "static_assert.hpp"
 #include "timer.hpp"
+#include "timer_list.hpp"
 #include "atomic.hpp"
 #include "algorithm.hpp"
 
@@ -147,191 +148,13 @@ namespace tpn
     message_timer_data& operator =(const message_timer_data& other);
   };
 
-  namespace private_message_timer
-  {
-    //*************************************************************************
-    /// A specialised intrusive linked list for timer data.
-    //*************************************************************************
-    class list
-    {
-    public:
-
-      //*******************************
-      list(tpn::message_timer_data* ptimers_)
-        : head(tpn::timer::id::NO_TIMER),
-          tail(tpn::timer::id::NO_TIMER),
-          current(tpn::timer::id::NO_TIMER),
-          ptimers(ptimers_)
-      {
-      }
-
-      //*******************************
-      bool empty() const
-      {
-        return head == tpn::timer::id::NO_TIMER;
-      }
-
-      //*******************************
-      // Inserts the timer at the correct delta position
-      //*******************************
-      void insert(tpn::timer::id::type id_)
-      {
-        tpn::message_timer_data& timer = ptimers[id_];
-
-        if (head == tpn::timer::id::NO_TIMER)
-        {
-          // No entries yet.
-          head = id_;
-          tail = id_;
-          timer.previous = tpn::timer::id::NO_TIMER;
-          timer.next     = tpn::timer::id::NO_TIMER;
-        }
-        else
-        {
-          // We already have entries.
-          tpn::timer::id::type test_id = begin();
-
-          while (test_id != tpn::timer::id::NO_TIMER)
-          {
-            tpn::message_timer_data& test = ptimers[test_id];
-
-            // Find the correct place to insert.
-            if (timer.delta <= test.delta)
-            {
-              if (test.id == head)
-              {
-                head = timer.id;
-              }
-
-              // Insert before test.
-              timer.previous = test.previous;
-              test.previous  = timer.id;
-              timer.next     = test.id;
-
-              // Adjust the next delta to compensate.
-              test.delta -= timer.delta;
-
-              if (timer.previous != tpn::timer::id::NO_TIMER)
-              {
-                ptimers[timer.previous].next = timer.id;
-              }
-              break;
-            }
-            else
-            {
-              timer.delta -= test.delta;
-            }
-
-            test_id = next(test_id);
-          }
-
-          // Reached the end?
-          if (test_id == tpn::timer::id::NO_TIMER)
-          {
-            // Tag on to the tail.
-            ptimers[tail].next = timer.id;
-            timer.previous     = tail;
-            timer.next         = tpn::timer::id::NO_TIMER;
-            tail               = timer.id;
-          }
-        }
-      }
-
-      //*******************************
-      void remove(tpn::timer::id::type id_, bool has_expired)
-      {
-        tpn::message_timer_data& timer = ptimers[id_];
-
-        if (head == id_)
-        {
-          head = timer.next;
-        }
-        else
-        {
-          ptimers[timer.previous].next = timer.next;
-        }
-
-        if (tail == id_)
-        {
-          tail = timer.previous;
-        }
-        else
-        {
-          ptimers[timer.next].previous = timer.previous;
-        }
-
-        if (!has_expired)
-        {
-          // Adjust the next delta.
-          if (timer.next != tpn::timer::id::NO_TIMER)
-          {
-            ptimers[timer.next].delta += timer.delta;
-          }
-        }
-
-        timer.previous = tpn::timer::id::NO_TIMER;
-        timer.next     = tpn::timer::id::NO_TIMER;
-        timer.delta    = tpn::timer::state::INACTIVE;
-      }
-
-      //*******************************
-      tpn::message_timer_data& front()
-      {
-        return ptimers[head];
-      }
-
-      //*******************************
-      tpn::timer::id::type begin()
-      {
-        current = head;
-        return current;
-      }
-
-      //*******************************
-      tpn::timer::id::type previous(tpn::timer::id::type last)
-      {
-        current = ptimers[last].previous;
-        return current;
-      }
-
-      //*******************************
-      tpn::timer::id::type next(tpn::timer::id::type last)
-      {
-        current = ptimers[last].next;
-        return current;
-      }
-
-      //*******************************
-      void clear()
-      {
-        tpn::timer::id::type id = begin();
-
-        while (id != tpn::timer::id::NO_TIMER)
-        {
-          tpn::message_timer_data& timer = ptimers[id];
-          id = next(id);
-          timer.next = tpn::timer::id::NO_TIMER;
-        }
-
-        head    = tpn::timer::id::NO_TIMER;
-        tail    = tpn::timer::id::NO_TIMER;
-        current = tpn::timer::id::NO_TIMER;
-      }
-
-    private:
-
-      tpn::timer::id::type head;
-      tpn::timer::id::type tail;
-      tpn::timer::id::type current;
-
-      tpn::message_timer_data* const ptimers;
-    };
-  }
-
   //***************************************************************************
   /// Interface for message timer
+  /// TTimerList is the active timer list policy.
+  /// See tpn::timer_delta_list and tpn::timer_wheel.
   //***************************************************************************
-  class imessage_timer
+  template <typename TTimerList>
+  class ibasic_message_timer
   {
   public:
 
@@ -449,38 +272,24 @@ namespace tpn
       {
         if (TYPHOON_TIMER_UPDATES_ENABLED)
         {
-          // We have something to do?
-          bool has_active = !active_list.empty();
+          tpn::timer::id::type id = active_list.next_expired(count);
 
-          if (has_active)
+          while (id != tpn::timer::id::NO_TIMER)
           {
-            while (has_active && (count >= active_list.front().delta))
-            {
-              tpn::message_timer_data& timer = active_list.front();
-
-              count -= timer.delta;
-
-              active_list.remove(timer.id, true);
-
-              if (timer.repeating)
-              {
-                timer.delta = timer.period;
-                active_list.insert(timer.id);
-              }
-
-              if (timer.p_router != TYPHOON_NULLPTR)
-              {
-                timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
-              }
+            tpn::message_timer_data& timer = timer_array[id];
 
-              has_active = !active_list.empty();
+            if (timer.repeating)
+            {
+              timer.delta = timer.period;
+              active_list.insert(timer.id);
             }
 
-            if (has_active)
+            if (timer.p_router != TYPHOON_NULLPTR)
             {
-              // Subtract any remainder from the next due timeout.
-              active_list.front().delta -= count;
+              timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
             }
+
+            id = active_list.next_expired(count);
           }
 
           return true;
@@ -588,7 +397,7 @@ namespace tpn
     //*******************************************
     /// Constructor.
     //*******************************************
-    imessage_timer(message_timer_data* const timer_array_, const uint_least8_t  MAX_TIMERS_)
+    ibasic_message_timer(message_timer_data* const timer_array_, const uint_least8_t  MAX_TIMERS_)
       : timer_array(timer_array_),
         active_list(timer_array_),
         enabled(false),
@@ -603,7 +412,7 @@ namespace tpn
     //*******************************************
     /// Destructor.
     //*******************************************
-    ~imessage_timer()
+    ~ibasic_message_timer()
     {
     }
 
@@ -613,7 +422,7 @@ namespace tpn
     message_timer_data* const timer_array;
 
     // The list of active timers.
-    private_message_timer::list active_list;
+    typename TTimerList::template list<tpn::message_timer_data> active_list;
 
     volatile bool enabled;
 
@@ -638,11 +447,16 @@ namespace tpn
     const uint_least8_t MAX_TIMERS;
   };
 
+  //***************************************************************************
+  /// Interface for message timer using the delta list.
+  //***************************************************************************
+  typedef tpn::ibasic_message_timer<tpn::timer_delta_list> imessage_timer;
+
   //***************************************************************************
   /// The message timer
   //***************************************************************************
-  template <uint_least8_t MAX_TIMERS_>
-  class message_timer : public tpn::imessage_timer
+  template <uint_least8_t MAX_TIMERS_, typename TTimerList = tpn::timer_delta_list>
+  class message_timer : public tpn::ibasic_message_timer<TTimerList>
   {
   public:
 
@@ -652,7 +466,7 @@ namespace tpn
     /// Constructor.
     //*******************************************
     message_timer()
-      : imessage_timer(timer_array, MAX_TIMERS_)
+      : tpn::ibasic_message_timer<TTimerList>(timer_array, MAX_TIMERS_)
     {
     }
 
@@ -37,6 +37,7 @@ SOFTWARE.
 #include "message_bus.hpp"
 #include "static_assert.hpp"
 #include "timer.hpp"
+#include "timer_list.hpp"
 #include "delegate.hpp"
 #include "algorithm.hpp"
 
@@ -47,7 +48,7 @@ namespace tpn
   //***************************************************************************
   /// Interface for message timer
   //***************************************************************************
-  template <typename TInterruptGuard>
+  template <typename TInterruptGuard, typename TTimerList = tpn::timer_delta_list>
   class imessage_timer_interrupt
   {
   public:
@@ -175,39 +176,25 @@ namespace tpn
     {
       if (enabled)
       {
-        // We have something to do?
-        bool has_active = !active_list.empty();
+        tpn::timer::id::type id = active_list.next_expired(count);
 
-        if (has_active)
+        while (id != tpn::timer::id::NO_TIMER)
         {
-          while (has_active && (count >= active_list.front().delta))
-          {
-            timer_data& timer = active_list.front();
-
-            count -= timer.delta;
-
-            active_list.remove(timer.id, true);
-
-            if (timer.p_router != TYPHOON_NULLPTR)
-            {
-              timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
-            }
-
-            if (timer.repeating)
-            {
-              // Reinsert the timer.
-              timer.delta = timer.period;
-              active_list.insert(timer.id);
-            }
+          timer_data& timer = timer_array[id];
 
-            has_active = !active_list.empty();
+          if (timer.p_router != TYPHOON_NULLPTR)
+          {
+            timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
           }
 
-          if (has_active)
+          if (timer.repeating)
           {
-            // Subtract any remainder from the next due timeout.
-            active_list.front().delta -= count;
+            // Reinsert the timer.
+            timer.delta = timer.period;
+            active_list.insert(timer.id);
           }
+
+          id = active_list.next_expired(count);
         }
 
         return true;
@@ -404,189 +391,11 @@ namespace tpn
 
   private:
 
-    //*************************************************************************
-    /// A specialised intrusive linked list for timer data.
-    //*************************************************************************
-    class timer_list
-    {
-    public:
-
-      //*******************************
-      timer_list(timer_data* ptimers_)
-        : head(tpn::timer::id::NO_TIMER)
-        , tail(tpn::timer::id::NO_TIMER)
-        , current(tpn::timer::id::NO_TIMER)
-        , ptimers(ptimers_)
-      {
-      }
-
-      //*******************************
-      bool empty() const
-      {
-        return head == tpn::timer::id::NO_TIMER;
-      }
-
-      //*******************************
-      // Inserts the timer at the correct delta position
-      //*******************************
-      void insert(tpn::timer::id::type id_)
-      {
-        timer_data& timer = ptimers[id_];
-
-        if (head == tpn::timer::id::NO_TIMER)
-        {
-          // No entries yet.
-          head = id_;
-          tail = id_;
-          timer.previous = tpn::timer::id::NO_TIMER;
-          timer.next = tpn::timer::id::NO_TIMER;
-        }
-        else
-        {
-          // We already have entries.
-          tpn::timer::id::type test_id = begin();
-
-          while (test_id != tpn::timer::id::NO_TIMER)
-          {
-            timer_data& test = ptimers[test_id];
-
-            // Find the correct place to insert.
-            if (timer.delta <= test.delta)
-            {
-              if (test.id == head)
-              {
-                head = timer.id;
-              }
-
-              // Insert before test.
-              timer.previous = test.previous;
-              test.previous = timer.id;
-              timer.next = test.id;
-
-              // Adjust the next delta to compensate.
-              test.delta -= timer.delta;
-
-              if (timer.previous != tpn::timer::id::NO_TIMER)
-              {
-                ptimers[timer.previous].next = timer.id;
-              }
-              break;
-            }
-            else
-            {
-              timer.delta -= test.delta;
-            }
-
-            test_id = next(test_id);
-          }
-
-          // Reached the end?
-          if (test_id == tpn::timer::id::NO_TIMER)
-          {
-            // Tag on to the tail.
-            ptimers[tail].next = timer.id;
-            timer.previous = tail;
-            timer.next = tpn::timer::id::NO_TIMER;
-            tail = timer.id;
-          }
-        }
-      }
-
-      //*******************************
-      void remove(tpn::timer::id::type id_, bool has_expired)
-      {
-        timer_data& timer = ptimers[id_];
-
-        if (head == id_)
-        {
-          head = timer.next;
-        }
-        else
-        {
-          ptimers[timer.previous].next = timer.next;
-        }
-
-        if (tail == id_)
-        {
-          tail = timer.previous;
-        }
-        else
-        {
-          ptimers[timer.next].previous = timer.previous;
-        }
-
-        if (!has_expired)
-        {
-          // Adjust the next delta.
-          if (timer.next != tpn::timer::id::NO_TIMER)
-          {
-            ptimers[timer.next].delta += timer.delta;
-          }
-        }
-
-        timer.previous = tpn::timer::id::NO_TIMER;
-        timer.next = tpn::timer::id::NO_TIMER;
-        timer.delta = tpn::timer::state::INACTIVE;
-      }
-
-      //*******************************
-      timer_data& front()
-      {
-        return ptimers[head];
-      }
-
-      //*******************************
-      tpn::timer::id::type begin()
-      {
-        current = head;
-        return current;
-      }
-
-      //*******************************
-      tpn::timer::id::type previous(tpn::timer::id::type last)
-      {
-        current = ptimers[last].previous;
-        return current;
-      }
-
-      //*******************************
-      tpn::timer::id::type next(tpn::timer::id::type last)
-      {
-        current = ptimers[last].next;
-        return current;
-      }
-
-      //*******************************
-      void clear()
-      {
-        tpn::timer::id::type id = begin();
-
-        while (id != tpn::timer::id::NO_TIMER)
-        {
-          timer_data& timer = ptimers[id];
-          id = next(id);
-          timer.next = tpn::timer::id::NO_TIMER;
-        }
-
-        head = tpn::timer::id::NO_TIMER;
-        tail = tpn::timer::id::NO_TIMER;
-        current = tpn::timer::id::NO_TIMER;
-      }
-
-    private:
-
-      tpn::timer::id::type head;
-      tpn::timer::id::type tail;
-      tpn::timer::id::type current;
-
-      timer_data* const ptimers;
-    };
-
     // The array of timer data structures.
     timer_data* const timer_array;
 
     // The list of active timers.
-    timer_list active_list;
+    typename TTimerList::template list<timer_data> active_list;
 
     volatile bool enabled;
     volatile uint_least8_t number_of_registered_timers;
@@ -599,26 +408,26 @@ namespace tpn
   //***************************************************************************
   /// The message timer
   //***************************************************************************
-  template <uint_least8_t MAX_TIMERS_, typename TInterruptGuard>
-  class message_timer_interrupt : public tpn::imessage_timer_interrupt<TInterruptGuard>
+  template <uint_least8_t MAX_TIMERS_, typename TInterruptGuard, typename TTimerList = tpn::timer_delta_list>
+  class message_timer_interrupt : public tpn::imessage_timer_interrupt<TInterruptGuard, TTimerList>
   {
   public:
 
     TYPHOON_STATIC_ASSERT(MAX_TIMERS_ <= 254, "No more than 254 timers are allowed");
 
-    typedef typename imessage_timer_interrupt<TInterruptGuard>::callback_type callback_type;
+    typedef typename imessage_timer_interrupt<TInterruptGuard, TTimerList>::callback_type callback_type;
 
     //*******************************************
     /// Constructor.
     //*******************************************
     message_timer_interrupt()
-      : imessage_timer_interrupt<TInterruptGuard>(timer_array, MAX_TIMERS_)
+      : imessage_timer_interrupt<TInterruptGuard, TTimerList>(timer_array, MAX_TIMERS_)
     {
     }
 
   private:
 
-    typename tpn::imessage_timer_interrupt<TInterruptGuard>::timer_data timer_array[MAX_TIMERS_];
+    typename tpn::imessage_timer_interrupt<TInterruptGuard, TTimerList>::timer_data timer_array[MAX_TIMERS_];
   };
 }
 
@@ -0,0 +1,353 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2021 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_MONOTONIC_BUFFER_ALLOCATOR_HPP
+#define TYPHOON_MONOTONIC_BUFFER_ALLOCATOR_HPP
+
+#include "platform.hpp"
+#include "imemory_block_allocator.hpp"
+#include "alignment.hpp"
+#include "nullptr.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace tpn
+{
+  //*************************************************************************
+  /// A memory block allocator that hands out consecutive blocks of a caller
+  /// supplied buffer. Releasing a block does nothing; the memory is
+  /// reclaimed all at once by rewind() to a mark(), by a scope, or by reset().
+  /// When the buffer is exhausted, blocks are taken from an optional
+  /// upstream allocator and returned to it on the next rewind or reset.
+  /// Any successor set through the base class is asked only when both the
+  /// buffer and the upstream allocator fail.
+  /// The buffers of containers such as vector_ext, string_ext and
+  /// circular_buffer_ext may be taken from it.
+  /// e.g.
+  /// tpn::monotonic_buffer_allocator::scope frame(arena);
+  /// tpn::vector_ext<sample> samples(arena.allocate_array<sample>(64U), 64U);
+  //*************************************************************************
+  class monotonic_buffer_allocator : public imemory_block_allocator
+  {
+  private:
+
+    /// The header in front of each block from the upstream allocator.
+    union upstream_block
+    {
+      upstream_block* next;  ///< The previous upstream block.
+      long double     dummy; ///< Aligns the block for any fundamental type.
+    };
+
+  public:
+
+    //*************************************************************************
+    /// A point that the allocator may be rewound to.
+    //*************************************************************************
+    class marker
+    {
+    private:
+
+      friend class monotonic_buffer_allocator;
+
+      marker(size_t used_, upstream_block* upstream_)
+        : used(used_)
+        , upstream(upstream_)
+      {
+      }
+
+      size_t          used;
+      upstream_block* upstream;
+    };
+
+    //*************************************************************************
+    /// Marks the allocator when constructed and rewinds it to the mark when
+    /// destroyed, reclaiming everything allocated within the scope.
+    /// Scopes must be destroyed in the reverse order they were created.
+    //*************************************************************************
+    class scope
+    {
+    public:
+
+      explicit scope(monotonic_buffer_allocator& allocator_)
+        : allocator(allocator_)
+        , start(allocator_.mark())
+      {
+      }
+
+      ~scope()
+      {
+        allocator.rewind(start);
+      }
+
+    private:
+
+      scope(const scope&) TYPHOON_DELETE;
+      scope& operator =(const scope&) TYPHOON_DELETE;
+
+      monotonic_buffer_allocator& allocator;
+      marker                      start;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param buffer_      The memory to allocate from.
+    /// \param buffer_size_ The size of the buffer.
+    //*************************************************************************
+    monotonic_buffer_allocator(void* buffer_, size_t buffer_size_)
+      : p_buffer(static_cast<char*>(buffer_))
+      , buffer_size(buffer_size_)
+      , used(0U)
+      , max_used(0U)
+      , p_upstream(TYPHOON_NULLPTR)
+      , upstream_head(TYPHOON_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param buffer_      The memory to allocate from.
+    /// \param buffer_size_ The size of the buffer.
+    /// \param upstream_    The allocator to use when the buffer is exhausted.
+    //*************************************************************************
+    monotonic_buffer_allocator(void* buffer_, size_t buffer_size_, tpn::imemory_block_allocator& upstream_)
+      : p_buffer(static_cast<char*>(buffer_))
+      , buffer_size(buffer_size_)
+      , used(0U)
+      , max_used(0U)
+      , p_upstream(&upstream_)
+      , upstream_head(TYPHOON_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns any upstream blocks.
+    //*************************************************************************
+    ~monotonic_buffer_allocator()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Allocates uninitialised storage for 'n' objects of type T.
+    /// Returns a null pointer if there is not enough memory.
+    //*************************************************************************
+    template <typename T>
+    T* allocate_array(size_t n)
+    {
+      return static_cast<T*>(allocate(n * sizeof(T), tpn::alignment_of<T>::value));
+    }
+
+    //*************************************************************************
+    /// Returns a marker for the current state of the allocator.
+    //*************************************************************************
+    marker mark() const
+    {
+      return marker(used, upstream_head);
+    }
+
+    //*************************************************************************
+    /// Reclaims everything allocated since 'position' was marked.
+    //*************************************************************************
+    void rewind(const marker& position)
+    {
+      release_upstream(position.upstream);
+      used = position.used;
+    }
+
+    //*************************************************************************
+    /// Reclaims everything.
+    //*************************************************************************
+    void reset()
+    {
+      release_upstream(TYPHOON_NULLPTR);
+      used = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes of the buffer in use, including padding.
+    //*************************************************************************
+    size_t size() const
+    {
+      return used;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the buffer.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return buffer_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes of the buffer not yet used.
+    //*************************************************************************
+    size_t available() const
+    {
+      return buffer_size - used;
+    }
+
+    //*************************************************************************
+    /// Returns the most bytes of the buffer that have been in use at once.
+    //*************************************************************************
+    size_t max_size_used() const
+    {
+      return max_used;
+    }
+
+    //*************************************************************************
+    /// Returns true if any blocks currently come from the upstream allocator.
+    //*************************************************************************
+    bool using_upstream() const
+    {
+      return upstream_head != TYPHOON_NULLPTR;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) TYPHOON_OVERRIDE
+    {
+      if (required_alignment == 0U)
+      {
+        required_alignment = 1U;
+      }
+
+      // Alignments are powers of two.
+      const uintptr_t address = reinterpret_cast<uintptr_t>(p_buffer + used);
+      const size_t    padding = size_t((required_alignment - (address & (required_alignment - 1U))) & (required_alignment - 1U));
+
+      if ((padding <= available()) && (required_size <= (available() - padding)))
+      {
+        void* p = p_buffer + used + padding;
+
+        used += padding + required_size;
+
+        if (used > max_used)
+        {
+          max_used = used;
+        }
+
+        return p;
+      }
+
+      return allocate_upstream(required_size, required_alignment);
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    /// Blocks are only reclaimed by rewind or reset.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) TYPHOON_OVERRIDE
+    {
+      return is_owner_of_block(pblock);
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const TYPHOON_OVERRIDE
+    {
+      const char* const p = static_cast<const char*>(pblock);
+
+      if ((p >= p_buffer) && (p < (p_buffer + buffer_size)))
+      {
+        return true;
+      }
+
+      for (const upstream_block* p_block = upstream_head; p_block != TYPHOON_NULLPTR; p_block = p_block->next)
+      {
+        if (p == reinterpret_cast<const char*>(p_block + 1))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Allocates from the upstream allocator, with a header that links the
+    /// block into the list to release on rewind.
+    //*************************************************************************
+    void* allocate_upstream(size_t required_size, size_t required_alignment)
+    {
+      // The header is placed directly before the returned address, so both
+      // must be aligned, which the alignment of the header caps.
+      if ((p_upstream == TYPHOON_NULLPTR) || (required_alignment > tpn::alignment_of<upstream_block>::value))
+      {
+        return TYPHOON_NULLPTR;
+      }
+
+      void* block = p_upstream->allocate(sizeof(upstream_block) + required_size, tpn::alignment_of<upstream_block>::value);
+
+      if (block == TYPHOON_NULLPTR)
+      {
+        return TYPHOON_NULLPTR;
+      }
+
+      upstream_block* p_block = static_cast<upstream_block*>(block);
+      p_block->next = upstream_head;
+      upstream_head = p_block;
+
+      return p_block + 1;
+    }
+
+    //*************************************************************************
+    /// Returns the upstream blocks allocated after 'last'.
+    //*************************************************************************
+    void release_upstream(upstream_block* last)
+    {
+      while ((upstream_head != last) && (upstream_head != TYPHOON_NULLPTR))
+      {
+        upstream_block* p_block = upstream_head;
+        upstream_head = p_block->next;
+        p_upstream->release(p_block);
+      }
+    }
+
+    // Should not be copied.
+    monotonic_buffer_allocator(const monotonic_buffer_allocator&) TYPHOON_DELETE;
+    monotonic_buffer_allocator& operator =(const monotonic_buffer_allocator&) TYPHOON_DELETE;
+
+    char* const                   p_buffer;      ///< The buffer to allocate from.
+    const size_t                  buffer_size;   ///< The size of the buffer.
+    size_t                        used;          ///< The number of bytes allocated, including padding.
+    size_t                        max_used;      ///< The high water mark of 'used'.
+    tpn::imemory_block_allocator* p_upstream;    ///< The allocator to use when the buffer is exhausted.
+    upstream_block*               upstream_head; ///< The most recent upstream block.
+  };
+}
+
+#endif
@@ -35,6 +35,9 @@ SOFTWARE.
 #include "ihash.hpp"
 #include "binary.hpp"
 #include "error_handler.hpp"
+#include "type_traits.hpp"
+#include "iterator.hpp"
+#include "unaligned_type.hpp"
 
 #include <stdint.h>
 
@@ -50,6 +53,10 @@ namespace tpn
   //***************************************************************************
   /// Calculates the murmur3 hash.
   /// See https://en.wikipedia.org/wiki/MurmurHash for more details.
+  /// Bytes are added to the block as unsigned values. Earlier versions
+  /// sign-extended a byte >= 0x80 at offset 3 of a block, so murmur3<uint64_t>
+  /// values (for any byte type) and murmur3<uint32_t> values of 'char' ranges
+  /// differ from those versions. Persisted hashes must be recomputed.
   ///\ingroup murmur3
   //***************************************************************************
   template <typename THash>
@@ -88,20 +95,7 @@ namespace tpn
       TYPHOON_STATIC_ASSERT(sizeof(typename tpn::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
       reset();
-      while (begin != end)
-      {
-        block |= (*begin) << (block_fill_count * 8U);
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add(begin, end);
     }
 
     //*************************************************************************
@@ -127,20 +121,7 @@ namespace tpn
       TYPHOON_STATIC_ASSERT(sizeof(typename tpn::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       TYPHOON_ASSERT(!is_finalised, TYPHOON_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= (*begin) << (block_fill_count * 8U);
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, typename tpn::is_pointer<TIterator>::type());
     }
 
     //*************************************************************************
@@ -153,16 +134,7 @@ namespace tpn
       // We can't add to a finalised hash!
       TYPHOON_ASSERT(!is_finalised, TYPHOON_ERROR(hash_finalised));
 
-      block |= value_ << (block_fill_count * 8U);
-
-      if (++block_fill_count == FULL_BLOCK)
-      {
-        add_block();
-        block_fill_count = 0;
-        block = 0;
-      }
-
-      ++char_count;
+      add_byte(value_);
     }
 
     //*************************************************************************
@@ -184,6 +156,69 @@ namespace tpn
 
   private:
 
+    //*************************************************************************
+    /// Adds a range one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, tpn::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range.
+    /// Once any partial block is filled, whole blocks are read as words.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, tpn::true_type)
+    {
+      const uint8_t* p     = reinterpret_cast<const uint8_t*>(begin);
+      const uint8_t* p_end = reinterpret_cast<const uint8_t*>(end);
+
+      while ((block_fill_count != 0U) && (p != p_end))
+      {
+        add_byte(*p++);
+      }
+
+      const size_t blocks = static_cast<size_t>(p_end - p) / FULL_BLOCK;
+
+      for (size_t i = 0U; i < blocks; ++i)
+      {
+        block = static_cast<uint32_t>(*reinterpret_cast<const tpn::le_uint32_t*>(p));
+        add_block();
+        block = 0;
+        p += FULL_BLOCK;
+      }
+
+      char_count += blocks * FULL_BLOCK;
+
+      while (p != p_end)
+      {
+        add_byte(*p++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a byte to the current block.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      block |= value_type(value_) << (block_fill_count * 8U);
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block();
+        block_fill_count = 0;
+        block = 0;
+      }
+
+      ++char_count;
+    }
+
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
@@ -236,6 +271,432 @@ namespace tpn
     static TYPHOON_CONSTANT value_type MULTIPLY   = 5;
     static TYPHOON_CONSTANT value_type ADD        = 0xE6546B64UL;
   };
+
+  //***************************************************************************
+  /// A 128 bit murmur3 hash.
+  /// 'low' is the first 8 bytes of the reference MurmurHash3 output and
+  /// 'high' the last 8, each read as little endian.
+  ///\ingroup murmur3
+  //***************************************************************************
+  struct murmur3_128_value
+  {
+    uint64_t low;
+    uint64_t high;
+
+    friend bool operator ==(const murmur3_128_value& lhs, const murmur3_128_value& rhs)
+    {
+      return (lhs.low == rhs.low) && (lhs.high == rhs.high);
+    }
+
+    friend bool operator !=(const murmur3_128_value& lhs, const murmur3_128_value& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    friend bool operator <(const murmur3_128_value& lhs, const murmur3_128_value& rhs)
+    {
+      return (lhs.high < rhs.high) || ((lhs.high == rhs.high) && (lhs.low < rhs.low));
+    }
+  };
+
+  namespace private_murmur3
+  {
+    //*************************************************************************
+    /// The murmur3 finalisation mix. Every input bit affects every output
+    /// bit, so it also serves to spread a weak hash.
+    //*************************************************************************
+    inline uint32_t fmix(uint32_t h)
+    {
+      h ^= (h >> 16U);
+      h *= 0x85EBCA6BUL;
+      h ^= (h >> 13U);
+      h *= 0xC2B2AE35UL;
+      h ^= (h >> 16U);
+
+      return h;
+    }
+
+#if TYPHOON_USING_64BIT_TYPES
+    //*************************************************************************
+    inline uint64_t fmix(uint64_t k)
+    {
+      k ^= (k >> 33U);
+      k *= 0xFF51AFD7ED558CCDULL;
+      k ^= (k >> 33U);
+      k *= 0xC4CEB9FE1A85EC53ULL;
+      k ^= (k >> 33U);
+
+      return k;
+    }
+#endif
+
+    //*************************************************************************
+    /// The streaming part of the 128 bit murmur3 hashes.
+    /// Bytes are gathered into 16 byte blocks. Contiguous ranges are read
+    /// directly, without copying whole blocks to the buffer.
+    /// TDerived supplies the mixing as 'reset_state', 'add_block' and
+    /// 'finalise_state'.
+    //*************************************************************************
+    template <typename TDerived>
+    class murmur3_128_base
+    {
+    public:
+
+      typedef tpn::murmur3_128_value value_type;
+
+      //***********************************************************************
+      /// Resets the hash to the initial state.
+      //***********************************************************************
+      void reset()
+      {
+        static_cast<TDerived*>(this)->reset_state(seed);
+        buffer_count = 0U;
+        length       = 0U;
+        is_finalised = false;
+      }
+
+      //***********************************************************************
+      /// Adds a range.
+      //***********************************************************************
+      template<typename TIterator>
+      void add(TIterator begin, const TIterator end)
+      {
+        TYPHOON_STATIC_ASSERT(sizeof(typename tpn::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+        TYPHOON_ASSERT(!is_finalised, TYPHOON_ERROR(hash_finalised));
+
+        add_range(begin, end, typename tpn::is_pointer<TIterator>::type());
+      }
+
+      //***********************************************************************
+      /// Adds a uint8_t value.
+      /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+      //***********************************************************************
+      void add(uint8_t value_)
+      {
+        TYPHOON_ASSERT(!is_finalised, TYPHOON_ERROR(hash_finalised));
+
+        add_byte(value_);
+      }
+
+      //***********************************************************************
+      /// Gets the hash value.
+      //***********************************************************************
+      value_type value()
+      {
+        if (!is_finalised)
+        {
+          // Zero the unused part of the buffer, so the tail can be read as
+          // whole words.
+          for (size_t i = buffer_count; i < Block_Size; ++i)
+          {
+            buffer[i] = 0U;
+          }
+
+          hash         = static_cast<TDerived*>(this)->finalise_state(buffer, buffer_count, length);
+          is_finalised = true;
+        }
+
+        return hash;
+      }
+
+      //***********************************************************************
+      /// Conversion operator to value_type.
+      //***********************************************************************
+      operator value_type ()
+      {
+        return value();
+      }
+
+    protected:
+
+      static TYPHOON_CONSTANT size_t Block_Size = 16U;
+
+      //***********************************************************************
+      explicit murmur3_128_base(uint32_t seed_)
+        : seed(seed_)
+      {
+      }
+
+      //***********************************************************************
+      /// Little endian loads from any alignment.
+      //***********************************************************************
+      static uint32_t read_32(const uint8_t* p)
+      {
+        return *reinterpret_cast<const tpn::le_uint32_t*>(p);
+      }
+
+      static uint64_t read_64(const uint8_t* p)
+      {
+        return *reinterpret_cast<const tpn::le_uint64_t*>(p);
+      }
+
+    private:
+
+      //***********************************************************************
+      template<typename TIterator>
+      void add_range(TIterator begin, const TIterator end, tpn::false_type)
+      {
+        while (begin != end)
+        {
+          add_byte(static_cast<uint8_t>(*begin));
+          ++begin;
+        }
+      }
+
+      //***********************************************************************
+      template<typename TPointer>
+      void add_range(TPointer begin, const TPointer end, tpn::true_type)
+      {
+        const uint8_t* p     = reinterpret_cast<const uint8_t*>(begin);
+        const uint8_t* p_end = reinterpret_cast<const uint8_t*>(end);
+
+        while ((buffer_count != 0U) && (p != p_end))
+        {
+          add_byte(*p++);
+        }
+
+        const size_t blocks = static_cast<size_t>(p_end - p) / Block_Size;
+
+        for (size_t i = 0U; i < blocks; ++i)
+        {
+          static_cast<TDerived*>(this)->add_block(p);
+          p += Block_Size;
+        }
+
+        length += blocks * Block_Size;
+
+        while (p != p_end)
+        {
+          add_byte(*p++);
+        }
+      }
+
+      //***********************************************************************
+      void add_byte(uint8_t value_)
+      {
+        buffer[buffer_count] = value_;
+
+        if (++buffer_count == Block_Size)
+        {
+          static_cast<TDerived*>(this)->add_block(buffer);
+          buffer_count = 0U;
+        }
+
+        ++length;
+      }
+
+      uint8_t    buffer[Block_Size];
+      size_t     buffer_count;
+      uint64_t   length;
+      value_type hash;
+      bool       is_finalised;
+      uint32_t   seed;
+    };
+  }
+
+  //***************************************************************************
+  /// Calculates the 128 bit murmur3 hash optimised for 32 bit platforms
+  /// (MurmurHash3_x86_128).
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_x86_128 : public private_murmur3::murmur3_128_base<murmur3_x86_128>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    murmur3_x86_128(uint32_t seed_ = 0)
+      : murmur3_128_base(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    murmur3_x86_128(TIterator begin, const TIterator end, uint32_t seed_ = 0)
+      : murmur3_128_base(seed_)
+    {
+      reset();
+      add(begin, end);
+    }
+
+  private:
+
+    friend class private_murmur3::murmur3_128_base<murmur3_x86_128>;
+
+    //*************************************************************************
+    void reset_state(uint32_t seed_)
+    {
+      h1 = seed_;
+      h2 = seed_;
+      h3 = seed_;
+      h4 = seed_;
+    }
+
+    //*************************************************************************
+    void add_block(const uint8_t* p)
+    {
+      uint32_t k1 = read_32(p);
+      uint32_t k2 = read_32(p + 4U);
+      uint32_t k3 = read_32(p + 8U);
+      uint32_t k4 = read_32(p + 12U);
+
+      h1 ^= mix_k1(k1);
+      h1 = rotate_left(h1, 19U); h1 += h2; h1 = (h1 * 5U) + 0x561CCD1BUL;
+
+      h2 ^= mix_k2(k2);
+      h2 = rotate_left(h2, 17U); h2 += h3; h2 = (h2 * 5U) + 0x0BCAA747UL;
+
+      h3 ^= mix_k3(k3);
+      h3 = rotate_left(h3, 15U); h3 += h4; h3 = (h3 * 5U) + 0x96CD1C35UL;
+
+      h4 ^= mix_k4(k4);
+      h4 = rotate_left(h4, 13U); h4 += h1; h4 = (h4 * 5U) + 0x32AC3B17UL;
+    }
+
+    //*************************************************************************
+    value_type finalise_state(const uint8_t* tail, size_t count, uint64_t length)
+    {
+      if (count > 12U) { h4 ^= mix_k4(read_32(tail + 12U)); }
+      if (count > 8U)  { h3 ^= mix_k3(read_32(tail + 8U)); }
+      if (count > 4U)  { h2 ^= mix_k2(read_32(tail + 4U)); }
+      if (count > 0U)  { h1 ^= mix_k1(read_32(tail)); }
+
+      const uint32_t length32 = static_cast<uint32_t>(length);
+
+      h1 ^= length32; h2 ^= length32; h3 ^= length32; h4 ^= length32;
+
+      h1 += h2; h1 += h3; h1 += h4;
+      h2 += h1; h3 += h1; h4 += h1;
+
+      h1 = private_murmur3::fmix(h1); h2 = private_murmur3::fmix(h2);
+      h3 = private_murmur3::fmix(h3); h4 = private_murmur3::fmix(h4);
+
+      h1 += h2; h1 += h3; h1 += h4;
+      h2 += h1; h3 += h1; h4 += h1;
+
+      value_type result;
+      result.low  = uint64_t(h1) | (uint64_t(h2) << 32U);
+      result.high = uint64_t(h3) | (uint64_t(h4) << 32U);
+
+      return result;
+    }
+
+    //*************************************************************************
+    static uint32_t mix_k1(uint32_t k) { k *= C1; k = rotate_left(k, 15U); return k * C2; }
+    static uint32_t mix_k2(uint32_t k) { k *= C2; k = rotate_left(k, 16U); return k * C3; }
+    static uint32_t mix_k3(uint32_t k) { k *= C3; k = rotate_left(k, 17U); return k * C4; }
+    static uint32_t mix_k4(uint32_t k) { k *= C4; k = rotate_left(k, 18U); return k * C1; }
+
+    uint32_t h1;
+    uint32_t h2;
+    uint32_t h3;
+    uint32_t h4;
+
+    static TYPHOON_CONSTANT uint32_t C1 = 0x239B961BUL;
+    static TYPHOON_CONSTANT uint32_t C2 = 0xAB0E9789UL;
+    static TYPHOON_CONSTANT uint32_t C3 = 0x38B34AE5UL;
+    static TYPHOON_CONSTANT uint32_t C4 = 0xA1E38B93UL;
+  };
+
+#if TYPHOON_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Calculates the 128 bit murmur3 hash optimised for 64 bit platforms
+  /// (MurmurHash3_x64_128).
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_x64_128 : public private_murmur3::murmur3_128_base<murmur3_x64_128>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    murmur3_x64_128(uint32_t seed_ = 0)
+      : murmur3_128_base(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    murmur3_x64_128(TIterator begin, const TIterator end, uint32_t seed_ = 0)
+      : murmur3_128_base(seed_)
+    {
+      reset();
+      add(begin, end);
+    }
+
+  private:
+
+    friend class private_murmur3::murmur3_128_base<murmur3_x64_128>;
+
+    //*************************************************************************
+    void reset_state(uint32_t seed_)
+    {
+      h1 = seed_;
+      h2 = seed_;
+    }
+
+    //*************************************************************************
+    void add_block(const uint8_t* p)
+    {
+      h1 ^= mix_k1(read_64(p));
+      h1 = rotate_left(h1, 27U); h1 += h2; h1 = (h1 * 5U) + 0x52DCE729ULL;
+
+      h2 ^= mix_k2(read_64(p + 8U));
+      h2 = rotate_left(h2, 31U); h2 += h1; h2 = (h2 * 5U) + 0x38495AB5ULL;
+    }
+
+    //*************************************************************************
+    value_type finalise_state(const uint8_t* tail, size_t count, uint64_t length)
+    {
+      if (count > 8U) { h2 ^= mix_k2(read_64(tail + 8U)); }
+      if (count > 0U) { h1 ^= mix_k1(read_64(tail)); }
+
+      h1 ^= length;
+      h2 ^= length;
+
+      h1 += h2;
+      h2 += h1;
+
+      h1 = private_murmur3::fmix(h1);
+      h2 = private_murmur3::fmix(h2);
+
+      h1 += h2;
+      h2 += h1;
+
+      value_type result;
+      result.low  = h1;
+      result.high = h2;
+
+      return result;
+    }
+
+    //*************************************************************************
+    static uint64_t mix_k1(uint64_t k) { k *= C1; k = rotate_left(k, 31U); return k * C2; }
+    static uint64_t mix_k2(uint64_t k) { k *= C2; k = rotate_left(k, 33U); return k * C1; }
+
+    uint64_t h1;
+    uint64_t h2;
+
+    static TYPHOON_CONSTANT uint64_t C1 = 0x87C37B91114253D5ULL;
+    static TYPHOON_CONSTANT uint64_t C2 = 0x4CF5AD432745937FULL;
+  };
+#endif
 }
 
 #endif
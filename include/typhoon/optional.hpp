@@ -117,22 +117,22 @@ namespace tpn
     //***************************************************************************
     /// Constructor.
     //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     optional()
       : valid(false)
     {
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //***************************************************************************
     /// Constructor with nullopt.
     //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     optional(tpn::nullopt_t)
       : valid(false)
     {
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //***************************************************************************
     /// Copy constructor.
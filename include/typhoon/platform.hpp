@@ -191,6 +191,14 @@ SOFTWARE.
   #define TYPHOON_HAS_IVECTOR_REPAIR 0
 #endif
 
+//*************************************
+// Option to let an ivector grow through its derived class, as small_vector does.
+#if defined(TYPHOON_IVECTOR_GROWTH_ENABLE)
+  #define TYPHOON_HAS_IVECTOR_GROWTH 1
+#else
+  #define TYPHOON_HAS_IVECTOR_GROWTH 0
+#endif
+
 //*************************************
 // Option to enable repair-after-memcpy for ideque.
 #if defined(TYPHOON_IDEQUE_REPAIR_ENABLE)
@@ -0,0 +1,390 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2014 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_POOL_MAGAZINE_HPP
+#define TYPHOON_POOL_MAGAZINE_HPP
+
+#include "platform.hpp"
+#include "ipool_atomic.hpp"
+#include "type_traits.hpp"
+#include "static_assert.hpp"
+#include "alignment.hpp"
+#include "utility.hpp"
+#include "placement_new.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TYPHOON_POOL_CPP03_CODE 0
+
+#if TYPHOON_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup pool_magazine pool_magazine
+/// A per-thread cache of free items in front of a shared pool.
+///\ingroup pool
+//*****************************************************************************
+
+namespace tpn
+{
+  //*************************************************************************
+  /// Keeps up to VSize free items of a shared pool_atomic or
+  /// generic_pool_atomic for the one thread that owns the magazine.
+  /// Allocations and releases are served from the magazine without touching
+  /// the shared pool. When it is empty it takes half of VSize items from the
+  /// pool in one operation, and when it is full it returns half. The items
+  /// are the pool's own, so an item may be released to either the magazine
+  /// or the pool, by any thread.
+  /// A magazine must only be used by one thread at a time. It returns its
+  /// items to the pool when destroyed.
+  ///\ingroup pool_magazine
+  //*************************************************************************
+  template <typename TPool, const size_t VSize>
+  class pool_magazine
+  {
+  public:
+
+    TYPHOON_STATIC_ASSERT(VSize >= 2U, "A magazine must hold at least 2 items");
+
+    static TYPHOON_CONSTANT size_t SIZE      = VSize;
+    static TYPHOON_CONSTANT size_t BATCH     = VSize / 2U;
+    static TYPHOON_CONSTANT size_t ALIGNMENT = TPool::ALIGNMENT;
+    static TYPHOON_CONSTANT size_t TYPE_SIZE = TPool::TYPE_SIZE;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    explicit pool_magazine(TPool& pool_)
+      : pool(pool_)
+      , count(0U)
+      , allocations(0U)
+      , hits(0U)
+      , refills(0U)
+      , flushes(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor
+    //*************************************************************************
+    ~pool_magazine()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// tpn::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      U* p = try_allocate<U>();
+
+      if (p == TYPHOON_NULLPTR)
+      {
+        TYPHOON_ASSERT(false, TYPHOON_ERROR(tpn::pool_no_allocation));
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object.
+    /// Returns a null pointer if there are no more free items.
+    //*************************************************************************
+    template <typename U>
+    U* try_allocate()
+    {
+      TYPHOON_STATIC_ASSERT(tpn::alignment_of<U>::value <= ALIGNMENT, "Type has incompatible alignment");
+      TYPHOON_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+
+      ++allocations;
+
+      if (count != 0U)
+      {
+        ++hits;
+      }
+      else
+      {
+        ++refills;
+        count = pool.allocate_n(items, BATCH);
+
+        if (count == 0U)
+        {
+          return TYPHOON_NULLPTR;
+        }
+      }
+
+      return static_cast<U*>(items[--count]);
+    }
+
+#if TYPHOON_CPP11_NOT_SUPPORTED || TYPHOON_POOL_CPP03_CODE || TYPHOON_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// tpn::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// tpn::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// tpn::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// tpn::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// tpn::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      U* p = allocate<U>();
+
+      if (p)
+      {
+        ::new (p) U(tpn::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      p_object->~U();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object to the magazine.
+    /// If asserts or exceptions are enabled and the object does not belong to the
+    /// pool then an tpn::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      TYPHOON_ASSERT(pool.is_in_pool(p_object), TYPHOON_ERROR(tpn::pool_object_not_in_pool));
+
+      if (count == VSize)
+      {
+        // Return the older half, keeping the recently used items that are
+        // more likely to be in the cache.
+        ++flushes;
+        pool.release_n(items, BATCH);
+
+        for (size_t i = BATCH; i < VSize; ++i)
+        {
+          items[i - BATCH] = items[i];
+        }
+
+        count -= BATCH;
+      }
+
+      items[count++] = const_cast<void*>(p_object);
+    }
+
+    //*************************************************************************
+    /// Returns all of the magazine's items to the pool.
+    //*************************************************************************
+    void flush()
+    {
+      if (count != 0U)
+      {
+        ++flushes;
+        pool.release_n(items, count);
+        count = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items held by the magazine.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of free items the magazine can hold.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocations requested from the magazine.
+    //*************************************************************************
+    uint32_t allocation_count() const
+    {
+      return allocations;
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocations served without going to the pool.
+    /// The hit rate is hit_count() / allocation_count().
+    //*************************************************************************
+    uint32_t hit_count() const
+    {
+      return hits;
+    }
+
+    //*************************************************************************
+    /// Returns the number of times the magazine took a batch from the pool.
+    //*************************************************************************
+    uint32_t refill_count() const
+    {
+      return refills;
+    }
+
+    //*************************************************************************
+    /// Returns the number of times the magazine returned items to the pool.
+    //*************************************************************************
+    uint32_t flush_count() const
+    {
+      return flushes;
+    }
+
+    //*************************************************************************
+    /// Sets the counters to zero.
+    //*************************************************************************
+    void clear_counts()
+    {
+      allocations = 0U;
+      hits        = 0U;
+      refills     = 0U;
+      flushes     = 0U;
+    }
+
+  private:
+
+    // Should not be copied.
+    pool_magazine(const pool_magazine&) TYPHOON_DELETE;
+    pool_magazine& operator =(const pool_magazine&) TYPHOON_DELETE;
+
+    TPool&   pool;         ///< The shared pool.
+    void*    items[VSize]; ///< The free items, most recently released last.
+    size_t   count;        ///< The number of free items.
+
+    uint32_t allocations;  ///< The number of allocations requested.
+    uint32_t hits;         ///< The number of allocations served from the magazine.
+    uint32_t refills;      ///< The number of batches taken from the pool.
+    uint32_t flushes;      ///< The number of times items were returned to the pool.
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,410 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2021 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_POOL_TELEMETRY_HPP
+#define TYPHOON_POOL_TELEMETRY_HPP
+
+#include "platform.hpp"
+#include "private/dense_histogram.hpp"
+#include "binary.hpp"
+#include "exception.hpp"
+#include "error_handler.hpp"
+#include "file_error_numbers.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup pool_telemetry pool_telemetry
+/// Usage statistics for pools.
+/// Define TYPHOON_POOL_TELEMETRY to let pools record into an attached
+/// tpn::pool_telemetry. Without it, pools have no telemetry code or data.
+/// Define TYPHOON_POOL_TELEMETRY_CYCLES() as an expression that reads a free
+/// running uint32_t cycle counter to also record how long allocations and
+/// releases take, e.g. the DWT cycle counter on a Cortex-M.
+///\ingroup pool
+//*****************************************************************************
+
+namespace tpn
+{
+  //***************************************************************************
+  /// Exception for the pool telemetry registry.
+  ///\ingroup pool_telemetry
+  //***************************************************************************
+  class pool_telemetry_exception : public tpn::exception
+  {
+  public:
+
+    pool_telemetry_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The registry is full.
+  ///\ingroup pool_telemetry
+  //***************************************************************************
+  class pool_telemetry_registry_full : public tpn::pool_telemetry_exception
+  {
+  public:
+
+    pool_telemetry_registry_full(string_type file_name_, numeric_type line_number_)
+      : pool_telemetry_exception(TYPHOON_ERROR_TEXT("pool telemetry registry:full", TYPHOON_POOL_TELEMETRY_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Usage statistics for one pool.
+  /// Records the number of items in use and its high water mark, the number
+  /// of allocations and failed allocations, and histograms of the cycles
+  /// taken by allocations and releases.
+  /// Histogram bucket 'n' counts the operations that took from 2^(n-1) up to
+  /// 2^n - 1 cycles. Bucket 0 counts those that took none.
+  ///\ingroup pool_telemetry
+  //***************************************************************************
+  class pool_telemetry
+  {
+  public:
+
+    static TYPHOON_CONSTANT size_t Latency_Buckets = 33U;
+
+    typedef tpn::histogram<uint8_t, uint32_t, Latency_Buckets, 0> latency_histogram;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    pool_telemetry()
+      : items_in_use(0U)
+      , peak_items(0U)
+      , allocations(0U)
+      , failures(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns the number of items currently allocated.
+    //*************************************************************************
+    size_t in_use() const
+    {
+      return items_in_use;
+    }
+
+    //*************************************************************************
+    /// Returns the most items that have been allocated at once.
+    //*************************************************************************
+    size_t peak_in_use() const
+    {
+      return peak_items;
+    }
+
+    //*************************************************************************
+    /// Returns the number of successful allocations.
+    //*************************************************************************
+    uint32_t allocation_count() const
+    {
+      return allocations;
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocations that failed because the pool was full.
+    //*************************************************************************
+    uint32_t failure_count() const
+    {
+      return failures;
+    }
+
+    //*************************************************************************
+    /// Returns the histogram of cycles taken by allocations.
+    /// Empty unless TYPHOON_POOL_TELEMETRY_CYCLES is defined.
+    //*************************************************************************
+    const latency_histogram& allocate_cycles() const
+    {
+      return allocate_latency;
+    }
+
+    //*************************************************************************
+    /// Returns the histogram of cycles taken by releases.
+    /// Empty unless TYPHOON_POOL_TELEMETRY_CYCLES is defined.
+    //*************************************************************************
+    const latency_histogram& release_cycles() const
+    {
+      return release_latency;
+    }
+
+    //*************************************************************************
+    /// Clears the counts and histograms.
+    /// The high water mark restarts from the number of items in use.
+    //*************************************************************************
+    void clear()
+    {
+      peak_items  = items_in_use;
+      allocations = 0U;
+      failures    = 0U;
+      allocate_latency.clear();
+      release_latency.clear();
+    }
+
+    //*************************************************************************
+    /// Returns the histogram bucket for a number of cycles.
+    //*************************************************************************
+    static uint8_t bucket(uint32_t cycles)
+    {
+      return uint8_t(32U - tpn::count_leading_zeros(cycles));
+    }
+
+    //*************************************************************************
+    /// Reads the cycle counter, if one is configured.
+    //*************************************************************************
+    static uint32_t cycles()
+    {
+#if defined(TYPHOON_POOL_TELEMETRY_CYCLES)
+      return uint32_t(TYPHOON_POOL_TELEMETRY_CYCLES());
+#else
+      return 0U;
+#endif
+    }
+
+    //*************************************************************************
+    /// Records an allocation that started at cycle 'start'.
+    //*************************************************************************
+    void record_allocate(uint32_t start)
+    {
+      ++allocations;
+
+      if (++items_in_use > peak_items)
+      {
+        peak_items = items_in_use;
+      }
+
+#if defined(TYPHOON_POOL_TELEMETRY_CYCLES)
+      allocate_latency.add(bucket(cycles() - start));
+#else
+      (void)start;
+#endif
+    }
+
+    //*************************************************************************
+    /// Records an allocation that failed.
+    //*************************************************************************
+    void record_failure()
+    {
+      ++failures;
+    }
+
+    //*************************************************************************
+    /// Records a release that started at cycle 'start'.
+    //*************************************************************************
+    void record_release(uint32_t start)
+    {
+      if (items_in_use != 0U)
+      {
+        --items_in_use;
+      }
+
+#if defined(TYPHOON_POOL_TELEMETRY_CYCLES)
+      release_latency.add(bucket(cycles() - start));
+#else
+      (void)start;
+#endif
+    }
+
+    //*************************************************************************
+    /// Records that every item was released at once.
+    //*************************************************************************
+    void record_release_all()
+    {
+      items_in_use = 0U;
+    }
+
+  private:
+
+    size_t            items_in_use;
+    size_t            peak_items;
+    uint32_t          allocations;
+    uint32_t          failures;
+    latency_histogram allocate_latency;
+    latency_histogram release_latency;
+  };
+
+  //***************************************************************************
+  /// A list of named pool telemetry, so that all pools may be reported in
+  /// one call.
+  ///\ingroup pool_telemetry
+  //***************************************************************************
+  template <const size_t VMax_Pools>
+  class pool_telemetry_registry
+  {
+  public:
+
+    static TYPHOON_CONSTANT size_t Max_Pools = VMax_Pools;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    pool_telemetry_registry()
+      : count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds the telemetry of a pool under a name.
+    /// If asserts or exceptions are enabled, emits pool_telemetry_registry_full
+    /// if the registry is full.
+    //*************************************************************************
+    void add(const char* name, const tpn::pool_telemetry& telemetry)
+    {
+      if (count < VMax_Pools)
+      {
+        entries[count].name      = name;
+        entries[count].telemetry = &telemetry;
+        ++count;
+      }
+      else
+      {
+        TYPHOON_ASSERT_FAIL(TYPHOON_ERROR(tpn::pool_telemetry_registry_full));
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the telemetry of a pool.
+    //*************************************************************************
+    void remove(const tpn::pool_telemetry& telemetry)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        if (entries[i].telemetry == &telemetry)
+        {
+          for (size_t j = i + 1U; j < count; ++j)
+          {
+            entries[j - 1U] = entries[j];
+          }
+
+          --count;
+          return;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Calls 'visitor(name, telemetry)' for each pool, in the order added.
+    //*************************************************************************
+    template <typename TVisitor>
+    void for_each(TVisitor visitor) const
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        visitor(entries[i].name, *entries[i].telemetry);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the number of pools registered.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns true if no pools are registered.
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns true if no more pools may be registered.
+    //*************************************************************************
+    bool full() const
+    {
+      return count == VMax_Pools;
+    }
+
+  private:
+
+    struct entry
+    {
+      const char*                name;
+      const tpn::pool_telemetry* telemetry;
+    };
+
+    entry  entries[VMax_Pools];
+    size_t count;
+  };
+
+#if defined(TYPHOON_POOL_TELEMETRY)
+  namespace private_pool_telemetry
+  {
+    //*************************************************************************
+    /// The hooks that pools call. They do nothing when no telemetry is attached.
+    //*************************************************************************
+    inline uint32_t start(const tpn::pool_telemetry* p_telemetry)
+    {
+      return (p_telemetry != TYPHOON_NULLPTR) ? tpn::pool_telemetry::cycles() : 0U;
+    }
+
+    inline void allocated(tpn::pool_telemetry* p_telemetry, const void* p, uint32_t start_cycles)
+    {
+      if (p_telemetry != TYPHOON_NULLPTR)
+      {
+        if (p != TYPHOON_NULLPTR)
+        {
+          p_telemetry->record_allocate(start_cycles);
+        }
+        else
+        {
+          p_telemetry->record_failure();
+        }
+      }
+    }
+
+    inline void released(tpn::pool_telemetry* p_telemetry, uint32_t start_cycles)
+    {
+      if (p_telemetry != TYPHOON_NULLPTR)
+      {
+        p_telemetry->record_release(start_cycles);
+      }
+    }
+
+    inline void released_all(tpn::pool_telemetry* p_telemetry)
+    {
+      if (p_telemetry != TYPHOON_NULLPTR)
+      {
+        p_telemetry->record_release_all();
+      }
+    }
+  }
+#endif
+}
+
+#endif
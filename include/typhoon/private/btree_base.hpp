@@ -0,0 +1,1407 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2016 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_PRIVATE_BTREE_BASE_HPP
+#define TYPHOON_PRIVATE_BTREE_BASE_HPP
+
+#include "../platform.hpp"
+#include "../alignment.hpp"
+#include "../type_traits.hpp"
+#include "../utility.hpp"
+#include "../ipool.hpp"
+#include "../nullptr.hpp"
+#include "../placement_new.hpp"
+#include "../static_assert.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// The B+ tree shared by btree_map and btree_set.
+// Values live in leaves, in key order, and the leaves are linked for ordered
+// iteration. Branches hold separator keys and child pointers. Each node is
+// sized to TYPHOON_BTREE_NODE_SIZE bytes, so a lookup touches one small
+// contiguous block per level instead of one scattered node per comparison.
+// Keys are kept contiguously in every node. For maps, where the values are
+// key/mapped pairs, each leaf holds a copy of its keys alongside the pairs.
+// Every node other than the root is kept at least half full, which bounds
+// the number of nodes needed for a given capacity.
+//*****************************************************************************
+
+#if !defined(TYPHOON_BTREE_NODE_SIZE)
+  #define TYPHOON_BTREE_NODE_SIZE 256U
+#endif
+
+namespace tpn
+{
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// The number of slots of 'VSlot_Size' bytes that fit in a node after its
+    /// 'VHeader' bytes. At least 4, so that a node can always be split.
+    //*************************************************************************
+    template <size_t VSlot_Size, size_t VHeader>
+    struct slots
+    {
+      static TYPHOON_CONSTANT size_t Fit   = (TYPHOON_BTREE_NODE_SIZE > VHeader) ? (TYPHOON_BTREE_NODE_SIZE - VHeader) / VSlot_Size : 0U;
+      static TYPHOON_CONSTANT size_t value = (Fit < 4U) ? 4U : ((Fit > 1024U) ? 1024U : Fit);
+    };
+
+    //*************************************************************************
+    /// The most branches needed above 'VChildren' nodes, when every branch
+    /// other than the root has at least 'VMin_Children' children.
+    //*************************************************************************
+    template <size_t VChildren, size_t VMin_Children>
+    struct branch_count
+    {
+      static TYPHOON_CONSTANT size_t Parents = ((VChildren / VMin_Children) < 1U) ? 1U : (VChildren / VMin_Children);
+      static TYPHOON_CONSTANT size_t value   = Parents + branch_count<Parents, VMin_Children>::value;
+    };
+
+    template <size_t VMin_Children>
+    struct branch_count<1U, VMin_Children>
+    {
+      static TYPHOON_CONSTANT size_t value = 0U;
+    };
+
+    template <size_t VMin_Children>
+    struct branch_count<0U, VMin_Children>
+    {
+      static TYPHOON_CONSTANT size_t value = 0U;
+    };
+
+    //*************************************************************************
+    /// The copy of the keys held by a map's leaf.
+    //*************************************************************************
+    template <typename TKey, size_t VSlots, bool VSeparate_Keys>
+    struct leaf_keys
+    {
+      TKey* data()
+      {
+        return reinterpret_cast<TKey*>(&storage);
+      }
+
+      const TKey* data() const
+      {
+        return reinterpret_cast<const TKey*>(&storage);
+      }
+
+      typename tpn::aligned_storage<sizeof(TKey) * VSlots, tpn::alignment_of<TKey>::value>::type storage;
+    };
+
+    //*************************************************************************
+    /// A set's leaf finds its keys in its values.
+    //*************************************************************************
+    template <typename TKey, size_t VSlots>
+    struct leaf_keys<TKey, VSlots, false>
+    {
+    };
+
+    //*************************************************************************
+    /// Gets the key of a set value, which is the value itself.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_of_value
+    {
+      const TKey& operator()(const TKey& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Copy constructs a value in a leaf.
+    //*************************************************************************
+    template <typename T>
+    struct create_copy
+    {
+      explicit create_copy(const T& value_)
+        : value(value_)
+      {
+      }
+
+      void operator ()(void* p) const
+      {
+        ::new (p) T(value);
+      }
+
+      const T& value;
+    };
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move constructs a value in a leaf.
+    //*************************************************************************
+    template <typename T>
+    struct create_move
+    {
+      explicit create_move(T& value_)
+        : value(value_)
+      {
+      }
+
+      void operator ()(void* p) const
+      {
+        ::new (p) T(tpn::move(value));
+      }
+
+      T& value;
+    };
+#endif
+
+    //*************************************************************************
+    /// Moves an object to uninitialised storage, destroying the original.
+    //*************************************************************************
+    template <typename T>
+    void relocate(T* p_from, T* p_to)
+    {
+      ::new (static_cast<void*>(p_to)) T(tpn::move(*p_from));
+      p_from->~T();
+    }
+
+    //*************************************************************************
+    /// Replaces a constructed key with a copy of 'key'.
+    //*************************************************************************
+    template <typename TKey>
+    void replace_key(TKey* p_key, const TKey& key)
+    {
+      if (p_key != &key)
+      {
+        p_key->~TKey();
+        ::new (static_cast<void*>(p_key)) TKey(key);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// The base class for btree_map and btree_set.
+  ///\tparam TKey           The key type.
+  ///\tparam TValue         The value type stored in the leaves.
+  ///\tparam TKeyOf         Gets the key from a value.
+  ///\tparam TKeyCompare    The key ordering.
+  ///\tparam VSeparate_Keys Whether leaves keep a copy of the keys apart from
+  ///                       the values, so that they are contiguous.
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TKeyOf, typename TKeyCompare, bool VSeparate_Keys>
+  class btree_base
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Gets the size of the tree.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the tree.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the tree is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the tree is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the tree.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// The number of levels of branches above the leaves.
+    //*************************************************************************
+    size_t height() const
+    {
+      return tree_height;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The part common to leaves and branches.
+    //*************************************************************************
+    struct node
+    {
+      size_t count;
+    };
+
+    static TYPHOON_CONSTANT size_t Leaf_Header  = sizeof(node) + (2U * sizeof(void*));
+    static TYPHOON_CONSTANT size_t Leaf_Slot    = sizeof(TValue) + (VSeparate_Keys ? sizeof(TKey) : 0U);
+
+  public:
+
+    static TYPHOON_CONSTANT size_t Leaf_Slots   = private_btree::slots<Leaf_Slot, Leaf_Header>::value;
+    static TYPHOON_CONSTANT size_t Branch_Keys  = private_btree::slots<sizeof(TKey) + sizeof(void*), sizeof(node) + sizeof(void*)>::value;
+
+  protected:
+
+    static TYPHOON_CONSTANT size_t Min_Leaf            = Leaf_Slots / 2U;
+    static TYPHOON_CONSTANT size_t Min_Branch_Keys     = (Branch_Keys - 1U) / 2U;
+    static TYPHOON_CONSTANT size_t Min_Branch_Children = Min_Branch_Keys + 1U;
+
+    /// Enough for any tree whose branches have at least two children.
+    static TYPHOON_CONSTANT size_t Max_Height = 8U * sizeof(size_t);
+
+    //*************************************************************************
+    /// The leaf node.
+    //*************************************************************************
+    struct leaf_node : public node
+    {
+      TValue* values()
+      {
+        return reinterpret_cast<TValue*>(&value_storage);
+      }
+
+      const TValue* values() const
+      {
+        return reinterpret_cast<const TValue*>(&value_storage);
+      }
+
+      leaf_node* prev;
+      leaf_node* next;
+      private_btree::leaf_keys<TKey, Leaf_Slots, VSeparate_Keys> separate_keys;
+      typename tpn::aligned_storage<sizeof(TValue) * Leaf_Slots, tpn::alignment_of<TValue>::value>::type value_storage;
+    };
+
+    //*************************************************************************
+    /// The branch node.
+    /// Child 'i' holds the keys not before keys()[i - 1] and before keys()[i].
+    //*************************************************************************
+    struct branch_node : public node
+    {
+      TKey* keys()
+      {
+        return reinterpret_cast<TKey*>(&key_storage);
+      }
+
+      const TKey* keys() const
+      {
+        return reinterpret_cast<const TKey*>(&key_storage);
+      }
+
+      typename tpn::aligned_storage<sizeof(TKey) * Branch_Keys, tpn::alignment_of<TKey>::value>::type key_storage;
+      node* children[Branch_Keys + 1U];
+    };
+
+    //*************************************************************************
+    /// The number of leaves and branches needed for 'VSize' values.
+    //*************************************************************************
+    template <size_t VSize>
+    struct node_count
+    {
+      static TYPHOON_CONSTANT size_t Leaves   = ((VSize / Min_Leaf) < 1U) ? 1U : (VSize / Min_Leaf);
+      static TYPHOON_CONSTANT size_t Fit      = private_btree::branch_count<Leaves, Min_Branch_Children>::value;
+      static TYPHOON_CONSTANT size_t Branches = (Fit < 1U) ? 1U : Fit;
+    };
+
+    //*************************************************************************
+    /// A value's place in the tree. A null leaf is the end.
+    //*************************************************************************
+    struct position
+    {
+      leaf_node* p_leaf;
+      size_t     index;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    btree_base(tpn::ipool& leaf_pool, tpn::ipool& branch_pool, size_t max_size_)
+      : current_size(0U)
+      , CAPACITY(max_size_)
+      , p_root(TYPHOON_NULLPTR)
+      , p_first(TYPHOON_NULLPTR)
+      , p_last(TYPHOON_NULLPTR)
+      , tree_height(0U)
+      , p_leaf_pool(&leaf_pool)
+      , p_branch_pool(&branch_pool)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_base()
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the key of a value in a leaf.
+    //*************************************************************************
+    static const TKey& leaf_key(const leaf_node& leaf, size_t index)
+    {
+      return leaf_keys(leaf, tpn::integral_constant<bool, VSeparate_Keys>())[index];
+    }
+
+    //*************************************************************************
+    /// The position of the first value.
+    //*************************************************************************
+    position first_position() const
+    {
+      return make_position(p_first, 0U);
+    }
+
+    //*************************************************************************
+    /// The end position.
+    //*************************************************************************
+    static position end_position()
+    {
+      return make_position(TYPHOON_NULLPTR, 0U);
+    }
+
+    //*************************************************************************
+    /// The position of the last value, or end if empty.
+    //*************************************************************************
+    position last_position() const
+    {
+      return (p_last == TYPHOON_NULLPTR) ? end_position() : make_position(p_last, p_last->count - 1U);
+    }
+
+    //*************************************************************************
+    /// Makes a position, moving on to the next leaf if 'index' is past the
+    /// end of 'p_leaf'.
+    //*************************************************************************
+    static position make_position(leaf_node* p_leaf, size_t index)
+    {
+      if ((p_leaf != TYPHOON_NULLPTR) && (index == p_leaf->count))
+      {
+        p_leaf = p_leaf->next;
+        index  = 0U;
+      }
+
+      position result = { p_leaf, index };
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The position after 'pos'.
+    //*************************************************************************
+    static position next_position(position pos)
+    {
+      return make_position(pos.p_leaf, pos.index + 1U);
+    }
+
+    //*************************************************************************
+    /// The position before 'pos'. The one before end is the last.
+    //*************************************************************************
+    position previous_position(position pos) const
+    {
+      if (pos.p_leaf == TYPHOON_NULLPTR)
+      {
+        return last_position();
+      }
+      else if (pos.index == 0U)
+      {
+        leaf_node* p_prev = pos.p_leaf->prev;
+        return make_position(p_prev, (p_prev == TYPHOON_NULLPTR) ? 0U : p_prev->count - 1U);
+      }
+      else
+      {
+        return make_position(pos.p_leaf, pos.index - 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the value with the key, or end.
+    //*************************************************************************
+    template <typename K>
+    position find_position(const K& key) const
+    {
+      leaf_node* p_leaf = find_leaf(key);
+
+      if (p_leaf != TYPHOON_NULLPTR)
+      {
+        const size_t index = leaf_lower_bound(*p_leaf, key);
+
+        if ((index != p_leaf->count) && !kcompare(key, leaf_key(*p_leaf, index)))
+        {
+          return make_position(p_leaf, index);
+        }
+      }
+
+      return end_position();
+    }
+
+    //*************************************************************************
+    /// The first value whose key is not before 'key'.
+    //*************************************************************************
+    template <typename K>
+    position lower_bound_position(const K& key) const
+    {
+      leaf_node* p_leaf = find_leaf(key);
+
+      return (p_leaf == TYPHOON_NULLPTR) ? end_position() : make_position(p_leaf, leaf_lower_bound(*p_leaf, key));
+    }
+
+    //*************************************************************************
+    /// The first value whose key is after 'key'.
+    //*************************************************************************
+    template <typename K>
+    position upper_bound_position(const K& key) const
+    {
+      leaf_node* p_leaf = find_leaf(key);
+
+      return (p_leaf == TYPHOON_NULLPTR) ? end_position() : make_position(p_leaf, leaf_upper_bound(*p_leaf, key));
+    }
+
+    //*************************************************************************
+    /// Inserts a value with 'key', unless one is already present.
+    /// 'create' constructs the value at the address it is given.
+    /// Returns the position of the value with the key, and whether it was
+    /// inserted. Returns end if the tree is full.
+    //*************************************************************************
+    template <typename TCreate>
+    TYPHOON_OR_STD::pair<position, bool> insert_unique(const TKey& key, const TCreate& create)
+    {
+      if (p_root == TYPHOON_NULLPTR)
+      {
+        if (CAPACITY == 0U)
+        {
+          return TYPHOON_OR_STD::make_pair(end_position(), false);
+        }
+
+        leaf_node* p_leaf = allocate_leaf();
+        p_root  = p_leaf;
+        p_first = p_leaf;
+        p_last  = p_leaf;
+      }
+
+      path_type path;
+      leaf_node* p_leaf = find_leaf(key, path);
+      size_t     index  = leaf_lower_bound(*p_leaf, key);
+
+      if ((index != p_leaf->count) && !kcompare(key, leaf_key(*p_leaf, index)))
+      {
+        return TYPHOON_OR_STD::make_pair(make_position(p_leaf, index), false);
+      }
+
+      if (full())
+      {
+        return TYPHOON_OR_STD::make_pair(end_position(), false);
+      }
+
+      if (p_leaf->count == Leaf_Slots)
+      {
+        // Split the leaf, so that each half holds at least Min_Leaf values
+        // once the new one is in.
+        const size_t mid = (Leaf_Slots + 1U) / 2U;
+        const size_t from = (index < mid) ? mid - 1U : mid;
+
+        leaf_node* p_right = allocate_leaf();
+        move_leaf_values(*p_leaf, from, Leaf_Slots, *p_right, 0U);
+
+        p_right->next = p_leaf->next;
+        p_right->prev = p_leaf;
+
+        if (p_leaf->next == TYPHOON_NULLPTR)
+        {
+          p_last = p_right;
+        }
+        else
+        {
+          p_leaf->next->prev = p_right;
+        }
+
+        p_leaf->next = p_right;
+
+        if (index >= mid)
+        {
+          p_leaf = p_right;
+          index -= mid;
+        }
+
+        create_in_leaf(*p_leaf, index, key, create);
+
+        insert_in_parent(path, tree_height, leaf_key(*p_right, 0U), p_right);
+      }
+      else
+      {
+        create_in_leaf(*p_leaf, index, key, create);
+      }
+
+      ++current_size;
+
+      return TYPHOON_OR_STD::make_pair(make_position(p_leaf, index), true);
+    }
+
+    //*************************************************************************
+    /// Erases the value at 'pos', returning the position of the next value.
+    //*************************************************************************
+    position erase_position(position pos)
+    {
+      path_type path;
+      find_leaf(leaf_key(*pos.p_leaf, pos.index), path);
+
+      return erase_in_leaf(path, pos.p_leaf, pos.index);
+    }
+
+    //*************************************************************************
+    /// Erases the value with the key, returning whether there was one.
+    //*************************************************************************
+    template <typename K>
+    bool erase_key(const K& key)
+    {
+      if (p_root == TYPHOON_NULLPTR)
+      {
+        return false;
+      }
+
+      path_type path;
+      leaf_node* p_leaf = find_leaf(key, path);
+      size_t     index  = leaf_lower_bound(*p_leaf, key);
+
+      if ((index == p_leaf->count) || kcompare(key, leaf_key(*p_leaf, index)))
+      {
+        return false;
+      }
+
+      erase_in_leaf(path, p_leaf, index);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Builds the tree, which must be empty, from 'n' values in key order with
+    /// no repeats. The leaves are filled evenly rather than half full, as a
+    /// run of single inserts would leave them.
+    //*************************************************************************
+    template <typename TIterator>
+    void build_sorted(TIterator first, size_t n)
+    {
+      if (n == 0U)
+      {
+        return;
+      }
+
+      // The number of nodes on each level, leaves first.
+      size_t level_size[Max_Height + 1U];
+      size_t levels = 1U;
+
+      level_size[0] = (n + Leaf_Slots - 1U) / Leaf_Slots;
+
+      while (level_size[levels - 1U] > 1U)
+      {
+        level_size[levels] = (level_size[levels - 1U] + Branch_Keys) / (Branch_Keys + 1U);
+        ++levels;
+      }
+
+      build_state<TIterator> state = { first, n, level_size, TYPHOON_NULLPTR };
+
+      leaf_node* p_leftmost = TYPHOON_NULLPTR;
+      p_root      = build_node(state, levels - 1U, 0U, p_leftmost);
+      tree_height = levels - 1U;
+      p_first     = p_leftmost;
+      p_last      = state.p_previous;
+      current_size = n;
+    }
+
+    //*************************************************************************
+    /// Destroys all of the values and releases all of the nodes.
+    //*************************************************************************
+    void clear_all()
+    {
+      if (p_root != TYPHOON_NULLPTR)
+      {
+        release_node(p_root, tree_height);
+      }
+
+      p_root       = TYPHOON_NULLPTR;
+      p_first      = TYPHOON_NULLPTR;
+      p_last       = TYPHOON_NULLPTR;
+      tree_height  = 0U;
+      current_size = 0U;
+    }
+
+    TKeyCompare kcompare;
+
+  private:
+
+    //*************************************************************************
+    /// The branches passed on the way down to a leaf, and the child taken in
+    /// each.
+    //*************************************************************************
+    struct path_type
+    {
+      branch_node* branches[Max_Height];
+      size_t       slots[Max_Height];
+    };
+
+    //*************************************************************************
+    /// What build_node needs as it works along the values.
+    //*************************************************************************
+    template <typename TIterator>
+    struct build_state
+    {
+      TIterator     itr;
+      size_t        n;
+      const size_t* level_size;
+      leaf_node*    p_previous;
+    };
+
+    static const TKey* leaf_keys(const leaf_node& leaf, tpn::true_type)
+    {
+      return leaf.separate_keys.data();
+    }
+
+    //*************************************************************************
+    /// Without a separate copy, the values are the keys.
+    //*************************************************************************
+    static const TKey* leaf_keys(const leaf_node& leaf, tpn::false_type)
+    {
+      TYPHOON_STATIC_ASSERT((tpn::is_same<TKey, TValue>::value), "Values must be the keys unless the keys are held apart");
+
+      return leaf.values();
+    }
+
+    //*************************************************************************
+    /// The first of 'count' keys that is not before 'key'.
+    /// Each step moves the base by the comparison result times the step,
+    /// rather than branching on it, as the outcome is unpredictable.
+    //*************************************************************************
+    template <typename K>
+    size_t lower_bound_in(const TKey* keys, size_t count, const K& key) const
+    {
+      if (count == 0U)
+      {
+        return 0U;
+      }
+
+      const TKey* p_base = keys;
+
+      while (count > 1U)
+      {
+        const size_t half = count / 2U;
+        p_base += half * static_cast<size_t>(kcompare(p_base[half - 1U], key));
+        count -= half;
+      }
+
+      return static_cast<size_t>(p_base - keys) + (kcompare(*p_base, key) ? 1U : 0U);
+    }
+
+    //*************************************************************************
+    /// The first of 'count' keys that is after 'key'.
+    //*************************************************************************
+    template <typename K>
+    size_t upper_bound_in(const TKey* keys, size_t count, const K& key) const
+    {
+      if (count == 0U)
+      {
+        return 0U;
+      }
+
+      const TKey* p_base = keys;
+
+      while (count > 1U)
+      {
+        const size_t half = count / 2U;
+        p_base += half * static_cast<size_t>(!kcompare(key, p_base[half - 1U]));
+        count -= half;
+      }
+
+      return static_cast<size_t>(p_base - keys) + (kcompare(key, *p_base) ? 0U : 1U);
+    }
+
+    //*************************************************************************
+    /// The first value in the leaf whose key is not before 'key'.
+    //*************************************************************************
+    template <typename K>
+    size_t leaf_lower_bound(const leaf_node& leaf, const K& key) const
+    {
+      return lower_bound_in(leaf_keys(leaf, tpn::integral_constant<bool, VSeparate_Keys>()), leaf.count, key);
+    }
+
+    //*************************************************************************
+    /// The first value in the leaf whose key is after 'key'.
+    //*************************************************************************
+    template <typename K>
+    size_t leaf_upper_bound(const leaf_node& leaf, const K& key) const
+    {
+      return upper_bound_in(leaf_keys(leaf, tpn::integral_constant<bool, VSeparate_Keys>()), leaf.count, key);
+    }
+
+    //*************************************************************************
+    /// The child of the branch that would hold 'key'.
+    //*************************************************************************
+    template <typename K>
+    size_t branch_child(const branch_node& branch, const K& key) const
+    {
+      return upper_bound_in(branch.keys(), branch.count, key);
+    }
+
+    //*************************************************************************
+    /// Finds the leaf that would hold 'key', or null if the tree is empty.
+    //*************************************************************************
+    template <typename K>
+    leaf_node* find_leaf(const K& key) const
+    {
+      node* p_node = p_root;
+
+      for (size_t level = tree_height; (level != 0U) && (p_node != TYPHOON_NULLPTR); --level)
+      {
+        const branch_node* p_branch = static_cast<const branch_node*>(p_node);
+        p_node = p_branch->children[branch_child(*p_branch, key)];
+      }
+
+      return static_cast<leaf_node*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Finds the leaf that would hold 'key', recording the path to it.
+    /// The tree must not be empty.
+    //*************************************************************************
+    template <typename K>
+    leaf_node* find_leaf(const K& key, path_type& path) const
+    {
+      node* p_node = p_root;
+
+      for (size_t level = 0U; level != tree_height; ++level)
+      {
+        branch_node* p_branch = static_cast<branch_node*>(p_node);
+        const size_t slot     = branch_child(*p_branch, key);
+
+        path.branches[level] = p_branch;
+        path.slots[level]    = slot;
+        p_node = p_branch->children[slot];
+      }
+
+      return static_cast<leaf_node*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Allocates an empty leaf.
+    //*************************************************************************
+    leaf_node* allocate_leaf()
+    {
+      leaf_node* p_leaf = ::new (static_cast<void*>(p_leaf_pool->template allocate<leaf_node>())) leaf_node;
+      p_leaf->count = 0U;
+      p_leaf->prev  = TYPHOON_NULLPTR;
+      p_leaf->next  = TYPHOON_NULLPTR;
+
+      return p_leaf;
+    }
+
+    //*************************************************************************
+    /// Allocates an empty branch.
+    //*************************************************************************
+    branch_node* allocate_branch()
+    {
+      branch_node* p_branch = ::new (static_cast<void*>(p_branch_pool->template allocate<branch_node>())) branch_node;
+      p_branch->count = 0U;
+
+      return p_branch;
+    }
+
+    //*************************************************************************
+    /// Constructs a value, and its key copy, at 'index', moving the values
+    /// from there up out of the way.
+    //*************************************************************************
+    template <typename TCreate>
+    void create_in_leaf(leaf_node& leaf, size_t index, const TKey& key, const TCreate& create)
+    {
+      for (size_t i = leaf.count; i > index; --i)
+      {
+        relocate_leaf_value(leaf, i - 1U, leaf, i);
+      }
+
+      construct_key(leaf, index, key, tpn::integral_constant<bool, VSeparate_Keys>());
+      create(static_cast<void*>(leaf.values() + index));
+      ++leaf.count;
+    }
+
+    static void construct_key(leaf_node& leaf, size_t index, const TKey& key, tpn::true_type)
+    {
+      ::new (static_cast<void*>(leaf.separate_keys.data() + index)) TKey(key);
+    }
+
+    static void construct_key(leaf_node&, size_t, const TKey&, tpn::false_type)
+    {
+    }
+
+    //*************************************************************************
+    /// Destroys the value, and its key copy, at 'index', and closes the gap.
+    //*************************************************************************
+    static void destroy_in_leaf(leaf_node& leaf, size_t index)
+    {
+      destroy_leaf_value(leaf, index);
+
+      for (size_t i = index + 1U; i < leaf.count; ++i)
+      {
+        relocate_leaf_value(leaf, i, leaf, i - 1U);
+      }
+
+      --leaf.count;
+    }
+
+    static void destroy_leaf_value(leaf_node& leaf, size_t index)
+    {
+      destroy_key(leaf, index, tpn::integral_constant<bool, VSeparate_Keys>());
+      leaf.values()[index].~TValue();
+    }
+
+    static void destroy_key(leaf_node& leaf, size_t index, tpn::true_type)
+    {
+      leaf.separate_keys.data()[index].~TKey();
+    }
+
+    static void destroy_key(leaf_node&, size_t, tpn::false_type)
+    {
+    }
+
+    //*************************************************************************
+    /// Moves one value, and its key copy, to an unused slot.
+    //*************************************************************************
+    static void relocate_leaf_value(leaf_node& from, size_t from_index, leaf_node& to, size_t to_index)
+    {
+      relocate_key(from, from_index, to, to_index, tpn::integral_constant<bool, VSeparate_Keys>());
+      private_btree::relocate(from.values() + from_index, to.values() + to_index);
+    }
+
+    static void relocate_key(leaf_node& from, size_t from_index, leaf_node& to, size_t to_index, tpn::true_type)
+    {
+      private_btree::relocate(from.separate_keys.data() + from_index, to.separate_keys.data() + to_index);
+    }
+
+    static void relocate_key(leaf_node&, size_t, leaf_node&, size_t, tpn::false_type)
+    {
+    }
+
+    //*************************************************************************
+    /// Moves the values [first, last) of 'from' to the end of 'to', which
+    /// must have 'to_index' values.
+    //*************************************************************************
+    static void move_leaf_values(leaf_node& from, size_t first, size_t last, leaf_node& to, size_t to_index)
+    {
+      for (size_t i = first; i < last; ++i)
+      {
+        relocate_leaf_value(from, i, to, to_index++);
+      }
+
+      to.count   = to_index;
+      from.count = first;
+    }
+
+    //*************************************************************************
+    /// Inserts 'key' and the child to its right into the branch at 'level'
+    /// of the path, splitting it and carrying on upwards if it is full.
+    /// 'level' is the number of branches above the node that was split.
+    //*************************************************************************
+    void insert_in_parent(path_type& path, size_t level, const TKey& key, node* p_right)
+    {
+      if (level == 0U)
+      {
+        // The root was split.
+        branch_node* p_root_branch = allocate_branch();
+        ::new (static_cast<void*>(p_root_branch->keys())) TKey(key);
+        p_root_branch->children[0] = p_root;
+        p_root_branch->children[1] = p_right;
+        p_root_branch->count = 1U;
+
+        p_root = p_root_branch;
+        ++tree_height;
+        return;
+      }
+
+      branch_node& parent = *path.branches[level - 1U];
+      const size_t slot   = path.slots[level - 1U];
+
+      if (parent.count < Branch_Keys)
+      {
+        insert_in_branch(parent, slot, key, p_right);
+        return;
+      }
+
+      // Split the branch. With the new key there are Branch_Keys + 1, of
+      // which the one at 'mid' moves up and those after it move right.
+      const size_t mid = (Branch_Keys + 1U) / 2U;
+      TKey* keys = parent.keys();
+
+      branch_node& right = *allocate_branch();
+
+      if (slot < mid)
+      {
+        // The new key goes left, so the key now at mid - 1 moves up.
+        move_branch_keys(parent, mid, right);
+        TKey up(tpn::move(keys[mid - 1U]));
+        keys[mid - 1U].~TKey();
+        parent.count = mid - 1U;
+        insert_in_branch(parent, slot, key, p_right);
+
+        insert_in_parent(path, level - 1U, up, &right);
+      }
+      else if (slot == mid)
+      {
+        // The new key moves up, and its child starts the right branch.
+        move_branch_keys(parent, mid, right);
+        right.children[0] = p_right;
+
+        insert_in_parent(path, level - 1U, key, &right);
+      }
+      else
+      {
+        // The new key goes right, so the key at mid moves up.
+        move_branch_keys(parent, mid + 1U, right);
+        TKey up(tpn::move(keys[mid]));
+        keys[mid].~TKey();
+        parent.count = mid;
+        insert_in_branch(right, slot - mid - 1U, key, p_right);
+
+        insert_in_parent(path, level - 1U, up, &right);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the keys from 'first' on, and the children to their right, to
+    /// the empty branch 'to'. Child 'first' becomes the first child of 'to'.
+    //*************************************************************************
+    static void move_branch_keys(branch_node& from, size_t first, branch_node& to)
+    {
+      TKey* from_keys = from.keys();
+      TKey* to_keys   = to.keys();
+
+      to.children[0] = from.children[first];
+
+      size_t n = 0U;
+
+      for (size_t i = first; i < from.count; ++i, ++n)
+      {
+        private_btree::relocate(from_keys + i, to_keys + n);
+        to.children[n + 1U] = from.children[i + 1U];
+      }
+
+      to.count   = n;
+      from.count = first;
+    }
+
+    //*************************************************************************
+    /// Inserts a key at 'slot' and a child after it, in a branch with room.
+    //*************************************************************************
+    static void insert_in_branch(branch_node& branch, size_t slot, const TKey& key, node* p_child)
+    {
+      TKey* keys = branch.keys();
+
+      for (size_t i = branch.count; i > slot; --i)
+      {
+        private_btree::relocate(keys + i - 1U, keys + i);
+        branch.children[i + 1U] = branch.children[i];
+      }
+
+      ::new (static_cast<void*>(keys + slot)) TKey(key);
+      branch.children[slot + 1U] = p_child;
+      ++branch.count;
+    }
+
+    //*************************************************************************
+    /// Removes the key at 'slot' and the child after it.
+    //*************************************************************************
+    static void remove_from_branch(branch_node& branch, size_t slot)
+    {
+      TKey* keys = branch.keys();
+
+      keys[slot].~TKey();
+
+      for (size_t i = slot + 1U; i < branch.count; ++i)
+      {
+        private_btree::relocate(keys + i, keys + i - 1U);
+        branch.children[i] = branch.children[i + 1U];
+      }
+
+      --branch.count;
+    }
+
+    //*************************************************************************
+    /// Erases a value from a leaf reached by 'path', and rebalances.
+    /// Returns the position of the value that followed it.
+    //*************************************************************************
+    position erase_in_leaf(path_type& path, leaf_node* p_leaf, size_t index)
+    {
+      destroy_in_leaf(*p_leaf, index);
+      --current_size;
+
+      if (tree_height == 0U)
+      {
+        if (p_leaf->count == 0U)
+        {
+          p_leaf_pool->release(p_leaf);
+          p_root  = TYPHOON_NULLPTR;
+          p_first = TYPHOON_NULLPTR;
+          p_last  = TYPHOON_NULLPTR;
+
+          return end_position();
+        }
+
+        return make_position(p_leaf, index);
+      }
+
+      if (p_leaf->count >= Min_Leaf)
+      {
+        return make_position(p_leaf, index);
+      }
+
+      branch_node& parent = *path.branches[tree_height - 1U];
+      const size_t slot   = path.slots[tree_height - 1U];
+
+      leaf_node* p_left  = (slot != 0U)           ? static_cast<leaf_node*>(parent.children[slot - 1U]) : TYPHOON_NULLPTR;
+      leaf_node* p_right = (slot != parent.count) ? static_cast<leaf_node*>(parent.children[slot + 1U]) : TYPHOON_NULLPTR;
+
+      if ((p_left != TYPHOON_NULLPTR) && (p_left->count > Min_Leaf))
+      {
+        // Borrow the last value of the left sibling.
+        for (size_t i = p_leaf->count; i > 0U; --i)
+        {
+          relocate_leaf_value(*p_leaf, i - 1U, *p_leaf, i);
+        }
+
+        relocate_leaf_value(*p_left, p_left->count - 1U, *p_leaf, 0U);
+        --p_left->count;
+        ++p_leaf->count;
+
+        private_btree::replace_key(parent.keys() + slot - 1U, leaf_key(*p_leaf, 0U));
+
+        return make_position(p_leaf, index + 1U);
+      }
+
+      if ((p_right != TYPHOON_NULLPTR) && (p_right->count > Min_Leaf))
+      {
+        // Borrow the first value of the right sibling.
+        relocate_leaf_value(*p_right, 0U, *p_leaf, p_leaf->count);
+        ++p_leaf->count;
+
+        for (size_t i = 1U; i < p_right->count; ++i)
+        {
+          relocate_leaf_value(*p_right, i, *p_right, i - 1U);
+        }
+
+        --p_right->count;
+
+        private_btree::replace_key(parent.keys() + slot, leaf_key(*p_right, 0U));
+
+        return make_position(p_leaf, index);
+      }
+
+      position next;
+
+      if (p_left != TYPHOON_NULLPTR)
+      {
+        // Merge into the left sibling.
+        const size_t offset = p_left->count;
+        move_leaf_values(*p_leaf, 0U, p_leaf->count, *p_left, p_left->count);
+        unlink_leaf(p_leaf);
+        remove_from_branch(parent, slot - 1U);
+
+        next = make_position(p_left, offset + index);
+      }
+      else
+      {
+        // Merge the right sibling into this one.
+        move_leaf_values(*p_right, 0U, p_right->count, *p_leaf, p_leaf->count);
+        unlink_leaf(p_right);
+        remove_from_branch(parent, slot);
+
+        next = make_position(p_leaf, index);
+      }
+
+      rebalance_branch(path, tree_height - 1U);
+
+      return next;
+    }
+
+    //*************************************************************************
+    /// Removes an emptied leaf from the list and releases it.
+    //*************************************************************************
+    void unlink_leaf(leaf_node* p_leaf)
+    {
+      if (p_leaf->prev == TYPHOON_NULLPTR)
+      {
+        p_first = p_leaf->next;
+      }
+      else
+      {
+        p_leaf->prev->next = p_leaf->next;
+      }
+
+      if (p_leaf->next == TYPHOON_NULLPTR)
+      {
+        p_last = p_leaf->prev;
+      }
+      else
+      {
+        p_leaf->next->prev = p_leaf->prev;
+      }
+
+      p_leaf_pool->release(p_leaf);
+    }
+
+    //*************************************************************************
+    /// Restores the minimum fill of the branch at 'level' on the path, after
+    /// it has lost a key, and carries on upwards if that takes a key from
+    /// its parent.
+    //*************************************************************************
+    void rebalance_branch(path_type& path, size_t level)
+    {
+      branch_node& branch = *path.branches[level];
+
+      if (level == 0U)
+      {
+        if (branch.count == 0U)
+        {
+          // The root has one child left, which becomes the root.
+          p_root = branch.children[0];
+          p_branch_pool->release(&branch);
+          --tree_height;
+        }
+
+        return;
+      }
+
+      if (branch.count >= Min_Branch_Keys)
+      {
+        return;
+      }
+
+      branch_node& parent = *path.branches[level - 1U];
+      const size_t slot   = path.slots[level - 1U];
+      TKey* parent_keys   = parent.keys();
+      TKey* keys          = branch.keys();
+
+      branch_node* p_left  = (slot != 0U)           ? static_cast<branch_node*>(parent.children[slot - 1U]) : TYPHOON_NULLPTR;
+      branch_node* p_right = (slot != parent.count) ? static_cast<branch_node*>(parent.children[slot + 1U]) : TYPHOON_NULLPTR;
+
+      if ((p_left != TYPHOON_NULLPTR) && (p_left->count > Min_Branch_Keys))
+      {
+        // Rotate the last child of the left sibling through the parent.
+        TKey* left_keys = p_left->keys();
+
+        for (size_t i = branch.count; i > 0U; --i)
+        {
+          private_btree::relocate(keys + i - 1U, keys + i);
+          branch.children[i + 1U] = branch.children[i];
+        }
+
+        branch.children[1] = branch.children[0];
+        private_btree::relocate(parent_keys + slot - 1U, keys);
+        branch.children[0] = p_left->children[p_left->count];
+        ++branch.count;
+
+        private_btree::relocate(left_keys + p_left->count - 1U, parent_keys + slot - 1U);
+        --p_left->count;
+      }
+      else if ((p_right != TYPHOON_NULLPTR) && (p_right->count > Min_Branch_Keys))
+      {
+        // Rotate the first child of the right sibling through the parent.
+        TKey* right_keys = p_right->keys();
+
+        private_btree::relocate(parent_keys + slot, keys + branch.count);
+        branch.children[branch.count + 1U] = p_right->children[0];
+        ++branch.count;
+
+        private_btree::relocate(right_keys, parent_keys + slot);
+        p_right->children[0] = p_right->children[1];
+
+        for (size_t i = 1U; i < p_right->count; ++i)
+        {
+          private_btree::relocate(right_keys + i, right_keys + i - 1U);
+          p_right->children[i] = p_right->children[i + 1U];
+        }
+
+        --p_right->count;
+      }
+      else
+      {
+        // Merge with a sibling, pulling the separating key down.
+        branch_node& left  = (p_left != TYPHOON_NULLPTR) ? *p_left : branch;
+        branch_node& right = (p_left != TYPHOON_NULLPTR) ? branch  : *p_right;
+        const size_t key_slot = (p_left != TYPHOON_NULLPTR) ? slot - 1U : slot;
+
+        TKey* left_keys  = left.keys();
+        TKey* right_keys = right.keys();
+
+        // The separator is moved, not copied, so it is not destroyed when
+        // it is removed from the parent.
+        private_btree::relocate(parent_keys + key_slot, left_keys + left.count);
+        ::new (static_cast<void*>(parent_keys + key_slot)) TKey(left_keys[left.count]);
+        ++left.count;
+
+        left.children[left.count] = right.children[0];
+
+        for (size_t i = 0U; i < right.count; ++i)
+        {
+          private_btree::relocate(right_keys + i, left_keys + left.count);
+          ++left.count;
+          left.children[left.count] = right.children[i + 1U];
+        }
+
+        right.count = 0U;
+        p_branch_pool->release(&right);
+        remove_from_branch(parent, key_slot);
+
+        rebalance_branch(path, level - 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Builds node 'index' of 'level', and the nodes below it, returning it
+    /// and setting the leftmost leaf below it.
+    //*************************************************************************
+    template <typename TIterator>
+    node* build_node(build_state<TIterator>& state, size_t level, size_t index, leaf_node*& p_leftmost)
+    {
+      if (level == 0U)
+      {
+        // Spread the values evenly over the leaves.
+        const size_t leaves = state.level_size[0];
+        const size_t count  = (((index + 1U) * state.n) / leaves) - ((index * state.n) / leaves);
+
+        leaf_node* p_leaf = allocate_leaf();
+
+        for (size_t i = 0U; i < count; ++i, ++state.itr)
+        {
+          ::new (static_cast<void*>(p_leaf->values() + i)) TValue(*state.itr);
+          construct_key(*p_leaf, i, TKeyOf()(p_leaf->values()[i]), tpn::integral_constant<bool, VSeparate_Keys>());
+        }
+
+        p_leaf->count = count;
+        p_leaf->prev  = state.p_previous;
+
+        if (state.p_previous != TYPHOON_NULLPTR)
+        {
+          state.p_previous->next = p_leaf;
+        }
+
+        state.p_previous = p_leaf;
+        p_leftmost = p_leaf;
+
+        return p_leaf;
+      }
+
+      // Spread the children below evenly over the branches of this level.
+      const size_t below = state.level_size[level - 1U];
+      const size_t here  = state.level_size[level];
+      const size_t first = (index * below) / here;
+      const size_t last  = ((index + 1U) * below) / here;
+
+      branch_node* p_branch = allocate_branch();
+
+      p_branch->children[0] = build_node(state, level - 1U, first, p_leftmost);
+
+      for (size_t child = first + 1U; child < last; ++child)
+      {
+        leaf_node* p_child_leftmost = TYPHOON_NULLPTR;
+        const size_t slot = child - first;
+
+        p_branch->children[slot] = build_node(state, level - 1U, child, p_child_leftmost);
+        ::new (static_cast<void*>(p_branch->keys() + slot - 1U)) TKey(leaf_key(*p_child_leftmost, 0U));
+      }
+
+      p_branch->count = (last - first) - 1U;
+
+      return p_branch;
+    }
+
+    //*************************************************************************
+    /// Destroys the contents of a node and the nodes below it, and releases
+    /// them.
+    //*************************************************************************
+    void release_node(node* p_node, size_t level)
+    {
+      if (level == 0U)
+      {
+        leaf_node* p_leaf = static_cast<leaf_node*>(p_node);
+
+        for (size_t i = 0U; i < p_leaf->count; ++i)
+        {
+          destroy_leaf_value(*p_leaf, i);
+        }
+
+        p_leaf_pool->release(p_leaf);
+      }
+      else
+      {
+        branch_node* p_branch = static_cast<branch_node*>(p_node);
+        TKey*        keys     = p_branch->keys();
+
+        for (size_t i = 0U; i <= p_branch->count; ++i)
+        {
+          release_node(p_branch->children[i], level - 1U);
+        }
+
+        for (size_t i = 0U; i < p_branch->count; ++i)
+        {
+          keys[i].~TKey();
+        }
+
+        p_branch_pool->release(p_branch);
+      }
+    }
+
+  protected:
+
+    size_type    current_size;   ///< The number of values in the tree.
+    const size_type CAPACITY;    ///< The maximum number of values in the tree.
+    node*        p_root;         ///< The root, or null if empty.
+    leaf_node*   p_first;        ///< The first leaf, or null if empty.
+    leaf_node*   p_last;         ///< The last leaf, or null if empty.
+    size_t       tree_height;    ///< The number of branch levels above the leaves.
+    tpn::ipool*  p_leaf_pool;    ///< The pool of leaves.
+    tpn::ipool*  p_branch_pool;  ///< The pool of branches.
+  };
+}
+
+#endif
@@ -36,11 +36,52 @@ SOFTWARE.
 #include "../static_assert.hpp"
 #include "../binary.hpp"
 #include "../type_traits.hpp"
+#include "../utility.hpp"
 
-#include "stdint.hpp"
+#include "../cstdint.hpp"
 
 #include "crc_parameters.hpp"
 
+#include <string.h>
+
+//*****************************************************************************
+// Hardware CRC32-C.
+// Used by tpn::crc32_c when the target has a CRC32-C instruction.
+// With GCC or Clang on x86 the kernels are built for SSE4.2 by a function
+// attribute, so the policy is available as tpn::crc32_c_hardware without
+// -msse4.2. It is only the default for tpn::crc32_c when the whole build
+// targets SSE4.2, as the caller must otherwise check the CPU first.
+// Define TYPHOON_CRC_NO_HARDWARE to always use the table policies.
+//*****************************************************************************
+#if !defined(TYPHOON_CRC_NO_HARDWARE)
+  #if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #include <nmmintrin.h>
+    #define TYPHOON_CRC32_C_HARDWARE_X86 1
+    #define TYPHOON_CRC32_C_HARDWARE_TARGET __attribute__((target("sse4.2")))
+    #if defined(__SSE4_2__)
+      #define TYPHOON_CRC32_C_HARDWARE_DEFAULT 1
+    #endif
+  #elif defined(__SSE4_2__)
+    #include <nmmintrin.h>
+    #define TYPHOON_CRC32_C_HARDWARE_X86 1
+    #define TYPHOON_CRC32_C_HARDWARE_DEFAULT 1
+  #elif defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+    #include <arm_acle.h>
+    #define TYPHOON_CRC32_C_HARDWARE_ARM 1
+    #define TYPHOON_CRC32_C_HARDWARE_DEFAULT 1
+  #endif
+#endif
+
+#if defined(TYPHOON_CRC32_C_HARDWARE_X86) || defined(TYPHOON_CRC32_C_HARDWARE_ARM)
+  #define TYPHOON_CRC32_C_HARDWARE 1
+#else
+  #define TYPHOON_CRC32_C_HARDWARE 0
+#endif
+
+#if !defined(TYPHOON_CRC32_C_HARDWARE_TARGET)
+  #define TYPHOON_CRC32_C_HARDWARE_TARGET
+#endif
+
 #if defined(TYPHOON_COMPILER_KEIL)
 #pragma diag_suppress 1300
 #endif
@@ -557,6 +598,145 @@ namespace tpn
       }
     };
 
+#if TYPHOON_USING_CPP11
+    //*****************************************************************************
+    /// CRC slicing tables.
+    /// Slice k holds the CRC of each byte value followed by k zero bytes.
+    /// Generated at compile time.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_tables
+    {
+      struct slice_type
+      {
+        TAccumulator entry[256U];
+      };
+
+      slice_type slice[Slices];
+
+      //*************************************************************************
+      /// Shifts one bit through the CRC.
+      //*************************************************************************
+      static constexpr TAccumulator shift_bit(TAccumulator crc)
+      {
+        return Reflect ? TAccumulator((crc & TAccumulator(1U)) ? (crc >> 1U) ^ tpn::reverse_bits_const<TAccumulator, Polynomial>::value : (crc >> 1U))
+                       : TAccumulator((crc & (TAccumulator(1U) << (Accumulator_Bits - 1U))) ? (crc << 1U) ^ Polynomial : (crc << 1U));
+      }
+
+      //*************************************************************************
+      static constexpr TAccumulator shift_bits(TAccumulator crc, size_t n)
+      {
+        return (n == 0U) ? crc : shift_bits(shift_bit(crc), n - 1U);
+      }
+
+      //*************************************************************************
+      static constexpr TAccumulator make_entry(size_t slice_index, size_t index)
+      {
+        return shift_bits(Reflect ? TAccumulator(index) : TAccumulator(TAccumulator(index) << (Accumulator_Bits - 8U)), 8U * (slice_index + 1U));
+      }
+
+      //*************************************************************************
+      template <size_t... Indices>
+      static constexpr slice_type make_slice(size_t slice_index, tpn::index_sequence<Indices...>)
+      {
+        return slice_type{ { make_entry(slice_index, Indices)... } };
+      }
+
+      //*************************************************************************
+      template <size_t... Slice_Indices>
+      static constexpr crc_slice_tables make(tpn::index_sequence<Slice_Indices...>)
+      {
+        return crc_slice_tables{ { make_slice(Slice_Indices, tpn::make_index_sequence<256U>())... } };
+      }
+    };
+
+    //*****************************************************************************
+    /// Slicing-by-N table.
+    /// Blocks of N bytes are added with N independent table lookups.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_table
+    {
+      typedef crc_slice_tables<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices> tables_type;
+
+      TYPHOON_STATIC_ASSERT(Slices >= (Accumulator_Bits / 8U), "Not enough slices for the accumulator");
+
+      // Tells tpn::frame_check_sequence that blocks may be added at once.
+      typedef void supports_block_add;
+
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, uint8_t value) const
+      {
+        return crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, value, tables().slice[0].entry);
+      }
+
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, const uint8_t* data, size_t length) const
+      {
+        static TYPHOON_CONSTANT size_t Accumulator_Bytes = Accumulator_Bits / 8U;
+
+        const tables_type& t = tables();
+
+        while (length >= Slices)
+        {
+          TAccumulator result = 0U;
+
+          for (size_t i = 0U; i < Slices; ++i)
+          {
+            uint8_t value = data[i];
+
+            // The current CRC overlays the first bytes of the block.
+            if (i < Accumulator_Bytes)
+            {
+              value ^= Reflect ? uint8_t(crc >> (8U * i))
+                               : uint8_t(crc >> (Accumulator_Bits - (8U * (i + 1U))));
+            }
+
+            result ^= t.slice[Slices - 1U - i].entry[value];
+          }
+
+          crc     = result;
+          data   += Slices;
+          length -= Slices;
+        }
+
+        while (length != 0U)
+        {
+          crc = add(crc, *data++);
+          --length;
+        }
+
+        return crc;
+      }
+
+    private:
+
+      //*************************************************************************
+      static const tables_type& tables()
+      {
+        static constexpr tables_type table = tables_type::make(tpn::make_index_sequence<Slices>());
+
+        return table;
+      }
+    };
+
+    //*********************************
+    // Table size of 2048. Slicing-by-8.
+    template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
+    struct crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 2048U>
+      : public crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U>
+    {
+    };
+
+    //*********************************
+    // Table size of 4096. Slicing-by-16.
+    template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
+    struct crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 4096U>
+      : public crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U>
+    {
+    };
+#endif
+
     //*****************************************************************************
     // CRC Policies.
     //*****************************************************************************
@@ -646,17 +826,172 @@ namespace tpn
         return crc ^ TCrcParameters::Xor_Out;
       }
     };
+
+#if TYPHOON_USING_CPP11
+    //*********************************
+    // Policy for 4096 entry table. Slicing-by-16.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 4096U> : public crc_table<typename TCrcParameters::accumulator_type, 
+                                                                TCrcParameters::Accumulator_Bits, 
+                                                                8U, 
+                                                                0xFFU, 
+                                                                TCrcParameters::Polynomial, 
+                                                                TCrcParameters::Reflect, 
+                                                                4096U> 
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      TYPHOON_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? tpn::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    //*********************************
+    // Policy for 2048 entry table. Slicing-by-8.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 2048U> : public crc_table<typename TCrcParameters::accumulator_type, 
+                                                                TCrcParameters::Accumulator_Bits, 
+                                                                8U, 
+                                                                0xFFU, 
+                                                                TCrcParameters::Polynomial, 
+                                                                TCrcParameters::Reflect, 
+                                                                2048U> 
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      TYPHOON_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? tpn::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+#endif
+
+#if TYPHOON_CRC32_C_HARDWARE
+    //*****************************************************************************
+    /// Policy for CRC32-C using the target's CRC32-C instructions.
+    /// The instructions implement the reflected update without inversion,
+    /// so the results are identical to the table policies.
+    /// Only the kernels are built for the instructions, so that no inline
+    /// function shared with other code is.
+    //*****************************************************************************
+    struct crc32_c_hardware_policy
+    {
+      typedef uint32_t accumulator_type;
+      typedef accumulator_type value_type;
+
+      // Tells tpn::frame_check_sequence that blocks may be added at once.
+      typedef void supports_block_add;
+
+      //*************************************************************************
+      TYPHOON_CONSTEXPR accumulator_type initial() const
+      {
+        return tpn::reverse_bits_const<accumulator_type, crc32_c_parameters::Initial>::value;
+      }
+
+      //*************************************************************************
+      TYPHOON_CRC32_C_HARDWARE_TARGET
+      accumulator_type add(accumulator_type crc, uint8_t value) const
+      {
+#if defined(TYPHOON_CRC32_C_HARDWARE_X86)
+        return _mm_crc32_u8(crc, value);
+#else
+        return __crc32cb(crc, value);
+#endif
+      }
+
+      //*************************************************************************
+      TYPHOON_CRC32_C_HARDWARE_TARGET
+      accumulator_type add(accumulator_type crc, const uint8_t* data, size_t length) const
+      {
+        while (length >= 8U)
+        {
+          uint64_t block;
+          memcpy(&block, data, sizeof(block));
+
+#if defined(TYPHOON_CRC32_C_HARDWARE_X86) && defined(__x86_64__)
+          crc = uint32_t(_mm_crc32_u64(crc, block));
+#elif defined(TYPHOON_CRC32_C_HARDWARE_X86)
+          crc = _mm_crc32_u32(crc, uint32_t(block));
+          crc = _mm_crc32_u32(crc, uint32_t(block >> 32U));
+#else
+          crc = __crc32cd(crc, block);
+#endif
+          data   += 8U;
+          length -= 8U;
+        }
+
+        while (length != 0U)
+        {
+          crc = add(crc, *data++);
+          --length;
+        }
+
+        return crc;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ crc32_c_parameters::Xor_Out;
+      }
+    };
+#endif
+
+    //*****************************************************************************
+    /// Selects the policy for a CRC type.
+    //*****************************************************************************
+    template <typename TCrcParameters, size_t Table_Size>
+    struct crc_policy_select
+    {
+      typedef crc_policy<TCrcParameters, Table_Size> type;
+    };
+
+#if defined(TYPHOON_CRC32_C_HARDWARE_DEFAULT)
+    //*********************************
+    // CRC32-C uses the hardware, whatever the table size.
+    template <size_t Table_Size>
+    struct crc_policy_select<crc32_c_parameters, Table_Size>
+    {
+      typedef crc32_c_hardware_policy type;
+    };
+#endif
   }
 
   //*****************************************************************************
   /// Basic parameterised CRC type.
+  /// Table sizes of 2048 and 4096 select slicing-by-8 and slicing-by-16,
+  /// which add contiguous blocks several bytes at a time (C++11 or above).
+  /// TPolicy is normally left as the default.
   //*****************************************************************************
-  template <typename TCrcParameters, size_t Table_Size>
-  class crc_type : public tpn::frame_check_sequence<private_crc::crc_policy<TCrcParameters, Table_Size> >
+  template <typename TCrcParameters, size_t Table_Size, typename TPolicy = typename private_crc::crc_policy_select<TCrcParameters, Table_Size>::type>
+  class crc_type : public tpn::frame_check_sequence<TPolicy>
   {
   public:
 
+#if TYPHOON_USING_CPP11
+    TYPHOON_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || (Table_Size == 2048U) || (Table_Size == 4096U), "Table size must be 4, 16, 256, 2048 or 4096");
+#else
     TYPHOON_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+#endif
 
     //*************************************************************************
     /// Default constructor.
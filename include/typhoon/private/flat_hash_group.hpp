@@ -0,0 +1,564 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2016 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_PRIVATE_FLAT_HASH_GROUP_HPP
+#define TYPHOON_PRIVATE_FLAT_HASH_GROUP_HPP
+
+#include "../platform.hpp"
+#include "../binary.hpp"
+#include "../endianness.hpp"
+#include "../type_traits.hpp"
+#include "../power.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// Group probing for the flat hash containers.
+// Each slot has a control byte that is either empty, deleted, or holds the
+// low 7 bits of the hash of the slot's key. A lookup compares a whole group
+// of control bytes with the hash at once, and only looks at the keys whose
+// control byte matches.
+// SSE2 is used when the target has it, otherwise the bytes are compared
+// a machine word at a time (SWAR).
+// Define TYPHOON_FLAT_HASH_NO_SIMD to always use the SWAR groups.
+//*****************************************************************************
+#if !defined(TYPHOON_FLAT_HASH_NO_SIMD)
+  #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define TYPHOON_FLAT_HASH_SSE2 1
+  #endif
+#endif
+
+#if !defined(TYPHOON_FLAT_HASH_SSE2)
+  #define TYPHOON_FLAT_HASH_SSE2 0
+#endif
+
+namespace tpn
+{
+  namespace private_flat_hash
+  {
+    //*************************************************************************
+    /// Control byte values.
+    /// A full slot holds the 7 bit hash fragment, so has its top bit clear.
+    //*************************************************************************
+    static TYPHOON_CONSTANT uint8_t ctrl_empty   = 0x80U;
+    static TYPHOON_CONSTANT uint8_t ctrl_deleted = 0xFEU;
+
+    //*************************************************************************
+    /// Mixes the user's hash, as many tpn::hash specialisations return the
+    /// key unchanged and the low bits would otherwise decide everything.
+    //*************************************************************************
+    inline size_t mix(size_t h)
+    {
+#if TYPHOON_USING_64BIT_TYPES
+      if (sizeof(size_t) == sizeof(uint64_t))
+      {
+        uint64_t x = static_cast<uint64_t>(h) * UINT64_C(0x9E3779B97F4A7C15);
+        return static_cast<size_t>(x ^ (x >> 32U));
+      }
+#endif
+
+      uint32_t x = static_cast<uint32_t>(h) * 0x9E3779B9UL;
+      return static_cast<size_t>(x ^ (x >> 16U));
+    }
+
+    //*************************************************************************
+    /// The 7 bit fragment stored in the control byte.
+    //*************************************************************************
+    inline uint8_t h2(size_t h)
+    {
+      return static_cast<uint8_t>(h & 0x7FU);
+    }
+
+    //*************************************************************************
+    /// The part of the hash that selects the first group to probe.
+    //*************************************************************************
+    inline size_t h1(size_t h)
+    {
+      return h >> 7U;
+    }
+
+#if TYPHOON_FLAT_HASH_SSE2
+    //*************************************************************************
+    /// A group of 16 control bytes, compared with SSE2.
+    /// Each mask has one bit per slot.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+      typedef uint32_t mask_type;
+
+      static TYPHOON_CONSTANT size_t WIDTH         = 16U;
+      static TYPHOON_CONSTANT size_t BITS_PER_SLOT = 1U;
+
+      //*******************************
+      explicit group(const uint8_t* ctrl)
+        : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+      {
+      }
+
+      //*******************************
+      /// Slots whose control byte equals 'h'.
+      //*******************************
+      mask_type match(uint8_t h) const
+      {
+        return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(h)))));
+      }
+
+      //*******************************
+      mask_type match_empty() const
+      {
+        return match(ctrl_empty);
+      }
+
+      //*******************************
+      mask_type match_empty_or_deleted() const
+      {
+        return static_cast<mask_type>(_mm_movemask_epi8(bytes));
+      }
+
+      //*******************************
+      mask_type match_full() const
+      {
+        return static_cast<mask_type>(_mm_movemask_epi8(bytes)) ^ 0xFFFFU;
+      }
+
+      //*******************************
+      /// The slot of the lowest bit in a non-zero mask.
+      //*******************************
+      static size_t lowest(mask_type mask)
+      {
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+        return static_cast<size_t>(__builtin_ctz(mask));
+#else
+        return static_cast<size_t>(tpn::count_trailing_zeros(mask));
+#endif
+      }
+
+    private:
+
+      __m128i bytes;
+    };
+#else
+    //*************************************************************************
+    /// A group of control bytes in one machine word, compared with
+    /// arithmetic on the whole word.
+    /// Each mask has the top bit of each matching byte set.
+    /// match() may report a false positive in the byte above a true match,
+    /// which the key comparison then rejects.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+#if TYPHOON_USING_64BIT_TYPES
+      typedef tpn::conditional<(sizeof(void*) >= sizeof(uint64_t)), uint64_t, uint32_t>::type mask_type;
+#else
+      typedef uint32_t mask_type;
+#endif
+
+      static TYPHOON_CONSTANT size_t WIDTH         = sizeof(mask_type);
+      static TYPHOON_CONSTANT size_t BITS_PER_SLOT = 8U;
+
+      //*******************************
+      explicit group(const uint8_t* ctrl)
+      {
+        memcpy(&bytes, ctrl, sizeof(bytes));
+
+        // The masks number the slots from the least significant byte.
+        if (tpn::endianness::value() == tpn::endian::big)
+        {
+          bytes = tpn::reverse_bytes(bytes);
+        }
+      }
+
+      //*******************************
+      /// Slots whose control byte equals 'h'.
+      //*******************************
+      mask_type match(uint8_t h) const
+      {
+        const mask_type x = bytes ^ (lsbs() * h);
+
+        return (x - lsbs()) & ~x & msbs();
+      }
+
+      //*******************************
+      mask_type match_empty() const
+      {
+        // Empty is the only control byte with the top bit set and bit 1 clear.
+        return bytes & (~bytes << 6U) & msbs();
+      }
+
+      //*******************************
+      mask_type match_empty_or_deleted() const
+      {
+        return bytes & msbs();
+      }
+
+      //*******************************
+      mask_type match_full() const
+      {
+        return ~bytes & msbs();
+      }
+
+      //*******************************
+      /// The slot of the lowest bit in a non-zero mask.
+      //*******************************
+      static size_t lowest(mask_type mask)
+      {
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+        return (sizeof(mask_type) == sizeof(unsigned long long)) ? static_cast<size_t>(__builtin_ctzll(mask)) >> 3U
+                                                                 : static_cast<size_t>(__builtin_ctzl(static_cast<unsigned long>(mask))) >> 3U;
+#else
+        return static_cast<size_t>(tpn::count_trailing_zeros(mask)) >> 3U;
+#endif
+      }
+
+    private:
+
+      //*******************************
+      static mask_type lsbs()
+      {
+        return static_cast<mask_type>(~mask_type(0U) / 0xFFU);
+      }
+
+      //*******************************
+      static mask_type msbs()
+      {
+        return static_cast<mask_type>(lsbs() << 7U);
+      }
+
+      mask_type bytes;
+    };
+#endif
+
+    //*************************************************************************
+    /// The number of slots needed to hold 'Size' elements with a maximum
+    /// load of 7/8. Always a power of 2 number of whole groups.
+    //*************************************************************************
+    template <size_t Size>
+    struct slot_count
+    {
+    private:
+
+      static TYPHOON_CONSTANT size_t minimum = Size + ((Size + 6U) / 7U);
+      static TYPHOON_CONSTANT size_t groups  = (minimum + group::WIDTH - 1U) / group::WIDTH;
+
+    public:
+
+      static TYPHOON_CONSTANT size_t value = tpn::power_of_2_round_up<groups>::value * group::WIDTH;
+    };
+
+    //*************************************************************************
+    /// The control bytes of a table.
+    /// Groups are aligned to a multiple of the group width, and are probed
+    /// in triangular order, which visits every group once when the number
+    /// of groups is a power of 2.
+    //*************************************************************************
+    class control
+    {
+    public:
+
+      static TYPHOON_CONSTANT size_t npos = ~size_t(0U);
+
+      //*******************************
+      control(uint8_t* ctrl_, size_t n_slots_)
+        : ctrl(ctrl_)
+        , n_slots(n_slots_)
+        , group_mask((n_slots_ / group::WIDTH) - 1U)
+      {
+      }
+
+      //*******************************
+      /// The probe sequence of a hash.
+      //*******************************
+      class probe
+      {
+      public:
+
+        //*****************************
+        probe(size_t h, size_t mask_)
+          : mask(mask_)
+          , offset(h1(h) & mask_)
+          , step(0U)
+        {
+        }
+
+        //*****************************
+        /// The first slot of the current group.
+        //*****************************
+        size_t first_slot() const
+        {
+          return offset * group::WIDTH;
+        }
+
+        //*****************************
+        void next()
+        {
+          ++step;
+          offset = (offset + step) & mask;
+        }
+
+        //*****************************
+        /// True once every group has been visited.
+        //*****************************
+        bool done() const
+        {
+          return step > mask;
+        }
+
+      private:
+
+        size_t mask;
+        size_t offset;
+        size_t step;
+      };
+
+      //*******************************
+      probe make_probe(size_t h) const
+      {
+        return probe(h, group_mask);
+      }
+
+      //*******************************
+      group load(size_t first_slot) const
+      {
+        return group(ctrl + first_slot);
+      }
+
+      //*******************************
+      /// The first empty or deleted slot in the probe sequence of 'h'.
+      //*******************************
+      size_t find_first_non_full(size_t h) const
+      {
+        probe seq = make_probe(h);
+
+        while (!seq.done())
+        {
+          const group::mask_type mask = load(seq.first_slot()).match_empty_or_deleted();
+
+          if (mask != 0U)
+          {
+            return seq.first_slot() + group::lowest(mask);
+          }
+
+          seq.next();
+        }
+
+        return npos;
+      }
+
+      //*******************************
+      /// A position in the table, for iteration.
+      /// 'done' marks the slots of the current group at or before 'index'.
+      /// The control bytes are read again on each step, so slots erased
+      /// after the cursor was made are skipped.
+      //*******************************
+      struct cursor
+      {
+        size_t           index;
+        size_t           first;
+        group::mask_type done;
+      };
+
+      //*******************************
+      /// Sets 'c' to the first full slot at or after 'i', or to the slot
+      /// count if there is none.
+      //*******************************
+      void seek(cursor& c, size_t i) const
+      {
+        if (i >= n_slots)
+        {
+          c.index = n_slots;
+          c.first = n_slots;
+          c.done  = 0U;
+        }
+        else
+        {
+          c.first = i - (i % group::WIDTH);
+
+          const group::mask_type before = (group::mask_type(1U) << ((i - c.first) * group::BITS_PER_SLOT)) - 1U;
+
+          select(c, load(c.first).match_full() & ~before);
+        }
+      }
+
+      //*******************************
+      /// Sets 'c' to slot 'i', which must be full, or to the slot count.
+      //*******************************
+      void locate(cursor& c, size_t i) const
+      {
+        if (i >= n_slots)
+        {
+          c.index = n_slots;
+          c.first = n_slots;
+          c.done  = 0U;
+        }
+        else
+        {
+          c.index = i;
+          c.first = i - (i % group::WIDTH);
+
+          // Every bit up to and including the top bit of slot 'i'.
+          c.done = ((group::mask_type(1U) << ((((i - c.first) + 1U) * group::BITS_PER_SLOT) - 1U)) << 1U) - 1U;
+        }
+      }
+
+      //*******************************
+      /// Moves 'c' to the next full slot, or to the slot count if there is none.
+      /// The next position only depends on the current one through 'done',
+      /// so consecutive steps do not wait for each other's loads.
+      //*******************************
+      void advance(cursor& c) const
+      {
+        select(c, load(c.first).match_full() & ~c.done);
+      }
+
+      //*******************************
+      bool is_full(size_t i) const
+      {
+        return (ctrl[i] & 0x80U) == 0U;
+      }
+
+      //*******************************
+      bool is_deleted(size_t i) const
+      {
+        return ctrl[i] == ctrl_deleted;
+      }
+
+      //*******************************
+      bool is_empty(size_t i) const
+      {
+        return ctrl[i] == ctrl_empty;
+      }
+
+      //*******************************
+      void set(size_t i, uint8_t value)
+      {
+        ctrl[i] = value;
+      }
+
+      //*******************************
+      /// Frees slot 'i'.
+      /// The slot can only be marked empty if its group already has an
+      /// empty slot, as a lookup stops at the first group with one.
+      /// Returns true if it had to be left as a tombstone.
+      //*******************************
+      bool erase(size_t i)
+      {
+        const size_t first = i - (i % group::WIDTH);
+
+        if (load(first).match_empty() != 0U)
+        {
+          ctrl[i] = ctrl_empty;
+          return false;
+        }
+        else
+        {
+          ctrl[i] = ctrl_deleted;
+          return true;
+        }
+      }
+
+      //*******************************
+      /// Marks every slot empty.
+      //*******************************
+      void reset()
+      {
+        memset(ctrl, ctrl_empty, n_slots);
+      }
+
+      //*******************************
+      /// Prepares for the tombstones to be dropped.
+      /// Deleted slots become empty, and full slots become deleted so
+      /// that they can be found and re-placed.
+      //*******************************
+      void convert_for_rehash()
+      {
+        for (size_t i = 0U; i < n_slots; ++i)
+        {
+          ctrl[i] = is_full(i) ? ctrl_deleted : ctrl_empty;
+        }
+      }
+
+      //*******************************
+      /// The group that slot 'i' is in.
+      //*******************************
+      static size_t group_of(size_t i)
+      {
+        return i / group::WIDTH;
+      }
+
+      //*******************************
+      size_t size() const
+      {
+        return n_slots;
+      }
+
+    private:
+
+      //*******************************
+      /// Moves 'c' to the lowest slot in 'mask', searching the following
+      /// groups if it is empty.
+      //*******************************
+      void select(cursor& c, group::mask_type mask) const
+      {
+        while (mask == 0U)
+        {
+          c.first += group::WIDTH;
+
+          if (c.first >= n_slots)
+          {
+            c.index = n_slots;
+            c.first = n_slots;
+            c.done  = 0U;
+            return;
+          }
+
+          mask = load(c.first).match_full();
+        }
+
+        const group::mask_type lowest_bit = mask & (~mask + 1U);
+
+        c.done  = lowest_bit | (lowest_bit - 1U);
+        c.index = c.first + group::lowest(mask);
+      }
+
+      uint8_t* ctrl;
+      size_t   n_slots;
+      size_t   group_mask;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,171 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2016 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_PRIVATE_FLAT_MERGE_HPP
+#define TYPHOON_PRIVATE_FLAT_MERGE_HPP
+
+#include "../platform.hpp"
+#include "../algorithm.hpp"
+#include "../vector.hpp"
+#include "../span.hpp"
+
+#include <stddef.h>
+
+//*****************************************************************************
+// Bulk insertion for the flat containers.
+// Inserting a range one value at a time shifts the tail of the lookup for
+// each value, which is O(N^2). Instead, the values are appended to the
+// lookup as a batch, sorted, and merged with the existing values in one
+// backward pass. The free part of the lookup after the batch is used as the
+// scratch buffer for both the sort and the merge, so a batch may use at most
+// half of the free space.
+//*****************************************************************************
+namespace tpn
+{
+  namespace private_flat
+  {
+    //*************************************************************************
+    /// Orders pointers to map values by their keys.
+    //*************************************************************************
+    template <typename TValue, typename TKeyCompare>
+    struct compare_pointed_keys
+    {
+      bool operator ()(const TValue* lhs, const TValue* rhs) const
+      {
+        return comp(lhs->first, rhs->first);
+      }
+
+      TKeyCompare comp;
+    };
+
+    //*************************************************************************
+    /// Orders pointers to set values.
+    //*************************************************************************
+    template <typename TValue, typename TKeyCompare>
+    struct compare_pointed_values
+    {
+      bool operator ()(const TValue* lhs, const TValue* rhs) const
+      {
+        return comp(*lhs, *rhs);
+      }
+
+      TKeyCompare comp;
+    };
+
+    //*************************************************************************
+    /// The number of values that may be appended as the next batch.
+    //*************************************************************************
+    template <typename TValue>
+    size_t batch_size(const tpn::ivector<TValue*>& lookup)
+    {
+      return (lookup.capacity() - lookup.size()) / 2U;
+    }
+
+    //*************************************************************************
+    /// Merges the values appended to 'lookup' after its first 'count' into
+    /// their sorted places.
+    ///\param sorted  The batch is already in order.
+    ///\param unique  Each key may appear once. A value whose key is already
+    ///               present, or appeared earlier in the batch, is removed
+    ///               and passed to 'policy.discard'.
+    /// Equal keys keep the order they were appended in, after any existing
+    /// values with the same key.
+    //*************************************************************************
+    template <typename TValue, typename TCompare, typename TPolicy>
+    void merge_batch(tpn::ivector<TValue*>& lookup, size_t count, TCompare compare, bool sorted, bool unique, TPolicy& policy)
+    {
+      TValue** const values = lookup.data();
+      TValue** const batch  = values + count;
+      size_t         length = lookup.size() - count;
+
+      if (!sorted)
+      {
+        tpn::merge_sort(batch, batch + length, tpn::span<TValue*>(batch + length, lookup.capacity() - lookup.size()), compare);
+      }
+
+      if (unique)
+      {
+        // Drop repeats within the batch, and keys that are already present.
+        // Both are in order, so one pass over each does it.
+        size_t existing = 0U;
+        size_t kept     = 0U;
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          TValue* const value = batch[i];
+
+          while ((existing < count) && compare(values[existing], value))
+          {
+            ++existing;
+          }
+
+          const bool present  = (existing < count) && !compare(value, values[existing]);
+          const bool repeated = (kept != 0U) && !compare(batch[kept - 1U], value);
+
+          if (present || repeated)
+          {
+            policy.discard(value);
+          }
+          else
+          {
+            batch[kept++] = value;
+          }
+        }
+
+        length = kept;
+      }
+
+      // Move the batch to the top of the lookup's buffer, clear of the merged
+      // result, then merge from the back.
+      TValue** const source = values + lookup.capacity() - length;
+      tpn::copy_backward(batch, batch + length, source + length);
+
+      size_t i = count;
+      size_t j = length;
+      size_t w = count + length;
+
+      while (j != 0U)
+      {
+        if ((i != 0U) && compare(source[j - 1U], values[i - 1U]))
+        {
+          values[--w] = values[--i];
+        }
+        else
+        {
+          values[--w] = source[--j];
+        }
+      }
+
+      lookup.uninitialized_resize(count + length);
+    }
+  }
+}
+
+#endif
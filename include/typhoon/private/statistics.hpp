@@ -0,0 +1,769 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2016 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_PRIVATE_STATISTICS_HPP
+#define TYPHOON_PRIVATE_STATISTICS_HPP
+
+#include "../platform.hpp"
+#include "../type_traits.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Block kernels and accumulators for mean, rms, variance, standard_deviation,
+// covariance and correlation.
+// Floating point reductions cannot be reordered by the compiler, so float and
+// double blocks are summed in AVX, SSE2 or NEON lanes when the target has
+// them. Other types use the same loops a value at a time, which the compiler
+// is free to vectorise.
+// Floating point variances sum the values relative to a shift that follows
+// the mean (Welford's update, a block at a time), and partial results are
+// combined with Chan's update, so they do not lose precision when the mean
+// is large compared to the spread. Integral variances keep exact sums.
+// Define TYPHOON_STATISTICS_NO_SIMD to always use the scalar loops.
+//*****************************************************************************
+#if !defined(TYPHOON_STATISTICS_NO_SIMD)
+  #if defined(__AVX__)
+    #include <immintrin.h>
+    #define TYPHOON_STATISTICS_AVX 1
+  #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define TYPHOON_STATISTICS_SSE2 1
+  #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define TYPHOON_STATISTICS_NEON 1
+  #endif
+#endif
+
+namespace tpn
+{
+  namespace private_statistics
+  {
+    //*************************************************************************
+    /// The lanes that a block is summed in.
+    /// By default, one value converted to TCalc.
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    struct lanes
+    {
+      typedef TCalc type;
+
+      static TYPHOON_CONSTANT size_t Width = 1U;
+
+      static type  load(const TInput* p)   { return TCalc(*p); }
+      static type  broadcast(TCalc value)  { return value; }
+      static type  add(type a, type b)     { return a + b; }
+      static type  sub(type a, type b)     { return a - b; }
+      static type  mul(type a, type b)     { return a * b; }
+      static TCalc reduce(type a)          { return a; }
+    };
+
+#if TYPHOON_STATISTICS_AVX
+    //*************************************************************************
+    template <>
+    struct lanes<float, float>
+    {
+      typedef __m256 type;
+
+      static TYPHOON_CONSTANT size_t Width = 8U;
+
+      static type  load(const float* p)   { return _mm256_loadu_ps(p); }
+      static type  broadcast(float value) { return _mm256_set1_ps(value); }
+      static type  add(type a, type b)    { return _mm256_add_ps(a, b); }
+      static type  sub(type a, type b)    { return _mm256_sub_ps(a, b); }
+      static type  mul(type a, type b)    { return _mm256_mul_ps(a, b); }
+
+      static float reduce(type a)
+      {
+        __m128 v = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+        v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+
+        return _mm_cvtss_f32(v);
+      }
+    };
+
+    //*************************************************************************
+    template <>
+    struct lanes<double, double>
+    {
+      typedef __m256d type;
+
+      static TYPHOON_CONSTANT size_t Width = 4U;
+
+      static type   load(const double* p)    { return _mm256_loadu_pd(p); }
+      static type   broadcast(double value)  { return _mm256_set1_pd(value); }
+      static type   add(type a, type b)      { return _mm256_add_pd(a, b); }
+      static type   sub(type a, type b)      { return _mm256_sub_pd(a, b); }
+      static type   mul(type a, type b)      { return _mm256_mul_pd(a, b); }
+
+      static double reduce(type a)
+      {
+        __m128d v = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+        v = _mm_add_sd(v, _mm_unpackhi_pd(v, v));
+
+        return _mm_cvtsd_f64(v);
+      }
+    };
+#elif TYPHOON_STATISTICS_SSE2
+    //*************************************************************************
+    template <>
+    struct lanes<float, float>
+    {
+      typedef __m128 type;
+
+      static TYPHOON_CONSTANT size_t Width = 4U;
+
+      static type  load(const float* p)   { return _mm_loadu_ps(p); }
+      static type  broadcast(float value) { return _mm_set1_ps(value); }
+      static type  add(type a, type b)    { return _mm_add_ps(a, b); }
+      static type  sub(type a, type b)    { return _mm_sub_ps(a, b); }
+      static type  mul(type a, type b)    { return _mm_mul_ps(a, b); }
+
+      static float reduce(type a)
+      {
+        a = _mm_add_ps(a, _mm_movehl_ps(a, a));
+        a = _mm_add_ss(a, _mm_shuffle_ps(a, a, 1));
+
+        return _mm_cvtss_f32(a);
+      }
+    };
+
+    //*************************************************************************
+    template <>
+    struct lanes<double, double>
+    {
+      typedef __m128d type;
+
+      static TYPHOON_CONSTANT size_t Width = 2U;
+
+      static type   load(const double* p)    { return _mm_loadu_pd(p); }
+      static type   broadcast(double value)  { return _mm_set1_pd(value); }
+      static type   add(type a, type b)      { return _mm_add_pd(a, b); }
+      static type   sub(type a, type b)      { return _mm_sub_pd(a, b); }
+      static type   mul(type a, type b)      { return _mm_mul_pd(a, b); }
+
+      static double reduce(type a)
+      {
+        return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)));
+      }
+    };
+#elif TYPHOON_STATISTICS_NEON
+    //*************************************************************************
+    template <>
+    struct lanes<float, float>
+    {
+      typedef float32x4_t type;
+
+      static TYPHOON_CONSTANT size_t Width = 4U;
+
+      static type  load(const float* p)   { return vld1q_f32(p); }
+      static type  broadcast(float value) { return vdupq_n_f32(value); }
+      static type  add(type a, type b)    { return vaddq_f32(a, b); }
+      static type  sub(type a, type b)    { return vsubq_f32(a, b); }
+      static type  mul(type a, type b)    { return vmulq_f32(a, b); }
+
+      static float reduce(type a)
+      {
+        const float32x2_t v = vadd_f32(vget_low_f32(a), vget_high_f32(a));
+
+        return vget_lane_f32(vpadd_f32(v, v), 0);
+      }
+    };
+
+  #if defined(__aarch64__)
+    //*************************************************************************
+    template <>
+    struct lanes<double, double>
+    {
+      typedef float64x2_t type;
+
+      static TYPHOON_CONSTANT size_t Width = 2U;
+
+      static type   load(const double* p)    { return vld1q_f64(p); }
+      static type   broadcast(double value)  { return vdupq_n_f64(value); }
+      static type   add(type a, type b)      { return vaddq_f64(a, b); }
+      static type   sub(type a, type b)      { return vsubq_f64(a, b); }
+      static type   mul(type a, type b)      { return vmulq_f64(a, b); }
+      static double reduce(type a)           { return vgetq_lane_f64(a, 0) + vgetq_lane_f64(a, 1); }
+    };
+  #endif
+#endif
+
+    //*************************************************************************
+    /// The sum of the values.
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    TCalc sum(const TInput* p, size_t n)
+    {
+      typedef lanes<TCalc, TInput> lanes_t;
+      typedef typename lanes_t::type lane_t;
+
+      lane_t a0 = lanes_t::broadcast(TCalc(0));
+      lane_t a1 = a0;
+      size_t i  = 0U;
+
+      for (; (i + (2U * lanes_t::Width)) <= n; i += (2U * lanes_t::Width))
+      {
+        a0 = lanes_t::add(a0, lanes_t::load(p + i));
+        a1 = lanes_t::add(a1, lanes_t::load(p + i + lanes_t::Width));
+      }
+
+      TCalc result = lanes_t::reduce(lanes_t::add(a0, a1));
+
+      for (; i < n; ++i)
+      {
+        result += TCalc(p[i]);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The sum of the squares of the values.
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    TCalc sum_of_squares(const TInput* p, size_t n)
+    {
+      typedef lanes<TCalc, TInput> lanes_t;
+      typedef typename lanes_t::type lane_t;
+
+      lane_t a0 = lanes_t::broadcast(TCalc(0));
+      lane_t a1 = a0;
+      size_t i  = 0U;
+
+      for (; (i + (2U * lanes_t::Width)) <= n; i += (2U * lanes_t::Width))
+      {
+        const lane_t v0 = lanes_t::load(p + i);
+        const lane_t v1 = lanes_t::load(p + i + lanes_t::Width);
+        a0 = lanes_t::add(a0, lanes_t::mul(v0, v0));
+        a1 = lanes_t::add(a1, lanes_t::mul(v1, v1));
+      }
+
+      TCalc result = lanes_t::reduce(lanes_t::add(a0, a1));
+
+      for (; i < n; ++i)
+      {
+        result += TCalc(p[i]) * TCalc(p[i]);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The sums of d and d * d, where d is the value less 'shift'.
+    //*************************************************************************
+    template <typename TCalc, typename TInput>
+    void shifted_sums(const TInput* p, size_t n, TCalc shift, TCalc& sum_d, TCalc& sum_dd)
+    {
+      typedef lanes<TCalc, TInput> lanes_t;
+      typedef typename lanes_t::type lane_t;
+
+      const lane_t k  = lanes_t::broadcast(shift);
+      lane_t       s  = lanes_t::broadcast(TCalc(0));
+      lane_t       ss = s;
+      size_t       i  = 0U;
+
+      for (; (i + lanes_t::Width) <= n; i += lanes_t::Width)
+      {
+        const lane_t d = lanes_t::sub(lanes_t::load(p + i), k);
+        s  = lanes_t::add(s, d);
+        ss = lanes_t::add(ss, lanes_t::mul(d, d));
+      }
+
+      sum_d  = lanes_t::reduce(s);
+      sum_dd = lanes_t::reduce(ss);
+
+      for (; i < n; ++i)
+      {
+        const TCalc d = TCalc(p[i]) - shift;
+        sum_d  += d;
+        sum_dd += d * d;
+      }
+    }
+
+    //*************************************************************************
+    /// The sums of dx, dy, dx * dx, dy * dy and dx * dy, where dx and dy are
+    /// the values less their shifts.
+    //*************************************************************************
+    template <typename TCalc>
+    struct pair_sums
+    {
+      TCalc x;
+      TCalc y;
+      TCalc xx;
+      TCalc yy;
+      TCalc xy;
+    };
+
+    template <typename TCalc, typename TInput>
+    void shifted_pair_sums(const TInput* px, const TInput* py, size_t n, TCalc shift_x, TCalc shift_y, pair_sums<TCalc>& sums)
+    {
+      typedef lanes<TCalc, TInput> lanes_t;
+      typedef typename lanes_t::type lane_t;
+
+      const lane_t kx = lanes_t::broadcast(shift_x);
+      const lane_t ky = lanes_t::broadcast(shift_y);
+      lane_t       sx = lanes_t::broadcast(TCalc(0));
+      lane_t       sy = sx;
+      lane_t       sxx = sx;
+      lane_t       syy = sx;
+      lane_t       sxy = sx;
+      size_t       i  = 0U;
+
+      for (; (i + lanes_t::Width) <= n; i += lanes_t::Width)
+      {
+        const lane_t dx = lanes_t::sub(lanes_t::load(px + i), kx);
+        const lane_t dy = lanes_t::sub(lanes_t::load(py + i), ky);
+        sx  = lanes_t::add(sx, dx);
+        sy  = lanes_t::add(sy, dy);
+        sxx = lanes_t::add(sxx, lanes_t::mul(dx, dx));
+        syy = lanes_t::add(syy, lanes_t::mul(dy, dy));
+        sxy = lanes_t::add(sxy, lanes_t::mul(dx, dy));
+      }
+
+      sums.x  = lanes_t::reduce(sx);
+      sums.y  = lanes_t::reduce(sy);
+      sums.xx = lanes_t::reduce(sxx);
+      sums.yy = lanes_t::reduce(syy);
+      sums.xy = lanes_t::reduce(sxy);
+
+      for (; i < n; ++i)
+      {
+        const TCalc dx = TCalc(px[i]) - shift_x;
+        const TCalc dy = TCalc(py[i]) - shift_y;
+        sums.x  += dx;
+        sums.y  += dy;
+        sums.xx += dx * dx;
+        sums.yy += dy * dy;
+        sums.xy += dx * dy;
+      }
+    }
+
+    //*************************************************************************
+    /// Values are summed relative to a shift, which is moved to the mean
+    /// after each block, so the sums stay small and precise.
+    //*************************************************************************
+    static TYPHOON_CONSTANT uint32_t Block_Size = 1024U;
+
+    //*************************************************************************
+    /// The count and the sums of d and d * d, where d is the value less a
+    /// shift. Moving the shift to the mean every block makes this Welford's
+    /// update applied a block at a time, without a division per value.
+    /// Partial results are combined with Chan's update.
+    /// Integral types keep exact sums instead.
+    //*************************************************************************
+    template <typename TCalc, bool Is_Floating = tpn::is_floating_point<TCalc>::value>
+    struct moments
+    {
+      void clear()
+      {
+        counter = 0U;
+        shift   = TCalc(0);
+        sum_d   = TCalc(0);
+        sum_dd  = TCalc(0);
+      }
+
+      template <typename TInput>
+      void add(TInput value)
+      {
+        if (counter == 0U)
+        {
+          shift = TCalc(value);
+        }
+
+        const TCalc d = TCalc(value) - shift;
+        sum_d  += d;
+        sum_dd += d * d;
+
+        if ((++counter % Block_Size) == 0U)
+        {
+          recentre();
+        }
+      }
+
+      template <typename TInput>
+      void add(const TInput* p, size_t n)
+      {
+        while (n != 0U)
+        {
+          const size_t length = (n < Block_Size) ? n : Block_Size;
+
+          if (counter == 0U)
+          {
+            shift = TCalc(p[0]);
+          }
+
+          TCalc block_d;
+          TCalc block_dd;
+          shifted_sums(p, length, shift, block_d, block_dd);
+
+          sum_d   += block_d;
+          sum_dd  += block_dd;
+          counter += uint32_t(length);
+          recentre();
+
+          p += length;
+          n -= length;
+        }
+      }
+
+      //*******************************
+      /// Chan's update.
+      //*******************************
+      void merge(const moments& other)
+      {
+        if (other.counter != 0U)
+        {
+          if (counter == 0U)
+          {
+            *this = other;
+          }
+          else
+          {
+            const TCalc n1    = TCalc(counter);
+            const TCalc n2    = TCalc(other.counter);
+            const TCalc n     = n1 + n2;
+            const TCalc mean1 = shift + (sum_d / n1);
+            const TCalc delta = (other.shift + (other.sum_d / n2)) - mean1;
+
+            sum_dd   = squared_deviations() + other.squared_deviations() + (delta * delta * ((n1 * n2) / n));
+            shift    = mean1 + (delta * (n2 / n));
+            sum_d    = TCalc(0);
+            counter += other.counter;
+          }
+        }
+      }
+
+      double variance(int adjustment) const
+      {
+        return double(squared_deviations()) / (double(counter) - adjustment);
+      }
+
+      //*******************************
+      /// The sum of the squared deviations from the mean.
+      //*******************************
+      TCalc squared_deviations() const
+      {
+        return sum_dd - ((sum_d * sum_d) / TCalc(counter));
+      }
+
+      //*******************************
+      /// Moves the shift to the mean.
+      //*******************************
+      void recentre()
+      {
+        const TCalc n = TCalc(counter);
+
+        sum_dd = squared_deviations();
+        shift += sum_d / n;
+        sum_d  = TCalc(0);
+      }
+
+      uint32_t counter;
+      TCalc    shift;
+      TCalc    sum_d;
+      TCalc    sum_dd;
+    };
+
+    //*************************************************************************
+    template <typename TCalc>
+    struct moments<TCalc, false>
+    {
+      void clear()
+      {
+        counter        = 0U;
+        sum            = TCalc(0);
+        sum_of_squares = TCalc(0);
+      }
+
+      template <typename TInput>
+      void add(TInput value)
+      {
+        sum            += TCalc(value);
+        sum_of_squares += TCalc(value) * TCalc(value);
+        ++counter;
+      }
+
+      template <typename TInput>
+      void add(const TInput* p, size_t n)
+      {
+        sum            += private_statistics::sum<TCalc>(p, n);
+        sum_of_squares += private_statistics::sum_of_squares<TCalc>(p, n);
+        counter        += uint32_t(n);
+      }
+
+      void merge(const moments& other)
+      {
+        sum            += other.sum;
+        sum_of_squares += other.sum_of_squares;
+        counter        += other.counter;
+      }
+
+      double variance(int adjustment) const
+      {
+        const double n = double(counter);
+
+        return ((n * double(sum_of_squares)) - (double(sum) * double(sum))) / (n * (n - adjustment));
+      }
+
+      uint32_t counter;
+      TCalc    sum;
+      TCalc    sum_of_squares;
+    };
+
+    //*************************************************************************
+    /// The count and shifted sums of two series, as for moments.
+    /// Integral types keep exact sums instead.
+    //*************************************************************************
+    template <typename TCalc, bool Is_Floating = tpn::is_floating_point<TCalc>::value>
+    struct co_moments
+    {
+      void clear()
+      {
+        counter = 0U;
+        shift1  = TCalc(0);
+        shift2  = TCalc(0);
+        sums.x  = TCalc(0);
+        sums.y  = TCalc(0);
+        sums.xx = TCalc(0);
+        sums.yy = TCalc(0);
+        sums.xy = TCalc(0);
+      }
+
+      template <typename TInput>
+      void add(TInput value1, TInput value2)
+      {
+        if (counter == 0U)
+        {
+          shift1 = TCalc(value1);
+          shift2 = TCalc(value2);
+        }
+
+        const TCalc dx = TCalc(value1) - shift1;
+        const TCalc dy = TCalc(value2) - shift2;
+        sums.x  += dx;
+        sums.y  += dy;
+        sums.xx += dx * dx;
+        sums.yy += dy * dy;
+        sums.xy += dx * dy;
+
+        if ((++counter % Block_Size) == 0U)
+        {
+          recentre();
+        }
+      }
+
+      template <typename TInput>
+      void add(const TInput* p1, const TInput* p2, size_t n)
+      {
+        while (n != 0U)
+        {
+          const size_t length = (n < Block_Size) ? n : Block_Size;
+
+          if (counter == 0U)
+          {
+            shift1 = TCalc(p1[0]);
+            shift2 = TCalc(p2[0]);
+          }
+
+          pair_sums<TCalc> block;
+          shifted_pair_sums(p1, p2, length, shift1, shift2, block);
+
+          sums.x  += block.x;
+          sums.y  += block.y;
+          sums.xx += block.xx;
+          sums.yy += block.yy;
+          sums.xy += block.xy;
+          counter += uint32_t(length);
+          recentre();
+
+          p1 += length;
+          p2 += length;
+          n  -= length;
+        }
+      }
+
+      //*******************************
+      /// Chan's update.
+      //*******************************
+      void merge(const co_moments& other)
+      {
+        if (other.counter != 0U)
+        {
+          if (counter == 0U)
+          {
+            *this = other;
+          }
+          else
+          {
+            const TCalc n1     = TCalc(counter);
+            const TCalc n2     = TCalc(other.counter);
+            const TCalc n      = n1 + n2;
+            const TCalc weight = (n1 * n2) / n;
+            const TCalc mean1  = shift1 + (sums.x / n1);
+            const TCalc mean2  = shift2 + (sums.y / n1);
+            const TCalc delta1 = (other.shift1 + (other.sums.x / n2)) - mean1;
+            const TCalc delta2 = (other.shift2 + (other.sums.y / n2)) - mean2;
+
+            sums.xx  = deviations(sums.xx, sums.x, sums.x) + other.deviations(other.sums.xx, other.sums.x, other.sums.x) + (delta1 * delta1 * weight);
+            sums.yy  = deviations(sums.yy, sums.y, sums.y) + other.deviations(other.sums.yy, other.sums.y, other.sums.y) + (delta2 * delta2 * weight);
+            sums.xy  = deviations(sums.xy, sums.x, sums.y) + other.deviations(other.sums.xy, other.sums.x, other.sums.y) + (delta1 * delta2 * weight);
+            shift1   = mean1 + (delta1 * (n2 / n));
+            shift2   = mean2 + (delta2 * (n2 / n));
+            sums.x   = TCalc(0);
+            sums.y   = TCalc(0);
+            counter += other.counter;
+          }
+        }
+      }
+
+      double covariance(int adjustment) const
+      {
+        return double(deviations(sums.xy, sums.x, sums.y)) / (double(counter) - adjustment);
+      }
+
+      double variance1(int adjustment) const
+      {
+        return double(deviations(sums.xx, sums.x, sums.x)) / (double(counter) - adjustment);
+      }
+
+      double variance2(int adjustment) const
+      {
+        return double(deviations(sums.yy, sums.y, sums.y)) / (double(counter) - adjustment);
+      }
+
+      //*******************************
+      /// A sum of products of deviations from the means.
+      //*******************************
+      TCalc deviations(TCalc sum_of_products, TCalc sum_a, TCalc sum_b) const
+      {
+        return sum_of_products - ((sum_a * sum_b) / TCalc(counter));
+      }
+
+      //*******************************
+      /// Moves the shifts to the means.
+      //*******************************
+      void recentre()
+      {
+        const TCalc n = TCalc(counter);
+
+        sums.xx = deviations(sums.xx, sums.x, sums.x);
+        sums.yy = deviations(sums.yy, sums.y, sums.y);
+        sums.xy = deviations(sums.xy, sums.x, sums.y);
+        shift1 += sums.x / n;
+        shift2 += sums.y / n;
+        sums.x  = TCalc(0);
+        sums.y  = TCalc(0);
+      }
+
+      uint32_t         counter;
+      TCalc            shift1;
+      TCalc            shift2;
+      pair_sums<TCalc> sums;
+    };
+
+    //*************************************************************************
+    template <typename TCalc>
+    struct co_moments<TCalc, false>
+    {
+      void clear()
+      {
+        counter         = 0U;
+        sum1            = TCalc(0);
+        sum2            = TCalc(0);
+        sum_of_squares1 = TCalc(0);
+        sum_of_squares2 = TCalc(0);
+        inner_product   = TCalc(0);
+      }
+
+      template <typename TInput>
+      void add(TInput value1, TInput value2)
+      {
+        sum1            += TCalc(value1);
+        sum2            += TCalc(value2);
+        sum_of_squares1 += TCalc(value1) * TCalc(value1);
+        sum_of_squares2 += TCalc(value2) * TCalc(value2);
+        inner_product   += TCalc(value1) * TCalc(value2);
+        ++counter;
+      }
+
+      template <typename TInput>
+      void add(const TInput* p1, const TInput* p2, size_t n)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          add(p1[i], p2[i]);
+        }
+      }
+
+      void merge(const co_moments& other)
+      {
+        sum1            += other.sum1;
+        sum2            += other.sum2;
+        sum_of_squares1 += other.sum_of_squares1;
+        sum_of_squares2 += other.sum_of_squares2;
+        inner_product   += other.inner_product;
+        counter         += other.counter;
+      }
+
+      double covariance(int adjustment) const
+      {
+        const double n = double(counter);
+
+        return ((n * double(inner_product)) - (double(sum1) * double(sum2))) / (n * (n - adjustment));
+      }
+
+      double variance1(int adjustment) const
+      {
+        const double n = double(counter);
+
+        return ((n * double(sum_of_squares1)) - (double(sum1) * double(sum1))) / (n * (n - adjustment));
+      }
+
+      double variance2(int adjustment) const
+      {
+        const double n = double(counter);
+
+        return ((n * double(sum_of_squares2)) - (double(sum2) * double(sum2))) / (n * (n - adjustment));
+      }
+
+      uint32_t counter;
+      TCalc    sum1;
+      TCalc    sum2;
+      TCalc    sum_of_squares1;
+      TCalc    sum_of_squares2;
+      TCalc    inner_product;
+    };
+  }
+}
+
+#endif
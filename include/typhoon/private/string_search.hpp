@@ -0,0 +1,907 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2016 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_PRIVATE_STRING_SEARCH_HPP
+#define TYPHOON_PRIVATE_STRING_SEARCH_HPP
+
+#include "../platform.hpp"
+#include "../binary.hpp"
+#include "../endianness.hpp"
+#include "../type_traits.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// Character and substring search for the strings and string views.
+// Strings of single byte characters are scanned a block at a time, with
+// AVX2, SSE2 or NEON when the target has them, otherwise a machine word at
+// a time (SWAR). Other character types use the plain loops.
+// Define TYPHOON_STRING_SEARCH_NO_SIMD to always use the SWAR blocks.
+//*****************************************************************************
+#if !defined(TYPHOON_STRING_SEARCH_NO_SIMD)
+  #if defined(__AVX2__)
+    #include <immintrin.h>
+    #define TYPHOON_STRING_SEARCH_AVX2 1
+  #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define TYPHOON_STRING_SEARCH_SSE2 1
+  #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define TYPHOON_STRING_SEARCH_NEON 1
+  #endif
+#endif
+
+//*****************************************************************************
+// The block scanners cannot run in a constant expression, so the constexpr
+// string_view members only use them when the compiler can tell whether it
+// is evaluating one.
+//*****************************************************************************
+#if defined(__has_builtin)
+  #if __has_builtin(__builtin_is_constant_evaluated)
+    #define TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+  #endif
+#endif
+
+#if !defined(TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED)
+  #if (defined(TYPHOON_COMPILER_GCC) && (__GNUC__ >= 9)) || (defined(_MSC_VER) && (_MSC_VER >= 1925))
+    #define TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+  #elif TYPHOON_USING_CPP14
+    #define TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED() true
+  #else
+    #define TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED() false
+  #endif
+#endif
+
+namespace tpn
+{
+  namespace private_string_search
+  {
+    static TYPHOON_CONSTANT size_t npos = ~size_t(0U);
+
+    /// Character sets up to this size are compared a block at a time.
+    /// Larger sets use a lookup table.
+    static TYPHOON_CONSTANT size_t MAX_BLOCK_SET = 8U;
+
+    //*************************************************************************
+    /// Characters that can be scanned as bytes.
+    //*************************************************************************
+    template <typename T>
+    struct is_byte_character : public tpn::integral_constant<bool, (sizeof(T) == 1U) && tpn::is_integral<T>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// The plain loops, used for wide characters and constant expressions.
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t scalar_find(const T* s, size_t n, T c, bool equal)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        if ((s[i] == c) == equal)
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t scalar_rfind(const T* s, size_t n, T c, bool equal)
+    {
+      while (n != 0U)
+      {
+        --n;
+
+        if ((s[n] == c) == equal)
+        {
+          return n;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 bool scalar_contains(const T* set, size_t m, T c)
+    {
+      for (size_t j = 0U; j < m; ++j)
+      {
+        if (set[j] == c)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t scalar_find_of(const T* s, size_t n, const T* set, size_t m, bool in)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        if (scalar_contains(set, m, s[i]) == in)
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t scalar_rfind_of(const T* s, size_t n, const T* set, size_t m, bool in)
+    {
+      while (n != 0U)
+      {
+        --n;
+
+        if (scalar_contains(set, m, s[n]) == in)
+        {
+          return n;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 bool scalar_equal(const T* a, const T* b, size_t m)
+    {
+      for (size_t j = 0U; j < m; ++j)
+      {
+        if (a[j] != b[j])
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The first position of 'p' in 's'. 0 < m <= n.
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t scalar_search(const T* s, size_t n, const T* p, size_t m)
+    {
+      for (size_t i = 0U; i <= (n - m); ++i)
+      {
+        if ((s[i] == p[0]) && scalar_equal(s + i + 1U, p + 1U, m - 1U))
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// The last position of 'p' in 's'. 0 < m <= n.
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t scalar_rsearch(const T* s, size_t n, const T* p, size_t m)
+    {
+      size_t i = n - m + 1U;
+
+      while (i != 0U)
+      {
+        --i;
+
+        if ((s[i] == p[0]) && scalar_equal(s + i + 1U, p + 1U, m - 1U))
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+#if TYPHOON_STRING_SEARCH_AVX2
+    //*************************************************************************
+    /// 32 characters compared with AVX2.
+    /// Each mask has one bit per character.
+    //*************************************************************************
+    struct block
+    {
+      typedef __m256i  vector_type;
+      typedef uint32_t mask_type;
+
+      static TYPHOON_CONSTANT size_t WIDTH         = 32U;
+      static TYPHOON_CONSTANT size_t BITS_PER_CHAR = 1U;
+
+      static vector_type load(const uint8_t* p)              { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+      static vector_type splat(uint8_t c)                    { return _mm256_set1_epi8(static_cast<char>(c)); }
+      static vector_type equal(vector_type a, vector_type b) { return _mm256_cmpeq_epi8(a, b); }
+      static vector_type either(vector_type a, vector_type b){ return _mm256_or_si256(a, b); }
+      static vector_type both(vector_type a, vector_type b)  { return _mm256_and_si256(a, b); }
+      static mask_type   mask(vector_type v)                 { return static_cast<mask_type>(_mm256_movemask_epi8(v)); }
+      static mask_type   all()                               { return 0xFFFFFFFFUL; }
+      static mask_type   lane()                              { return 1U; }
+
+      static size_t lowest(mask_type mask)
+      {
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+        return static_cast<size_t>(__builtin_ctz(mask));
+#else
+        return static_cast<size_t>(tpn::count_trailing_zeros(mask));
+#endif
+      }
+
+      static size_t highest(mask_type mask)
+      {
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+        return 31U - static_cast<size_t>(__builtin_clz(mask));
+#else
+        return 31U - static_cast<size_t>(tpn::count_leading_zeros(mask));
+#endif
+      }
+    };
+#elif TYPHOON_STRING_SEARCH_SSE2
+    //*************************************************************************
+    /// 16 characters compared with SSE2.
+    /// Each mask has one bit per character.
+    //*************************************************************************
+    struct block
+    {
+      typedef __m128i  vector_type;
+      typedef uint32_t mask_type;
+
+      static TYPHOON_CONSTANT size_t WIDTH         = 16U;
+      static TYPHOON_CONSTANT size_t BITS_PER_CHAR = 1U;
+
+      static vector_type load(const uint8_t* p)              { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+      static vector_type splat(uint8_t c)                    { return _mm_set1_epi8(static_cast<char>(c)); }
+      static vector_type equal(vector_type a, vector_type b) { return _mm_cmpeq_epi8(a, b); }
+      static vector_type either(vector_type a, vector_type b){ return _mm_or_si128(a, b); }
+      static vector_type both(vector_type a, vector_type b)  { return _mm_and_si128(a, b); }
+      static mask_type   mask(vector_type v)                 { return static_cast<mask_type>(_mm_movemask_epi8(v)); }
+      static mask_type   all()                               { return 0xFFFFU; }
+      static mask_type   lane()                              { return 1U; }
+
+      static size_t lowest(mask_type mask)
+      {
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+        return static_cast<size_t>(__builtin_ctz(mask));
+#else
+        return static_cast<size_t>(tpn::count_trailing_zeros(mask));
+#endif
+      }
+
+      static size_t highest(mask_type mask)
+      {
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+        return 31U - static_cast<size_t>(__builtin_clz(mask));
+#else
+        return 31U - static_cast<size_t>(tpn::count_leading_zeros(mask));
+#endif
+      }
+    };
+#elif TYPHOON_STRING_SEARCH_NEON
+    //*************************************************************************
+    /// 16 characters compared with NEON.
+    /// NEON has no byte mask instruction, so each mask is the comparison
+    /// narrowed to four bits per character.
+    //*************************************************************************
+    struct block
+    {
+      typedef uint8x16_t vector_type;
+      typedef uint64_t   mask_type;
+
+      static TYPHOON_CONSTANT size_t WIDTH         = 16U;
+      static TYPHOON_CONSTANT size_t BITS_PER_CHAR = 4U;
+
+      static vector_type load(const uint8_t* p)              { return vld1q_u8(p); }
+      static vector_type splat(uint8_t c)                    { return vdupq_n_u8(c); }
+      static vector_type equal(vector_type a, vector_type b) { return vceqq_u8(a, b); }
+      static vector_type either(vector_type a, vector_type b){ return vorrq_u8(a, b); }
+      static vector_type both(vector_type a, vector_type b)  { return vandq_u8(a, b); }
+      static mask_type   all()                               { return ~mask_type(0U); }
+      static mask_type   lane()                              { return 0xFU; }
+
+      static mask_type mask(vector_type v)
+      {
+        return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+      }
+
+      static size_t lowest(mask_type mask)
+      {
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+        return static_cast<size_t>(__builtin_ctzll(mask)) >> 2U;
+#else
+        return static_cast<size_t>(tpn::count_trailing_zeros(mask)) >> 2U;
+#endif
+      }
+
+      static size_t highest(mask_type mask)
+      {
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+        return (63U - static_cast<size_t>(__builtin_clzll(mask))) >> 2U;
+#else
+        return (63U - static_cast<size_t>(tpn::count_leading_zeros(mask))) >> 2U;
+#endif
+      }
+    };
+#else
+    //*************************************************************************
+    /// The characters in one machine word, compared with arithmetic on the
+    /// whole word.
+    /// Each mask has the top bit of each matching byte set.
+    //*************************************************************************
+    struct block
+    {
+#if TYPHOON_USING_64BIT_TYPES
+      typedef tpn::conditional<(sizeof(void*) >= sizeof(uint64_t)), uint64_t, uint32_t>::type vector_type;
+#else
+      typedef uint32_t vector_type;
+#endif
+      typedef vector_type mask_type;
+
+      static TYPHOON_CONSTANT size_t WIDTH         = sizeof(vector_type);
+      static TYPHOON_CONSTANT size_t BITS_PER_CHAR = 8U;
+
+      //*******************************
+      static vector_type load(const uint8_t* p)
+      {
+        vector_type v;
+        memcpy(&v, p, sizeof(v));
+
+        // The masks number the characters from the least significant byte.
+        if (tpn::endianness::value() == tpn::endian::big)
+        {
+          v = tpn::reverse_bytes(v);
+        }
+
+        return v;
+      }
+
+      //*******************************
+      static vector_type splat(uint8_t c)
+      {
+        return lsbs() * c;
+      }
+
+      //*******************************
+      /// Sets the top bit of each byte that is equal.
+      /// Unlike the usual zero byte test, this has no false positives,
+      /// so the masks may be inverted.
+      //*******************************
+      static vector_type equal(vector_type a, vector_type b)
+      {
+        const vector_type x = a ^ b;
+
+        return ~(((x & ~msbs()) + ~msbs()) | x) & msbs();
+      }
+
+      static vector_type either(vector_type a, vector_type b) { return a | b; }
+      static vector_type both(vector_type a, vector_type b)   { return a & b; }
+      static mask_type   mask(vector_type v)                  { return v; }
+      static mask_type   all()                                { return msbs(); }
+      static mask_type   lane()                               { return 0x80U; }
+
+      //*******************************
+      static size_t lowest(mask_type mask)
+      {
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+        return (sizeof(mask_type) == sizeof(unsigned long long)) ? static_cast<size_t>(__builtin_ctzll(mask)) >> 3U
+                                                                 : static_cast<size_t>(__builtin_ctzl(static_cast<unsigned long>(mask))) >> 3U;
+#else
+        return static_cast<size_t>(tpn::count_trailing_zeros(mask)) >> 3U;
+#endif
+      }
+
+      //*******************************
+      static size_t highest(mask_type mask)
+      {
+#if defined(TYPHOON_COMPILER_GCC) || defined(TYPHOON_COMPILER_CLANG)
+        return (sizeof(mask_type) == sizeof(unsigned long long)) ? (WIDTH - 1U) - (static_cast<size_t>(__builtin_clzll(mask)) >> 3U)
+                                                                 : (WIDTH - 1U) - (static_cast<size_t>(__builtin_clzl(static_cast<unsigned long>(mask))) >> 3U);
+#else
+        return (WIDTH - 1U) - (static_cast<size_t>(tpn::count_leading_zeros(mask)) >> 3U);
+#endif
+      }
+
+    private:
+
+      //*******************************
+      static vector_type lsbs()
+      {
+        return static_cast<vector_type>(~vector_type(0U) / 0xFFU);
+      }
+
+      //*******************************
+      static vector_type msbs()
+      {
+        return static_cast<vector_type>(lsbs() << 7U);
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// Characters of a block that are in a set of up to MAX_BLOCK_SET.
+    //*************************************************************************
+    class block_set
+    {
+    public:
+
+      typedef block::vector_type vector_type;
+      typedef block::mask_type   mask_type;
+
+      //*******************************
+      block_set(const uint8_t* set, size_t m_, bool in)
+        : m(m_)
+        , flip(in ? mask_type(0U) : block::all())
+      {
+        for (size_t j = 0U; j < m; ++j)
+        {
+          splats[j] = block::splat(set[j]);
+        }
+      }
+
+      //*******************************
+      /// The characters that are in the set, or not in the set.
+      //*******************************
+      mask_type match(const uint8_t* p) const
+      {
+        const vector_type v = block::load(p);
+
+        vector_type matches = block::equal(v, splats[0]);
+
+        for (size_t j = 1U; j < m; ++j)
+        {
+          matches = block::either(matches, block::equal(v, splats[j]));
+        }
+
+        return block::mask(matches) ^ flip;
+      }
+
+    private:
+
+      vector_type splats[MAX_BLOCK_SET];
+      size_t      m;
+      mask_type   flip;
+    };
+
+    //*************************************************************************
+    /// A set of bytes as a bit table, for sets too large to compare.
+    //*************************************************************************
+    class byte_table
+    {
+    public:
+
+      //*******************************
+      byte_table(const uint8_t* set, size_t m)
+      {
+        memset(bits, 0, sizeof(bits));
+
+        for (size_t j = 0U; j < m; ++j)
+        {
+          bits[set[j] >> 5U] |= uint32_t(1U) << (set[j] & 0x1FU);
+        }
+      }
+
+      //*******************************
+      bool contains(uint8_t c) const
+      {
+        return (bits[c >> 5U] & (uint32_t(1U) << (c & 0x1FU))) != 0U;
+      }
+
+    private:
+
+      uint32_t bits[8];
+    };
+
+    //*************************************************************************
+    /// The first byte of 's' that is, or is not, in the set. 0 < m.
+    //*************************************************************************
+    inline size_t block_find_of(const uint8_t* s, size_t n, const uint8_t* set, size_t m, bool in)
+    {
+      if (m > MAX_BLOCK_SET)
+      {
+        const byte_table table(set, m);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          if (table.contains(s[i]) == in)
+          {
+            return i;
+          }
+        }
+
+        return npos;
+      }
+
+      if (n < block::WIDTH)
+      {
+        return scalar_find_of(s, n, set, m, in);
+      }
+
+      const block_set matcher(set, m, in);
+
+      size_t i = 0U;
+
+      while ((i + block::WIDTH) <= n)
+      {
+        const block::mask_type mask = matcher.match(s + i);
+
+        if (mask != 0U)
+        {
+          return i + block::lowest(mask);
+        }
+
+        i += block::WIDTH;
+      }
+
+      // The last block overlaps the one before, so ignore the characters already seen.
+      if (i < n)
+      {
+        const size_t start = n - block::WIDTH;
+        const block::mask_type mask = matcher.match(s + start) & (block::all() << ((i - start) * block::BITS_PER_CHAR));
+
+        if (mask != 0U)
+        {
+          return start + block::lowest(mask);
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// The last byte of 's' that is, or is not, in the set. 0 < m.
+    //*************************************************************************
+    inline size_t block_rfind_of(const uint8_t* s, size_t n, const uint8_t* set, size_t m, bool in)
+    {
+      if (m > MAX_BLOCK_SET)
+      {
+        const byte_table table(set, m);
+
+        while (n != 0U)
+        {
+          --n;
+
+          if (table.contains(s[n]) == in)
+          {
+            return n;
+          }
+        }
+
+        return npos;
+      }
+
+      if (n < block::WIDTH)
+      {
+        return scalar_rfind_of(s, n, set, m, in);
+      }
+
+      const block_set matcher(set, m, in);
+
+      size_t i = n;
+
+      while (i >= block::WIDTH)
+      {
+        i -= block::WIDTH;
+
+        const block::mask_type mask = matcher.match(s + i);
+
+        if (mask != 0U)
+        {
+          return i + block::highest(mask);
+        }
+      }
+
+      // The first block overlaps the one after, so ignore the characters already seen.
+      if (i != 0U)
+      {
+        const block::mask_type mask = matcher.match(s) & (block::all() >> ((block::WIDTH - i) * block::BITS_PER_CHAR));
+
+        if (mask != 0U)
+        {
+          return block::highest(mask);
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Candidate positions of 'p' in a block, where both its first and last
+    /// characters match. Only the candidates have the rest compared.
+    //*************************************************************************
+    inline block::mask_type block_candidates(const uint8_t* s, size_t m, block::vector_type first, block::vector_type last)
+    {
+      return block::mask(block::both(block::equal(block::load(s), first),
+                                     block::equal(block::load(s + m - 1U), last)));
+    }
+
+    //*************************************************************************
+    /// The first position of 'p' in 's'. 1 < m <= n.
+    //*************************************************************************
+    inline size_t block_search(const uint8_t* s, size_t n, const uint8_t* p, size_t m)
+    {
+      const size_t positions = n - m + 1U;
+
+      if (positions < block::WIDTH)
+      {
+        return scalar_search(s, n, p, m);
+      }
+
+      const block::vector_type first = block::splat(p[0]);
+      const block::vector_type last  = block::splat(p[m - 1U]);
+
+      size_t i = 0U;
+
+      while (i < positions)
+      {
+        block::mask_type keep = block::all();
+
+        // The last block overlaps the one before.
+        if ((i + block::WIDTH) > positions)
+        {
+          const size_t start = positions - block::WIDTH;
+          keep = block::all() << ((i - start) * block::BITS_PER_CHAR);
+          i = start;
+        }
+
+        block::mask_type mask = block_candidates(s + i, m, first, last) & keep;
+
+        while (mask != 0U)
+        {
+          const size_t k = block::lowest(mask);
+
+          if (memcmp(s + i + k + 1U, p + 1U, m - 2U) == 0)
+          {
+            return i + k;
+          }
+
+          mask &= ~(block::lane() << (k * block::BITS_PER_CHAR));
+        }
+
+        i += block::WIDTH;
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// The last position of 'p' in 's'. 1 < m <= n.
+    //*************************************************************************
+    inline size_t block_rsearch(const uint8_t* s, size_t n, const uint8_t* p, size_t m)
+    {
+      const size_t positions = n - m + 1U;
+
+      if (positions < block::WIDTH)
+      {
+        return scalar_rsearch(s, n, p, m);
+      }
+
+      const block::vector_type first = block::splat(p[0]);
+      const block::vector_type last  = block::splat(p[m - 1U]);
+
+      size_t i = positions;
+
+      while (i != 0U)
+      {
+        size_t start = 0U;
+        block::mask_type keep = block::all();
+
+        // The first block overlaps the one after.
+        if (i >= block::WIDTH)
+        {
+          start = i - block::WIDTH;
+        }
+        else
+        {
+          keep = block::all() >> ((block::WIDTH - i) * block::BITS_PER_CHAR);
+        }
+
+        block::mask_type mask = block_candidates(s + start, m, first, last) & keep;
+
+        while (mask != 0U)
+        {
+          const size_t k = block::highest(mask);
+
+          if (memcmp(s + start + k + 1U, p + 1U, m - 2U) == 0)
+          {
+            return start + k;
+          }
+
+          mask &= ~(block::lane() << (k * block::BITS_PER_CHAR));
+        }
+
+        i = start;
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    const uint8_t* as_bytes(const T* p)
+    {
+      return reinterpret_cast<const uint8_t*>(p);
+    }
+
+    //*************************************************************************
+    /// The first character of 's' that is, or is not, 'c'.
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t find(const T* s, size_t n, T c, bool equal = true)
+    {
+      if (is_byte_character<T>::value && !TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED())
+      {
+        const uint8_t byte = static_cast<uint8_t>(c);
+
+        if (n == 0U)
+        {
+          return npos;
+        }
+
+        if (equal && (n < block::WIDTH))
+        {
+          const void* p = memchr(s, byte, n);
+
+          return (p == TYPHOON_NULLPTR) ? npos : static_cast<size_t>(static_cast<const uint8_t*>(p) - as_bytes(s));
+        }
+
+        return block_find_of(as_bytes(s), n, &byte, 1U, equal);
+      }
+
+      return scalar_find(s, n, c, equal);
+    }
+
+    //*************************************************************************
+    /// The last character of 's' that is, or is not, 'c'.
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t rfind(const T* s, size_t n, T c, bool equal = true)
+    {
+      if (is_byte_character<T>::value && !TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED())
+      {
+        const uint8_t byte = static_cast<uint8_t>(c);
+
+        return block_rfind_of(as_bytes(s), n, &byte, 1U, equal);
+      }
+
+      return scalar_rfind(s, n, c, equal);
+    }
+
+    //*************************************************************************
+    /// The first character of 's' that is, or is not, one of 'set'.
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t find_of(const T* s, size_t n, const T* set, size_t m, bool in = true)
+    {
+      if (m == 0U)
+      {
+        return (in || (n == 0U)) ? npos : 0U;
+      }
+
+      if (is_byte_character<T>::value && !TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED())
+      {
+        return block_find_of(as_bytes(s), n, as_bytes(set), m, in);
+      }
+
+      return scalar_find_of(s, n, set, m, in);
+    }
+
+    //*************************************************************************
+    /// The last character of 's' that is, or is not, one of 'set'.
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t rfind_of(const T* s, size_t n, const T* set, size_t m, bool in = true)
+    {
+      if (m == 0U)
+      {
+        return (in || (n == 0U)) ? npos : n - 1U;
+      }
+
+      if (is_byte_character<T>::value && !TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED())
+      {
+        return block_rfind_of(as_bytes(s), n, as_bytes(set), m, in);
+      }
+
+      return scalar_rfind_of(s, n, set, m, in);
+    }
+
+    //*************************************************************************
+    /// The first position of 'p' in 's'.
+    /// An empty 'p' is found at the start of a non-empty 's', and not in an
+    /// empty one, as the iterator based search used by find found it.
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t search(const T* s, size_t n, const T* p, size_t m)
+    {
+      if (m > n)
+      {
+        return npos;
+      }
+
+      if (m == 0U)
+      {
+        return (n == 0U) ? npos : 0U;
+      }
+
+      if (m == 1U)
+      {
+        return find(s, n, p[0]);
+      }
+
+      if (is_byte_character<T>::value && !TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED())
+      {
+        return block_search(as_bytes(s), n, as_bytes(p), m);
+      }
+
+      return scalar_search(s, n, p, m);
+    }
+
+    //*************************************************************************
+    /// The last position of 'p' in 's'.
+    /// An empty 'p' is found at the end of a non-empty 's', and not in an
+    /// empty one, as the reverse iterator search used by rfind found it.
+    //*************************************************************************
+    template <typename T>
+    TYPHOON_CONSTEXPR14 size_t rsearch(const T* s, size_t n, const T* p, size_t m)
+    {
+      if (m > n)
+      {
+        return npos;
+      }
+
+      if (m == 0U)
+      {
+        return (n == 0U) ? npos : n;
+      }
+
+      if (m == 1U)
+      {
+        return rfind(s, n, p[0]);
+      }
+
+      if (is_byte_character<T>::value && !TYPHOON_STRING_SEARCH_IS_CONSTANT_EVALUATED())
+      {
+        return block_rsearch(as_bytes(s), n, as_bytes(p), m);
+      }
+
+      return scalar_rsearch(s, n, p, m);
+    }
+  }
+}
+
+#endif
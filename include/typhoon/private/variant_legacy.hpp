@@ -452,12 +452,12 @@ namespace tpn
       /// Default constructor.
       /// Sets the state of the instance to containing no valid data.
       //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
       variant()
         : type_id(UNSUPPORTED_TYPE_ID)
       {
       }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
       //***************************************************************************
       /// Constructor that catches any types that are not supported.
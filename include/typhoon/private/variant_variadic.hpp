@@ -524,7 +524,7 @@ namespace tpn
     /// Default constructor.
     /// Sets the state of the instance to containing no valid data.
     //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     TYPHOON_CONSTEXPR14 variant()
     {
       using type = typename tpn::private_variant::parameter_pack<TTypes...>::template type_from_index<0U>::type;
@@ -533,12 +533,12 @@ namespace tpn
       operation = operation_type<type, tpn::is_copy_constructible<type>::value, tpn::is_move_constructible<type>::value>::do_operation;
       type_id   = 0U;
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //***************************************************************************
     /// Constructor from a value.
     //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename T, tpn::enable_if_t<!tpn::is_same<tpn::remove_cvref_t<T>, variant>::value, int> = 0>
     TYPHOON_CONSTEXPR14 variant(T&& value)
       : operation(operation_type<tpn::remove_cvref_t<T>, tpn::is_copy_constructible<tpn::remove_cvref_t<T>>::value, tpn::is_move_constructible<tpn::remove_cvref_t<T>>::value>::do_operation)
@@ -548,12 +548,12 @@ namespace tpn
 
       construct_in_place<tpn::remove_cvref_t<T>>(data, tpn::forward<T>(value));
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //***************************************************************************
     /// Construct from arguments.
     //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename T, typename... TArgs>
     TYPHOON_CONSTEXPR14 explicit variant(tpn::in_place_type_t<T>, TArgs&&... args)
       : operation(operation_type<tpn::remove_cvref_t<T>, tpn::is_copy_constructible<tpn::remove_cvref_t<T>>::value, tpn::is_move_constructible<tpn::remove_cvref_t<T>>::value>::do_operation)
@@ -563,12 +563,12 @@ namespace tpn
 
       construct_in_place_args<tpn::remove_cvref_t<T>>(data, tpn::forward<TArgs>(args)...);
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //***************************************************************************
     /// Construct from arguments.
     //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <size_t Index, typename... TArgs>
     TYPHOON_CONSTEXPR14 explicit variant(tpn::in_place_index_t<Index>, TArgs&&... args)
       : type_id(Index)
@@ -580,13 +580,13 @@ namespace tpn
 
       operation = operation_type<type, tpn::is_copy_constructible<type>::value, tpn::is_move_constructible<type>::value>::do_operation;
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
 #if TYPHOON_HAS_INITIALIZER_LIST
     //***************************************************************************
     /// Construct from type, initializer_list and arguments.
     //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <typename T, typename U, typename... TArgs >
     TYPHOON_CONSTEXPR14 explicit variant(tpn::in_place_type_t<T>, std::initializer_list<U> init, TArgs&&... args)
       : operation(operation_type<tpn::remove_cvref_t<T>, tpn::is_copy_constructible<tpn::remove_cvref_t<T>>::value, tpn::is_move_constructible<tpn::remove_cvref_t<T>>::value>::do_operation)
@@ -596,12 +596,12 @@ namespace tpn
 
       construct_in_place_args<tpn::remove_cvref_t<T>>(data, init, tpn::forward<TArgs>(args)...);
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //***************************************************************************
     /// Construct from index, initializer_list and arguments.
     //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     template <size_t Index, typename U, typename... TArgs >
     TYPHOON_CONSTEXPR14 explicit variant(tpn::in_place_index_t<Index>, std::initializer_list<U> init, TArgs&&... args)
       : type_id(Index)
@@ -613,14 +613,14 @@ namespace tpn
 
       operation = operation_type<type, tpn::is_copy_constructible<type>::value, tpn::is_move_constructible<type>::value>::do_operation;
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 #endif
 
     //***************************************************************************
     /// Copy constructor.
     ///\param other The other variant object to copy.
     //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     TYPHOON_CONSTEXPR14 variant(const variant& other)
       : operation(other.operation)
       , type_id(other.type_id)
@@ -637,13 +637,13 @@ namespace tpn
         }
       }
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //***************************************************************************
     /// Move constructor.
     ///\param other The other variant object to copy.
     //***************************************************************************
-#include "tpn/private/diagnostic_uninitialized_push.hpp"
+#include "typhoon/private/diagnostic_uninitialized_push.hpp"
     TYPHOON_CONSTEXPR14 variant(variant&& other)
       : operation(other.operation)
       , type_id(other.type_id)
@@ -664,7 +664,7 @@ namespace tpn
         type_id = variant_npos;
       }
     }
-#include "tpn/private/diagnostic_pop.hpp"
+#include "typhoon/private/diagnostic_pop.hpp"
 
     //***************************************************************************
     /// Destructor.
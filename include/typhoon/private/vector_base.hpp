@@ -167,7 +167,7 @@ namespace tpn
     }
 #endif
 
-    const size_type CAPACITY; ///<The maximum number of elements in the vector.
+    size_type CAPACITY;       ///<The maximum number of elements in the vector.
     TYPHOON_DECLARE_DEBUG_COUNT   ///< Internal debugging.
   };
 }
@@ -0,0 +1,738 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2018 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_MPMC_QUEUE_ATOMIC_HPP
+#define TYPHOON_MPMC_QUEUE_ATOMIC_HPP
+
+#include "platform.hpp"
+#include "alignment.hpp"
+#include "parameter_type.hpp"
+#include "atomic.hpp"
+#include "memory_model.hpp"
+#include "integral_limits.hpp"
+#include "utility.hpp"
+#include "placement_new.hpp"
+#include "nullptr.hpp"
+#include "power.hpp"
+#include "static_assert.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if TYPHOON_HAS_ATOMIC
+
+//*****************************************************************************
+/// The read and write positions are padded apart to this size so that
+/// producers and consumers do not contend for the same cache line.
+//*****************************************************************************
+#if !defined(TYPHOON_QUEUE_MPMC_ATOMIC_CACHE_LINE_SIZE)
+  #define TYPHOON_QUEUE_MPMC_ATOMIC_CACHE_LINE_SIZE 64
+#endif
+
+namespace tpn
+{
+  template <const size_t MEMORY_MODEL = tpn::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename tpn::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    /// The type of the read and write positions and the per-slot sequence numbers.
+    /// This is independent of the memory model, as a narrow position could
+    /// wrap while a thread is pre-empted between reading and claiming it.
+    typedef uint32_t sequence_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      const sequence_type read_position  = read.position.load(tpn::memory_order_acquire);
+      const sequence_type write_position = write.position.load(tpn::memory_order_acquire);
+
+      const sequence_type n = write_position - read_position;
+
+      // The read position may have been overtaken between the two loads.
+      if (n > MAX_SIZE)
+      {
+        return (n > (sequence_type(~sequence_type(0)) / 2U)) ? 0 : MAX_SIZE;
+      }
+
+      return size_type(n);
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : MAX_SIZE(max_size_),
+        MASK(sequence_type(max_size_) - 1U)
+    {
+      write.position.store(0U, tpn::memory_order_relaxed);
+      read.position.store(0U, tpn::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The signed distance from 'position' to 'sequence'.
+    //*************************************************************************
+    static int32_t distance(sequence_type sequence, sequence_type position)
+    {
+      return static_cast<int32_t>(sequence - position);
+    }
+
+    //*************************************************************************
+    /// A position on its own cache line.
+    //*************************************************************************
+    struct padded_position
+    {
+      tpn::atomic<sequence_type> position;
+      char padding[(TYPHOON_QUEUE_MPMC_ATOMIC_CACHE_LINE_SIZE > sizeof(tpn::atomic<sequence_type>)) ?
+                   (TYPHOON_QUEUE_MPMC_ATOMIC_CACHE_LINE_SIZE - sizeof(tpn::atomic<sequence_type>)) : 1U];
+    };
+
+    padded_position write;       ///< The next position to be claimed by a producer.
+    padded_position read;        ///< The next position to be claimed by a consumer.
+    const size_type MAX_SIZE;    ///< The maximum number of items in the queue.
+    const sequence_type MASK;    ///< Maps a position to a slot.
+
+  private:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(TYPHOON_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(TYPHOON_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief This is the base for all queue_mpmc_atomic's that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// tpn::queue_mpmc_atomic<int, 16> myQueue;
+  /// tpn::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by any number of producers and consumers
+  /// without locks. Each slot carries a sequence number that tells a producer or
+  /// consumer whether the slot is ready for the position it has read; a position
+  /// is claimed with a single compare-and-swap.
+  /// push and pop return false only if the queue was full or empty at some
+  /// point during the call.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = tpn::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef tpn::queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                              value_type;      ///< The type stored in the queue.
+    typedef T&                             reference;       ///< A reference to the type used in the queue.
+    typedef const T&                       const_reference; ///< A const reference to the type used in the queue.
+#if TYPHOON_USING_CPP11
+    typedef T&&                            rvalue_reference;///< An rvalue reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type     size_type;       ///< The type used for determining the size of the queue.
+    typedef typename base_t::sequence_type sequence_type;   ///< The type of the positions and sequence numbers.
+
+    using base_t::write;
+    using base_t::read;
+    using base_t::MAX_SIZE;
+    using base_t::MASK;
+    using base_t::distance;
+
+    //*************************************************************************
+    /// A slot in the queue.
+    /// 'sequence' equals the slot's position when it is free to be written,
+    /// and the position + 1 when it holds a value ready to be read.
+    //*************************************************************************
+    struct cell
+    {
+      tpn::atomic<sequence_type> sequence;
+      typename tpn::aligned_storage<sizeof(T), tpn::alignment_of<T>::value>::type value;
+    };
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      sequence_type position;
+      cell* p_cell = claim_write(position);
+
+      if (p_cell != TYPHOON_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value);
+        p_cell->sequence.store(position + 1U, tpn::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      sequence_type position;
+      cell* p_cell = claim_write(position);
+
+      if (p_cell != TYPHOON_NULLPTR)
+      {
+        ::new (&p_cell->value) T(tpn::move(value));
+        p_cell->sequence.store(position + 1U, tpn::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+#if TYPHOON_USING_CPP11 && TYPHOON_NOT_USING_STLPORT && !defined(TYPHOON_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      sequence_type position;
+      cell* p_cell = claim_write(position);
+
+      if (p_cell != TYPHOON_NULLPTR)
+      {
+        ::new (&p_cell->value) T(tpn::forward<Args>(args)...);
+        p_cell->sequence.store(position + 1U, tpn::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      sequence_type position;
+      cell* p_cell = claim_write(position);
+
+      if (p_cell != TYPHOON_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1);
+        p_cell->sequence.store(position + 1U, tpn::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      sequence_type position;
+      cell* p_cell = claim_write(position);
+
+      if (p_cell != TYPHOON_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1, value2);
+        p_cell->sequence.store(position + 1U, tpn::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      sequence_type position;
+      cell* p_cell = claim_write(position);
+
+      if (p_cell != TYPHOON_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3);
+        p_cell->sequence.store(position + 1U, tpn::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      sequence_type position;
+      cell* p_cell = claim_write(position);
+
+      if (p_cell != TYPHOON_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3, value4);
+        p_cell->sequence.store(position + 1U, tpn::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pushes up to 'n' values from the range starting at 'first'.
+    /// The slots are claimed with a single compare-and-swap, so the values
+    /// are contiguous in the queue even with other producers running.
+    /// Returns the number of values pushed, which may be less than 'n' if
+    /// the queue fills.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_n(TIterator first, size_type n)
+    {
+      sequence_type position;
+      size_type count = claim_range(write, position, n, 0U);
+
+      for (size_type i = 0; i < count; ++i)
+      {
+        cell& c = p_cells[(position + i) & MASK];
+
+        ::new (&c.value) T(*first);
+        ++first;
+
+        c.sequence.store(position + i + 1U, tpn::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      sequence_type position;
+      cell* p_cell = claim_read(position);
+
+      if (p_cell != TYPHOON_NULLPTR)
+      {
+        T* p_value = reinterpret_cast<T*>(&p_cell->value);
+
+#if TYPHOON_USING_CPP11 && TYPHOON_NOT_USING_STLPORT && !defined(TYPHOON_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        value = tpn::move(*p_value);
+#else
+        value = *p_value;
+#endif
+        p_value->~T();
+        p_cell->sequence.store(position + MAX_SIZE, tpn::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      sequence_type position;
+      cell* p_cell = claim_read(position);
+
+      if (p_cell != TYPHOON_NULLPTR)
+      {
+        reinterpret_cast<T*>(&p_cell->value)->~T();
+        p_cell->sequence.store(position + MAX_SIZE, tpn::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pops up to 'n' values to the range starting at 'result'.
+    /// The slots are claimed with a single compare-and-swap, so the values
+    /// are consecutive in queue order even with other consumers running.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_n(TOutputIterator result, size_type n)
+    {
+      sequence_type position;
+      size_type count = claim_range(read, position, n, 1U);
+
+      for (size_type i = 0; i < count; ++i)
+      {
+        cell& c = p_cells[(position + i) & MASK];
+        T* p_value = reinterpret_cast<T*>(&c.value);
+
+#if TYPHOON_USING_CPP11 && TYPHOON_NOT_USING_STLPORT && !defined(TYPHOON_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        *result = tpn::move(*p_value);
+#else
+        *result = *p_value;
+#endif
+        ++result;
+
+        p_value->~T();
+        c.sequence.store(position + i + MAX_SIZE, tpn::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Peek a value at the front of the queue.
+    /// Only meaningful when there is a single consumer and the queue is not empty.
+    //*************************************************************************
+    reference front()
+    {
+      return *reinterpret_cast<T*>(&p_cells[read.position.load(tpn::memory_order_acquire) & MASK].value);
+    }
+
+    //*************************************************************************
+    /// Peek a value at the front of the queue.
+    /// Only meaningful when there is a single consumer and the queue is not empty.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return *reinterpret_cast<const T*>(&p_cells[read.position.load(tpn::memory_order_acquire) & MASK].value);
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Pops until the queue is seen to be empty.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(cell* p_cells_, size_type max_size_)
+      : base_t(max_size_),
+        p_cells(p_cells_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets each slot free for its first position.
+    /// Called from the derived class once the slots have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < MAX_SIZE; ++i)
+      {
+        p_cells[i].sequence.store(sequence_type(i), tpn::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims the slot at the write position.
+    /// Returns a null pointer if the queue is full.
+    //*************************************************************************
+    cell* claim_write(sequence_type& position)
+    {
+      position = write.position.load(tpn::memory_order_relaxed);
+
+      for (;;)
+      {
+        cell& c = p_cells[position & MASK];
+
+        const int32_t d = distance(c.sequence.load(tpn::memory_order_acquire), position);
+
+        if (d == 0)
+        {
+          // The slot is free. Try to claim the position.
+          // On failure 'position' is updated to the current write position.
+          if (write.position.compare_exchange_weak(position, position + 1U, tpn::memory_order_relaxed))
+          {
+            return &c;
+          }
+        }
+        else if (d < 0)
+        {
+          // The slot still holds the value from the previous lap.
+          return TYPHOON_NULLPTR;
+        }
+        else
+        {
+          // Another producer has claimed this position.
+          position = write.position.load(tpn::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Claims the slot at the read position.
+    /// Returns a null pointer if the queue is empty.
+    //*************************************************************************
+    cell* claim_read(sequence_type& position)
+    {
+      position = read.position.load(tpn::memory_order_relaxed);
+
+      for (;;)
+      {
+        cell& c = p_cells[position & MASK];
+
+        const int32_t d = distance(c.sequence.load(tpn::memory_order_acquire), position + 1U);
+
+        if (d == 0)
+        {
+          // The slot is ready. Try to claim the position.
+          // On failure 'position' is updated to the current read position.
+          if (read.position.compare_exchange_weak(position, position + 1U, tpn::memory_order_relaxed))
+          {
+            return &c;
+          }
+        }
+        else if (d < 0)
+        {
+          // The slot has not been written yet.
+          return TYPHOON_NULLPTR;
+        }
+        else
+        {
+          // Another consumer has claimed this position.
+          position = read.position.load(tpn::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Claims up to 'n' consecutive slots from 'from'.
+    /// A slot at 'position' is ready when its sequence is 'position + offset';
+    /// 0 for producers, 1 for consumers.
+    /// The ready slots cannot be taken by anyone else once the position has
+    /// been claimed, so checking them before the compare-and-swap is enough.
+    //*************************************************************************
+    size_type claim_range(typename base_t::padded_position& from, sequence_type& position, size_type n, sequence_type offset)
+    {
+      if (n > MAX_SIZE)
+      {
+        n = MAX_SIZE;
+      }
+
+      position = from.position.load(tpn::memory_order_relaxed);
+
+      while (n != 0)
+      {
+        size_type count = 0;
+        int32_t   d     = 0;
+
+        while (count < n)
+        {
+          d = distance(p_cells[(position + count) & MASK].sequence.load(tpn::memory_order_acquire), position + count + offset);
+
+          if (d != 0)
+          {
+            break;
+          }
+
+          ++count;
+        }
+
+        if (count != 0)
+        {
+          if (from.position.compare_exchange_weak(position, position + count, tpn::memory_order_relaxed))
+          {
+            return count;
+          }
+        }
+        else if (d < 0)
+        {
+          // Full or empty.
+          break;
+        }
+        else
+        {
+          position = from.position.load(tpn::memory_order_relaxed);
+        }
+      }
+
+      return 0;
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&);
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&);
+
+    cell* p_cells; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity lock-free mpmc queue.
+  /// This queue supports concurrent access by any number of producers and consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue. Must be a power of 2, and at least 2.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = tpn::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public tpn::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef tpn::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    TYPHOON_STATIC_ASSERT((SIZE <= tpn::integral_limits<size_type>::max), "Size too large for memory model");
+    TYPHOON_STATIC_ASSERT(tpn::is_power_of_2<SIZE>::value, "Size must be a power of 2, and at least 2");
+    TYPHOON_STATIC_ASSERT((SIZE <= 0x40000000UL), "Size too large for the sequence numbers");
+
+    static TYPHOON_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(&buffer[0], MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&) TYPHOON_DELETE;
+    queue_mpmc_atomic& operator = (const queue_mpmc_atomic&) TYPHOON_DELETE;
+
+#if TYPHOON_USING_CPP11
+    queue_mpmc_atomic(queue_mpmc_atomic&&) = delete;
+    queue_mpmc_atomic& operator = (queue_mpmc_atomic&&) = delete;
+#endif
+
+    /// The slots used in the queue_mpmc_atomic.
+    typename base_t::cell buffer[MAX_SIZE];
+  };
+}
+
+#endif
+#endif
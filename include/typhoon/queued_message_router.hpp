@@ -0,0 +1,248 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_QUEUED_MESSAGE_ROUTER_HPP
+#define TYPHOON_QUEUED_MESSAGE_ROUTER_HPP
+
+#include "platform.hpp"
+#include "message.hpp"
+#include "message_router.hpp"
+#include "shared_message.hpp"
+#include "error_handler.hpp"
+#include "exception.hpp"
+#include "file_error_numbers.hpp"
+#include "static_assert.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+
+#include <stddef.h>
+
+//*****************************************************************************
+/// A router that hands shared messages over to another thread.
+/// Subscribed to a message bus or broker in place of the router that will
+/// process the messages, it queues each shared message it receives. The
+/// message is not copied; the queue holds a reference, and the message goes
+/// back to its pool when the last subscriber has processed it. The thread
+/// that owns the destination router calls 'process' to pass the queued
+/// messages on.
+/// The queue must have a single consumer and provide 'push', 'front', 'pop'
+/// and 'empty', such as tpn::queue_spsc_atomic<tpn::shared_message, N>.
+//*****************************************************************************
+namespace tpn
+{
+  //***************************************************************************
+  /// Base exception class for queued message router
+  //***************************************************************************
+  class queued_message_router_exception : public tpn::exception
+  {
+  public:
+
+    queued_message_router_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : tpn::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The queue was full.
+  //***************************************************************************
+  class queued_message_router_full : public tpn::queued_message_router_exception
+  {
+  public:
+
+    queued_message_router_full(string_type file_name_, numeric_type line_number_)
+      : queued_message_router_exception(TYPHOON_ERROR_TEXT("queued message router:full", TYPHOON_QUEUED_MESSAGE_ROUTER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A message that was not shared cannot be queued without a copy.
+  //***************************************************************************
+  class queued_message_router_not_shared : public tpn::queued_message_router_exception
+  {
+  public:
+
+    queued_message_router_not_shared(string_type file_name_, numeric_type line_number_)
+      : queued_message_router_exception(TYPHOON_ERROR_TEXT("queued message router:not shared", TYPHOON_QUEUED_MESSAGE_ROUTER_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Queues shared messages for a router on another thread.
+  ///\tparam TQueue The queue of tpn::shared_message.
+  //***************************************************************************
+  template <typename TQueue>
+  class queued_message_router : public tpn::imessage_router
+  {
+  public:
+
+    TYPHOON_STATIC_ASSERT((tpn::is_same<tpn::shared_message, typename TQueue::value_type>::value), "TQueue must be a queue of tpn::shared_message");
+
+    typedef TQueue                       queue_type;
+    typedef typename TQueue::size_type   size_type;
+
+    //********************************************
+    /// Constructor.
+    /// Takes the id of the destination router.
+    //********************************************
+    explicit queued_message_router(tpn::imessage_router& destination_)
+      : imessage_router(destination_.get_message_router_id())
+      , destination(destination_)
+    {
+    }
+
+    //********************************************
+    using tpn::imessage_router::receive;
+
+    //********************************************
+    /// Only shared messages can be queued.
+    //********************************************
+    virtual void receive(const tpn::imessage&) TYPHOON_OVERRIDE
+    {
+      TYPHOON_ASSERT_FAIL(TYPHOON_ERROR(queued_message_router_not_shared));
+    }
+
+    //********************************************
+    /// A batch holds messages that are not shared, so none can be queued.
+    /// Emits one 'not shared' error for a non-empty batch and drops it.
+    /// Send shared messages to a queued router one at a time.
+    //********************************************
+    virtual void receive_batch(tpn::span<const tpn::imessage* const> messages) TYPHOON_OVERRIDE
+    {
+      if (!messages.empty())
+      {
+        TYPHOON_ASSERT_FAIL(TYPHOON_ERROR(queued_message_router_not_shared));
+      }
+    }
+
+    //********************************************
+    /// Queues a reference to the message.
+    //********************************************
+    virtual void receive(tpn::shared_message shared_msg) TYPHOON_OVERRIDE
+    {
+#if TYPHOON_USING_CPP11
+      const bool queued = queue.push(tpn::move(shared_msg));
+#else
+      const bool queued = queue.push(shared_msg);
+#endif
+
+      if (!queued)
+      {
+        TYPHOON_ASSERT_FAIL(TYPHOON_ERROR(queued_message_router_full));
+      }
+    }
+
+    //********************************************
+    /// Passes the queued messages to the destination router.
+    /// Called by the thread that owns the destination.
+    ///\return The number of messages passed on.
+    //********************************************
+    size_t process()
+    {
+      size_t count = 0U;
+
+      while (!queue.empty())
+      {
+#if TYPHOON_USING_CPP11
+        destination.receive(tpn::move(queue.front()));
+#else
+        destination.receive(queue.front());
+#endif
+        queue.pop();
+        ++count;
+      }
+
+      return count;
+    }
+
+    //********************************************
+    using tpn::imessage_router::accepts;
+
+    virtual bool accepts(tpn::message_id_t id) const TYPHOON_OVERRIDE
+    {
+      return destination.accepts(id);
+    }
+
+    //********************************************
+    TYPHOON_DEPRECATED virtual bool is_null_router() const TYPHOON_OVERRIDE
+    {
+      return false;
+    }
+
+    //********************************************
+    virtual bool is_producer() const TYPHOON_OVERRIDE
+    {
+      return destination.is_producer();
+    }
+
+    //********************************************
+    virtual bool is_consumer() const TYPHOON_OVERRIDE
+    {
+      return destination.is_consumer();
+    }
+
+    //********************************************
+    /// The number of messages waiting.
+    //********************************************
+    size_type size() const
+    {
+      return queue.size();
+    }
+
+    //********************************************
+    /// True if no messages are waiting.
+    //********************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+    //********************************************
+    /// The destination router.
+    //********************************************
+    tpn::imessage_router& get_destination()
+    {
+      return destination;
+    }
+
+  private:
+
+    // Disabled.
+    queued_message_router(const queued_message_router&) TYPHOON_DELETE;
+    queued_message_router& operator =(const queued_message_router&) TYPHOON_DELETE;
+
+    tpn::imessage_router& destination; ///< The router that processes the messages.
+    queue_type            queue;       ///< The messages waiting to be processed.
+  };
+}
+
+#endif
@@ -89,6 +89,21 @@ namespace tpn
     {
     }
 
+#if TYPHOON_USING_CPP11
+    //***************************************************************************
+    /// Constructor
+    /// Constructs the message in place from the arguments.
+    /// \param owner The message owner.
+    /// \param args  The message constructor arguments.
+    //***************************************************************************
+    template <typename... TArgs>
+    reference_counted_message(tpn::in_place_t, tpn::ireference_counted_message_pool& owner_, TArgs&&... args)
+      : rc_object(tpn::in_place_t(), tpn::forward<TArgs>(args)...)
+      , owner(owner_)
+    {
+    }
+#endif
+
     //***************************************************************************
     /// Get a reference to the message.
     /// \return A reference to the message.
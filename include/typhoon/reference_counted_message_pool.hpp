@@ -43,6 +43,10 @@ SOFTWARE.
 #include "memory.hpp"
 #include "largest.hpp"
 
+#if defined(TYPHOON_POOL_TELEMETRY)
+  #include "pool_telemetry.hpp"
+#endif
+
 namespace tpn
 {
   //***************************************************************************
@@ -97,6 +101,9 @@ namespace tpn
     //*************************************************************************
     reference_counted_message_pool(tpn::imemory_block_allocator& memory_block_allocator_)
       : memory_block_allocator(memory_block_allocator_)
+#if defined(TYPHOON_POOL_TELEMETRY)
+      , p_telemetry(TYPHOON_NULLPTR)
+#endif
     {
     }
 
@@ -109,21 +116,14 @@ namespace tpn
       TYPHOON_STATIC_ASSERT((tpn::is_base_of<tpn::imessage, TMessage>::value), "Not a message type");
 
       typedef tpn::reference_counted_message<TMessage, TCounter> rcm_t;
-      typedef rcm_t* prcm_t;
 
-      prcm_t p = TYPHOON_NULLPTR;
-
-      lock();
-      p = static_cast<prcm_t>(memory_block_allocator.allocate(sizeof(rcm_t), tpn::alignment_of<rcm_t>::value));
-      unlock();
+      rcm_t* p = allocate_block<rcm_t>();
 
       if (p != TYPHOON_NULLPTR)
       {
         ::new(p) rcm_t(message, *this);
       }
 
-      TYPHOON_ASSERT((p != TYPHOON_NULLPTR), TYPHOON_ERROR(tpn::reference_counted_message_pool_allocation_failure));
-
       return p;
     }
 
@@ -136,23 +136,39 @@ namespace tpn
       TYPHOON_STATIC_ASSERT((tpn::is_base_of<tpn::imessage, TMessage>::value), "Not a message type");
 
       typedef tpn::reference_counted_message<TMessage, TCounter> rcm_t;
-      typedef rcm_t* prcm_t;
 
-      prcm_t p = TYPHOON_NULLPTR;
-
-      lock();
-      p = static_cast<prcm_t>(memory_block_allocator.allocate(sizeof(rcm_t), tpn::alignment_of<rcm_t>::value));
-      unlock();
+      rcm_t* p = allocate_block<rcm_t>();
 
       if (p != TYPHOON_NULLPTR)
       {
         ::new(p) rcm_t(*this);
       }
 
-      TYPHOON_ASSERT((p != TYPHOON_NULLPTR), TYPHOON_ERROR(tpn::reference_counted_message_pool_allocation_failure));
+      return p;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Allocate a reference counted message from the pool, constructing the
+    /// message in place from the arguments, without a temporary to copy from.
+    //*************************************************************************
+    template <typename TMessage, typename... TArgs>
+    tpn::reference_counted_message<TMessage, TCounter>* emplace(TArgs&&... args)
+    {
+      TYPHOON_STATIC_ASSERT((tpn::is_base_of<tpn::imessage, TMessage>::value), "Not a message type");
+
+      typedef tpn::reference_counted_message<TMessage, TCounter> rcm_t;
+
+      rcm_t* p = allocate_block<rcm_t>();
+
+      if (p != TYPHOON_NULLPTR)
+      {
+        ::new(p) rcm_t(tpn::in_place_t(), *this, tpn::forward<TArgs>(args)...);
+      }
 
       return p;
     }
+#endif
 
     //*************************************************************************
     /// Destruct a message and send it back to the allocator.
@@ -161,17 +177,54 @@ namespace tpn
     {
       bool released = false;
 
+#if defined(TYPHOON_POOL_TELEMETRY)
+      const uint32_t start = private_pool_telemetry::start(p_telemetry);
+#endif
+
       lock();
       if (memory_block_allocator.is_owner_of(&rcmessage))
       {
         rcmessage.~ireference_counted_message();
         released = memory_block_allocator.release(&rcmessage);
+
+#if defined(TYPHOON_POOL_TELEMETRY)
+        if (released)
+        {
+          private_pool_telemetry::released(p_telemetry, start);
+        }
+#endif
       }
       unlock();
 
       TYPHOON_ASSERT(released, TYPHOON_ERROR(tpn::reference_counted_message_pool_release_failure));
     }
 
+#if defined(TYPHOON_POOL_TELEMETRY)
+    //*************************************************************************
+    /// Attaches telemetry that records the pool's allocations and releases.
+    //*************************************************************************
+    void set_telemetry(tpn::pool_telemetry& telemetry)
+    {
+      p_telemetry = &telemetry;
+    }
+
+    //*************************************************************************
+    /// Detaches the telemetry.
+    //*************************************************************************
+    void clear_telemetry()
+    {
+      p_telemetry = TYPHOON_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns the attached telemetry, or a null pointer.
+    //*************************************************************************
+    const tpn::pool_telemetry* get_telemetry() const
+    {
+      return p_telemetry;
+    }
+#endif
+
 #if TYPHOON_USING_CPP11
     //*****************************************************
     template <typename TMessage1, typename... TMessages>
@@ -251,9 +304,38 @@ namespace tpn
 
   private:
 
+    //*************************************************************************
+    /// Allocate the storage for a reference counted message.
+    //*************************************************************************
+    template <typename TRcm>
+    TRcm* allocate_block()
+    {
+      TRcm* p = TYPHOON_NULLPTR;
+
+#if defined(TYPHOON_POOL_TELEMETRY)
+      const uint32_t start = private_pool_telemetry::start(p_telemetry);
+#endif
+
+      lock();
+      p = static_cast<TRcm*>(memory_block_allocator.allocate(sizeof(TRcm), tpn::alignment_of<TRcm>::value));
+#if defined(TYPHOON_POOL_TELEMETRY)
+      private_pool_telemetry::allocated(p_telemetry, p, start);
+#endif
+      unlock();
+
+      TYPHOON_ASSERT((p != TYPHOON_NULLPTR), TYPHOON_ERROR(tpn::reference_counted_message_pool_allocation_failure));
+
+      return p;
+    }
+
     /// The raw memory block pool.
     imemory_block_allocator& memory_block_allocator;
 
+#if defined(TYPHOON_POOL_TELEMETRY)
+    /// Records the allocations and releases, if attached.
+    tpn::pool_telemetry* p_telemetry;
+#endif
+
     // Should not be copied.
     reference_counted_message_pool(const reference_counted_message_pool&) TYPHOON_DELETE;
     reference_counted_message_pool& operator =(const reference_counted_message_pool&) TYPHOON_DELETE;
@@ -32,6 +32,7 @@
 #include "platform.hpp"
 #include "atomic.hpp"
 #include "error_handler.hpp"
+#include "utility.hpp"
 
 #include <stdint.h>
 
@@ -64,6 +65,52 @@ namespace tpn
     }
   };
 
+  namespace private_reference_counter
+  {
+    //*************************************************************************
+    /// Plain counters are used by one thread at a time.
+    //*************************************************************************
+    template <typename TCounter>
+    void increment(TCounter& count)
+    {
+      ++count;
+    }
+
+    template <typename TCounter>
+    int32_t decrement(TCounter& count)
+    {
+      return int32_t(--count);
+    }
+
+#if TYPHOON_HAS_ATOMIC
+    //*************************************************************************
+    /// Atomic counters are shared between threads.
+    /// Taking a new reference needs no ordering, as the caller already holds
+    /// one. Dropping a reference must make the holder's accesses visible to
+    /// whoever releases the object. When the count is one, the caller holds
+    /// the only reference and no other thread can change it, so the last
+    /// release skips the read-modify-write.
+    //*************************************************************************
+    template <typename T>
+    void increment(tpn::atomic<T>& count)
+    {
+      count.fetch_add(1, tpn::memory_order_relaxed);
+    }
+
+    template <typename T>
+    int32_t decrement(tpn::atomic<T>& count)
+    {
+      if (count.load(tpn::memory_order_acquire) == 1)
+      {
+        count.store(0, tpn::memory_order_relaxed);
+        return int32_t(0);
+      }
+
+      return int32_t(count.fetch_sub(1, tpn::memory_order_acq_rel) - 1);
+    }
+#endif
+  }
+
   //***************************************************************************
   /// The base of all reference counters.
   //***************************************************************************
@@ -107,7 +154,7 @@ namespace tpn
     //***************************************************************************
     virtual void increment_reference_count() TYPHOON_OVERRIDE
     {
-      ++reference_count;
+      private_reference_counter::increment(reference_count);
     }
 
     //***************************************************************************
@@ -117,7 +164,7 @@ namespace tpn
     {
       TYPHOON_ASSERT(reference_count > 0, TYPHOON_ERROR(reference_count_overrun));
 
-      return int32_t(--reference_count);
+      return private_reference_counter::decrement(reference_count);
     }
 
     //***************************************************************************
@@ -222,6 +269,17 @@ namespace tpn
     {
     }
 
+#if TYPHOON_USING_CPP11
+    //***************************************************************************
+    /// Constructs the counted object in place from the arguments.
+    //***************************************************************************
+    template <typename... TArgs>
+    explicit reference_counted_object(tpn::in_place_t, TArgs&&... args)
+      : object(tpn::forward<TArgs>(args)...)
+    {
+    }
+#endif
+
     //***************************************************************************
     /// Get a reference to the counted object.
     //***************************************************************************
@@ -45,6 +45,7 @@ SOFTWARE.
 #include "iterator.hpp"
 
 #include "private/comparator_is_transparent.hpp"
+#include "private/flat_merge.hpp"
 
 #include <stddef.h>
 
@@ -462,19 +463,30 @@ namespace tpn
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_set.
+    /// The range is sorted and merged with the existing values in one pass.
     /// If asserts or exceptions are enabled, emits reference_flat_set_full if the reference_flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first);
-        ++first;
-      }
+      reference_policy policy(*this);
+      insert_batches(first, last, false, policy);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values that is already sorted by key, with no repeated keys.
+    /// The range is merged with the existing values without being sorted.
+    /// If asserts or exceptions are enabled, emits reference_flat_set_full if the reference_flat_set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(tpn::sorted_unique_t, TIterator first, TIterator last)
+    {
+      reference_policy policy(*this);
+      insert_batches(first, last, true, policy);
     }
 
     //*********************************************************************
@@ -898,8 +910,72 @@ namespace tpn
       return result;
     }
 
+    //*********************************************************************
+    /// Inserts a range in batches, each merged in one pass.
+    /// 'policy' supplies the value to store for each element of the range
+    /// and disposes of values that are not stored. When the lookup is too
+    /// full for a batch, it inserts elements one at a time.
+    //*********************************************************************
+    template <typename TIterator, typename TPolicy>
+    void insert_batches(TIterator first, TIterator last, bool sorted, TPolicy& policy)
+    {
+      while (first != last)
+      {
+        const size_t count = lookup.size();
+        size_t batch = private_flat::batch_size(lookup);
+
+        if (batch == 0U)
+        {
+          policy.insert(*first);
+          ++first;
+        }
+        else
+        {
+          while ((first != last) && (batch != 0U))
+          {
+            lookup.push_back(policy.create(*first));
+            ++first;
+            --batch;
+          }
+
+          private_flat::merge_batch(lookup, count, private_flat::compare_pointed_values<value_type, key_compare>(), sorted, true, policy);
+        }
+      }
+    }
+
   private:
 
+    //*********************************************************************
+    /// Range inserts store references to the range's own values.
+    //*********************************************************************
+    class reference_policy
+    {
+    public:
+
+      explicit reference_policy(ireference_flat_set& container_)
+        : container(container_)
+      {
+      }
+
+      value_type* create(value_type& value)
+      {
+        return tpn::addressof(value);
+      }
+
+      void insert(value_type& value)
+      {
+        container.insert(value);
+      }
+
+      void discard(value_type*)
+      {
+      }
+
+    private:
+
+      ireference_flat_set& container;
+    };
+
     // Disable copy construction.
     ireference_flat_set(const ireference_flat_set&);
     ireference_flat_set& operator =(const ireference_flat_set&);
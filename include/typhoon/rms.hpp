@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.hpp"
 #include "functional.hpp"
 #include "type_traits.hpp"
+#include "span.hpp"
+#include "private/statistics.hpp"
 
 #include <math.h>
 #include <stdint.h>
@@ -114,6 +116,28 @@ namespace tpn
       recalculate = true;
     }
 
+    //*********************************
+    /// Add a contiguous block of values.
+    /// Floating point values are summed a vector at a time.
+    //*********************************
+    void add(tpn::span<const TInput> values)
+    {
+      sum_of_squares += private_statistics::sum_of_squares<calc_t>(values.data(), values.size());
+      counter        += uint32_t(values.size());
+      recalculate     = true;
+    }
+
+    //*********************************
+    /// Add the values from another rms,
+    /// as if they had been added to this one.
+    //*********************************
+    void merge(const rms& other)
+    {
+      sum_of_squares += other.sum_of_squares;
+      counter        += other.counter;
+      recalculate     = true;
+    }
+
     //*********************************
     /// Add a range.
     //*********************************
@@ -276,6 +276,7 @@ namespace tpn
     void exit_scheduler()
     {
       scheduler_exit = true;
+      on_exit_scheduler();
     }
 
     //*******************************************
@@ -329,6 +330,15 @@ namespace tpn
     {
     }
 
+    //*******************************************
+    /// Called by exit_scheduler.
+    /// Schedulers that run tasks on other threads override this to wake them.
+    //*******************************************
+    virtual void on_exit_scheduler()
+    {
+      // Do nothing.
+    }
+
     bool scheduler_running;
     bool scheduler_exit;
     tpn::ifunction<void>* p_idle_callback;
@@ -0,0 +1,611 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2017 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_SCHEDULER_WORK_STEALING_HPP
+#define TYPHOON_SCHEDULER_WORK_STEALING_HPP
+
+#include "platform.hpp"
+#include "scheduler.hpp"
+#include "thread.hpp"
+#include "atomic.hpp"
+#include "queue_mpmc_atomic.hpp"
+#include "vector.hpp"
+#include "power.hpp"
+#include "static_assert.hpp"
+
+#include <stdint.h>
+
+namespace tpn
+{
+  //***************************************************************************
+  /// Statistics for one worker of a scheduler_work_stealing.
+  //***************************************************************************
+  struct scheduler_worker_statistics
+  {
+    uint32_t tasks_run;       ///< Calls to task_process_work.
+    uint32_t steals;          ///< Tasks taken from another worker's deque.
+    uint32_t failed_steals;   ///< Steals that lost a race for a task.
+    uint32_t idle_us;         ///< Time spent asleep waiting for work, modulo 2^32.
+    uint32_t queue_depth;     ///< Tasks in the worker's deque when sampled.
+    uint32_t max_queue_depth; ///< The deepest the worker's deque has been.
+  };
+
+  namespace private_scheduler
+  {
+    //*************************************************************************
+    /// A bounded Chase-Lev work-stealing deque of task indexes.
+    /// The owning worker pushes and pops at the bottom.
+    /// Other workers steal from the top.
+    /// SIZE must be a power of 2 and at least the number of tasks, as a task
+    /// is never in more than one deque.
+    //*************************************************************************
+    template <size_t SIZE>
+    class work_stealing_deque
+    {
+    public:
+
+      typedef uint16_t value_type;
+
+      static TYPHOON_CONSTANT value_type EMPTY = 0xFFFFU; ///< Nothing to take.
+      static TYPHOON_CONSTANT value_type ABORT = 0xFFFEU; ///< Lost a race with another thief or the owner.
+
+      TYPHOON_STATIC_ASSERT(tpn::is_power_of_2<SIZE>::value, "SIZE must be a power of 2");
+
+      //*******************************************
+      work_stealing_deque()
+      {
+        top.store(0, tpn::memory_order_relaxed);
+        bottom.store(0, tpn::memory_order_relaxed);
+
+        for (size_t i = 0UL; i < SIZE; ++i)
+        {
+          cells[i].store(EMPTY, tpn::memory_order_relaxed);
+        }
+      }
+
+      //*******************************************
+      /// Owner only.
+      //*******************************************
+      void push(value_type value)
+      {
+        const int32_t b = bottom.load(tpn::memory_order_relaxed);
+
+        cells[b & MASK].store(value, tpn::memory_order_relaxed);
+        bottom.store(b + 1, tpn::memory_order_release);
+      }
+
+      //*******************************************
+      /// Owner only.
+      /// Takes the most recently pushed task.
+      //*******************************************
+      value_type pop()
+      {
+        const int32_t b = bottom.load(tpn::memory_order_relaxed) - 1;
+
+        // The store to 'bottom' must be ordered before the load of 'top'.
+        bottom.store(b, tpn::memory_order_seq_cst);
+        int32_t t = top.load(tpn::memory_order_seq_cst);
+
+        if (t > b)
+        {
+          // Empty.
+          bottom.store(b + 1, tpn::memory_order_relaxed);
+          return EMPTY;
+        }
+
+        value_type value = cells[b & MASK].load(tpn::memory_order_relaxed);
+
+        if (t == b)
+        {
+          // The last one. Race any thieves for it.
+          if (!top.compare_exchange_strong(t, t + 1, tpn::memory_order_seq_cst))
+          {
+            value = EMPTY;
+          }
+
+          bottom.store(b + 1, tpn::memory_order_relaxed);
+        }
+
+        return value;
+      }
+
+      //*******************************************
+      /// Any thread.
+      /// Takes the least recently pushed task.
+      //*******************************************
+      value_type steal()
+      {
+        int32_t t = top.load(tpn::memory_order_seq_cst);
+        const int32_t b = bottom.load(tpn::memory_order_seq_cst);
+
+        if (t >= b)
+        {
+          return EMPTY;
+        }
+
+        const value_type value = cells[t & MASK].load(tpn::memory_order_relaxed);
+
+        if (!top.compare_exchange_strong(t, t + 1, tpn::memory_order_seq_cst))
+        {
+          return ABORT;
+        }
+
+        return value;
+      }
+
+      //*******************************************
+      /// Due to concurrency, this is a guess.
+      //*******************************************
+      size_t size() const
+      {
+        const int32_t b = bottom.load(tpn::memory_order_acquire);
+        const int32_t t = top.load(tpn::memory_order_acquire);
+
+        return (b > t) ? size_t(b - t) : 0UL;
+      }
+
+    private:
+
+      static TYPHOON_CONSTANT int32_t MASK = int32_t(SIZE - 1U);
+
+      tpn::atomic<int32_t>    top;
+      tpn::atomic<int32_t>    bottom;
+      tpn::atomic<value_type> cells[SIZE];
+    };
+  }
+
+  //***************************************************************************
+  /// Work stealing scheduler.
+  /// Runs the same tpn::task objects as tpn::scheduler, across several
+  /// worker threads. The thread that calls start() is worker 0.
+  ///
+  /// Each worker keeps the tasks it is running in its own deque and, when
+  /// that is empty, takes tasks that have been notified, then steals from
+  /// the other workers. A task that did some work is put back for another
+  /// turn; one that had none is parked. Parked tasks are run again when
+  /// notify() is called for them, or when an idle worker polls them every
+  /// IDLE_POLL_MS, so tasks that never call notify() still run unmodified.
+  /// Idle workers sleep on a semaphore rather than spinning.
+  ///
+  /// A task is only ever run by one worker at a time.
+  /// Priorities only set the order in which tasks are first run.
+  /// The idle and watchdog callbacks are called from worker 0 only.
+  /// Tasks must all be added before start() is called.
+  /// \tparam MAX_TASKS_    The maximum number of tasks.
+  /// \tparam N_WORKERS_    The number of workers, including the calling thread.
+  /// \tparam STACK_SIZE_   The stack size of each additional worker thread.
+  /// \tparam IDLE_POLL_MS_ How often an idle worker polls the parked tasks.
+  //***************************************************************************
+  template <size_t MAX_TASKS_, size_t N_WORKERS_, size_t STACK_SIZE_ = 4096U, uint32_t IDLE_POLL_MS_ = 10U>
+  class scheduler_work_stealing : public tpn::ischeduler
+  {
+  public:
+
+    enum
+    {
+      MAX_TASKS    = MAX_TASKS_,
+      N_WORKERS    = N_WORKERS_,
+      STACK_SIZE   = STACK_SIZE_,
+      IDLE_POLL_MS = IDLE_POLL_MS_
+    };
+
+    TYPHOON_STATIC_ASSERT(N_WORKERS_ != 0U, "There must be at least one worker");
+    TYPHOON_STATIC_ASSERT(MAX_TASKS_ < 0xFFFEU, "Too many tasks");
+
+    //*******************************************
+    scheduler_work_stealing()
+      : ischeduler(task_list),
+        stopping(false),
+        sleepers(0U)
+    {
+      for (size_t i = 0UL; i < MAX_TASKS; ++i)
+      {
+        states[i].store(PARKED, tpn::memory_order_relaxed);
+      }
+
+      for (size_t w = 0UL; w < N_WORKERS; ++w)
+      {
+        counters[w].tasks_run.store(0U, tpn::memory_order_relaxed);
+        counters[w].steals.store(0U, tpn::memory_order_relaxed);
+        counters[w].failed_steals.store(0U, tpn::memory_order_relaxed);
+        counters[w].idle_us.store(0U, tpn::memory_order_relaxed);
+        counters[w].max_queue_depth.store(0U, tpn::memory_order_relaxed);
+      }
+    }
+
+    //*******************************************
+    /// Start the scheduler.
+    /// Returns once exit_scheduler has been called and the other workers
+    /// have finished.
+    //*******************************************
+    void start() TYPHOON_OVERRIDE
+    {
+      TYPHOON_ASSERT(task_list.size() > 0, TYPHOON_ERROR(tpn::scheduler_no_tasks_exception));
+
+      scheduler_running = true;
+
+      // Every task gets a first turn, in priority order.
+      // A task that cannot be queued is left parked for the idle poll.
+      for (size_t i = 0UL; i < task_list.size(); ++i)
+      {
+        states[i].store(QUEUED, tpn::memory_order_relaxed);
+
+        if (!injected.push(index_type(i)))
+        {
+          states[i].store(PARKED, tpn::memory_order_relaxed);
+        }
+      }
+
+      for (size_t w = 1UL; w < N_WORKERS; ++w)
+      {
+        workers[w - 1U].start([this, w]() { run_worker(w); });
+      }
+
+      run_worker(0U);
+
+      for (size_t w = 1UL; w < N_WORKERS; ++w)
+      {
+        workers[w - 1U].join();
+      }
+    }
+
+    //*******************************************
+    /// Tells the scheduler that the task may have work.
+    /// A parked task is queued and a sleeping worker woken.
+    /// May be called from any thread, including from a task.
+    //*******************************************
+    void notify(tpn::task& task)
+    {
+      const size_t index = find_task(task);
+
+      if (index == task_list.size())
+      {
+        return;
+      }
+
+      uint8_t state = states[index].load(tpn::memory_order_acquire);
+
+      for (;;)
+      {
+        if (state == PARKED)
+        {
+          if (states[index].compare_exchange_weak(state, QUEUED, tpn::memory_order_acq_rel))
+          {
+            if (injected.push(index_type(index)))
+            {
+              wake_one();
+            }
+            else
+            {
+              // Not queued, so park it again for the idle poll to find.
+              states[index].store(PARKED, tpn::memory_order_release);
+            }
+
+            return;
+          }
+        }
+        else if (state == BUSY)
+        {
+          // The worker running it will queue it again when it finishes.
+          if (states[index].compare_exchange_weak(state, BUSY_NOTIFIED, tpn::memory_order_acq_rel))
+          {
+            return;
+          }
+        }
+        else
+        {
+          // Already queued or due to be.
+          return;
+        }
+      }
+    }
+
+    //*******************************************
+    /// Gets the statistics for a worker.
+    /// Due to concurrency, the values are a snapshot.
+    //*******************************************
+    scheduler_worker_statistics get_statistics(size_t worker) const
+    {
+      scheduler_worker_statistics statistics;
+
+      statistics.tasks_run       = counters[worker].tasks_run.load(tpn::memory_order_relaxed);
+      statistics.steals          = counters[worker].steals.load(tpn::memory_order_relaxed);
+      statistics.failed_steals   = counters[worker].failed_steals.load(tpn::memory_order_relaxed);
+      statistics.idle_us         = counters[worker].idle_us.load(tpn::memory_order_relaxed);
+      statistics.queue_depth     = uint32_t(deques[worker].size());
+      statistics.max_queue_depth = counters[worker].max_queue_depth.load(tpn::memory_order_relaxed);
+
+      return statistics;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Wakes every worker so that they see the exit request.
+    //*******************************************
+    void on_exit_scheduler() TYPHOON_OVERRIDE
+    {
+      stopping.store(true, tpn::memory_order_release);
+      wake.release(uint32_t(N_WORKERS));
+    }
+
+  private:
+
+    typedef uint16_t index_type;
+
+    static TYPHOON_CONSTANT size_t QUEUE_SIZE = tpn::power_of_2_round_up<(MAX_TASKS_ < 2U) ? 2U : MAX_TASKS_>::value;
+
+    typedef private_scheduler::work_stealing_deque<QUEUE_SIZE> deque_type;
+
+    //*******************************************
+    // Task states.
+    //*******************************************
+    enum
+    {
+      PARKED,       ///< Had no work when last run.
+      QUEUED,       ///< In a deque or the injection queue.
+      BUSY,         ///< Being run or polled by a worker.
+      BUSY_NOTIFIED ///< Notified while busy; to be queued again.
+    };
+
+    //*******************************************
+    struct worker_counters
+    {
+      tpn::atomic<uint32_t> tasks_run;
+      tpn::atomic<uint32_t> steals;
+      tpn::atomic<uint32_t> failed_steals;
+      tpn::atomic<uint32_t> idle_us;
+      tpn::atomic<uint32_t> max_queue_depth;
+    };
+
+    //*******************************************
+    /// The worker loop.
+    //*******************************************
+    void run_worker(size_t w)
+    {
+      while (!stopping.load(tpn::memory_order_acquire))
+      {
+        const index_type index = find_work(w);
+
+        if (index != deque_type::EMPTY)
+        {
+          run_task(w, index);
+        }
+        else
+        {
+          if ((w == 0U) && (p_idle_callback != TYPHOON_NULLPTR))
+          {
+            (*p_idle_callback)();
+          }
+
+          sleep(w);
+        }
+
+        if ((w == 0U) && (p_watchdog_callback != TYPHOON_NULLPTR))
+        {
+          (*p_watchdog_callback)();
+        }
+      }
+    }
+
+    //*******************************************
+    /// Own deque first, then notified tasks, then the other workers.
+    //*******************************************
+    index_type find_work(size_t w)
+    {
+      index_type index = deques[w].pop();
+
+      if (index != deque_type::EMPTY)
+      {
+        return index;
+      }
+
+      if (injected.pop(index))
+      {
+        return index;
+      }
+
+      for (size_t i = 1UL; i < N_WORKERS; ++i)
+      {
+        const size_t victim = (w + i) % N_WORKERS;
+
+        index = deques[victim].steal();
+
+        if (index == deque_type::ABORT)
+        {
+          counters[w].failed_steals.fetch_add(1U, tpn::memory_order_relaxed);
+        }
+        else if (index != deque_type::EMPTY)
+        {
+          counters[w].steals.fetch_add(1U, tpn::memory_order_relaxed);
+          return index;
+        }
+      }
+
+      return deque_type::EMPTY;
+    }
+
+    //*******************************************
+    /// Gives the task one turn.
+    //*******************************************
+    void run_task(size_t w, index_type index)
+    {
+      states[index].store(BUSY, tpn::memory_order_relaxed);
+
+      tpn::task& task = *task_list[index];
+
+      bool worked = false;
+
+      if (task.task_request_work() > 0)
+      {
+        task.task_process_work();
+        counters[w].tasks_run.fetch_add(1U, tpn::memory_order_relaxed);
+        worked = true;
+      }
+
+      finish_task(w, index, worked);
+    }
+
+    //*******************************************
+    /// Queues a task that may have more work, or parks it.
+    //*******************************************
+    void finish_task(size_t w, index_type index, bool requeue)
+    {
+      if (!requeue)
+      {
+        uint8_t expected = BUSY;
+
+        if (states[index].compare_exchange_strong(expected, PARKED, tpn::memory_order_acq_rel))
+        {
+          return;
+        }
+
+        // Notified while it was busy.
+      }
+
+      states[index].store(QUEUED, tpn::memory_order_release);
+      push_local(w, index);
+    }
+
+    //*******************************************
+    /// Pushes to the worker's own deque.
+    /// Wakes another worker if there is now something to steal.
+    //*******************************************
+    void push_local(size_t w, index_type index)
+    {
+      deques[w].push(index);
+
+      const uint32_t depth = uint32_t(deques[w].size());
+
+      if (depth > counters[w].max_queue_depth.load(tpn::memory_order_relaxed))
+      {
+        counters[w].max_queue_depth.store(depth, tpn::memory_order_relaxed);
+      }
+
+      if (depth > 1U)
+      {
+        wake_one();
+      }
+    }
+
+    //*******************************************
+    /// Polls the parked tasks, queueing any that now have work.
+    //*******************************************
+    void poll_parked(size_t w)
+    {
+      for (size_t i = 0UL; i < task_list.size(); ++i)
+      {
+        uint8_t expected = PARKED;
+
+        if (states[i].compare_exchange_strong(expected, BUSY, tpn::memory_order_acq_rel))
+        {
+          finish_task(w, index_type(i), task_list[i]->task_request_work() > 0);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Sleeps until woken or until it is time to poll the parked tasks.
+    //*******************************************
+    void sleep(size_t w)
+    {
+      sleepers.fetch_add(1U, tpn::memory_order_seq_cst);
+
+      // Work queued between find_work and announcing the sleep would
+      // otherwise wait for the next poll.
+      if (!injected.empty() || any_deque_has_work())
+      {
+        sleepers.fetch_sub(1U, tpn::memory_order_relaxed);
+        return;
+      }
+
+      const uint64_t start = tpn::uptime_us();
+      const bool     woken = wake.try_acquire_for_ms(IDLE_POLL_MS);
+
+      counters[w].idle_us.fetch_add(uint32_t(tpn::uptime_us() - start), tpn::memory_order_relaxed);
+      sleepers.fetch_sub(1U, tpn::memory_order_relaxed);
+
+      if (!woken && !stopping.load(tpn::memory_order_acquire))
+      {
+        poll_parked(w);
+      }
+    }
+
+    //*******************************************
+    void wake_one()
+    {
+      if (sleepers.load(tpn::memory_order_seq_cst) != 0U)
+      {
+        wake.release();
+      }
+    }
+
+    //*******************************************
+    bool any_deque_has_work() const
+    {
+      for (size_t w = 0UL; w < N_WORKERS; ++w)
+      {
+        if (deques[w].size() != 0U)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    size_t find_task(const tpn::task& task) const
+    {
+      size_t index = 0UL;
+
+      while ((index < task_list.size()) && (task_list[index] != &task))
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
+    typedef tpn::vector<tpn::task*, MAX_TASKS> task_list_t;
+    task_list_t task_list;
+
+    tpn::atomic<uint8_t>                           states[MAX_TASKS];
+    deque_type                                     deques[N_WORKERS];
+    tpn::queue_mpmc_atomic<index_type, QUEUE_SIZE> injected;
+    worker_counters                                counters[N_WORKERS];
+
+    tpn::counting_semaphore wake;
+    tpn::atomic<bool>       stopping;
+    tpn::atomic<uint32_t>   sleepers;
+
+    tpn::thread<STACK_SIZE_> workers[(N_WORKERS_ > 1U) ? (N_WORKERS_ - 1U) : 1U];
+  };
+}
+
+#endif
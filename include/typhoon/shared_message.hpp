@@ -76,13 +76,32 @@ namespace tpn
       p_rcmessage->get_reference_counter().set_reference_count(1U);
     }
 
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Creates a shared message, constructing the message in place in the
+    /// pool from the arguments.
+    /// The message is not valid if the pool could not allocate it.
+    //*************************************************************************
+    template <typename TMessage, typename TPool, typename... TArgs>
+    static shared_message create(TPool& owner, TArgs&&... args)
+    {
+      TYPHOON_STATIC_ASSERT((tpn::is_base_of<tpn::ireference_counted_message_pool, TPool>::value), "TPool not derived from tpn::ireference_counted_message_pool");
+      TYPHOON_STATIC_ASSERT((tpn::is_base_of<tpn::imessage, TMessage>::value), "TMessage not derived from tpn::imessage");
+
+      return shared_message(owner.template emplace<TMessage>(tpn::forward<TArgs>(args)...));
+    }
+#endif
+
     //*************************************************************************
     /// Copy constructor
     //*************************************************************************
     shared_message(const tpn::shared_message& other)
       : p_rcmessage(other.p_rcmessage)
     {
-      p_rcmessage->get_reference_counter().increment_reference_count();
+      if (p_rcmessage != TYPHOON_NULLPTR)
+      {
+        p_rcmessage->get_reference_counter().increment_reference_count();
+      }
     }
 
 #if TYPHOON_USING_CPP11
@@ -104,15 +123,16 @@ namespace tpn
       if (&other != this)
       {
         // Deal with the current message.
-        if (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U)
-        {
-          p_rcmessage->release();
-        }
+        release_message();
 
         // Copy over the new one.
         p_rcmessage = other.p_rcmessage;
-        p_rcmessage->get_reference_counter().increment_reference_count();
-       }
+
+        if (p_rcmessage != TYPHOON_NULLPTR)
+        {
+          p_rcmessage->get_reference_counter().increment_reference_count();
+        }
+      }
 
       return *this;
     }
@@ -126,10 +146,7 @@ namespace tpn
       if (&other != this)
       {
         // Deal with the current message.
-        if (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U)
-        {
-          p_rcmessage->release();
-        }
+        release_message();
 
         // Move over the new one.
         p_rcmessage = tpn::move(other.p_rcmessage);
@@ -146,11 +163,7 @@ namespace tpn
     //*************************************************************************
     ~shared_message()
     {
-      if ((p_rcmessage != TYPHOON_NULLPTR) &&
-          (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U))
-      {       
-        p_rcmessage->release();
-      }
+      release_message();
     }
 
     //*************************************************************************
@@ -189,6 +202,31 @@ namespace tpn
 
     shared_message() TYPHOON_DELETE;
 
+    //*************************************************************************
+    /// Takes the first reference to a newly allocated message, if any.
+    //*************************************************************************
+    explicit shared_message(tpn::ireference_counted_message* p_rcmessage_)
+      : p_rcmessage(p_rcmessage_)
+    {
+      if (p_rcmessage != TYPHOON_NULLPTR)
+      {
+        p_rcmessage->get_reference_counter().set_reference_count(1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Drops this reference, returning the message to its pool if it was the
+    /// last one.
+    //*************************************************************************
+    void release_message()
+    {
+      if ((p_rcmessage != TYPHOON_NULLPTR) &&
+          (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U))
+      {
+        p_rcmessage->release();
+      }
+    }
+
     tpn::ireference_counted_message* p_rcmessage; ///< A pointer to the reference  counted message.
   };
 }
@@ -0,0 +1,304 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2021 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_SLAB_MEMORY_BLOCK_ALLOCATOR_HPP
+#define TYPHOON_SLAB_MEMORY_BLOCK_ALLOCATOR_HPP
+
+#include "platform.hpp"
+#include "imemory_block_allocator.hpp"
+#include "generic_pool.hpp"
+#include "static_assert.hpp"
+#include "alignment.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if TYPHOON_USING_CPP11
+
+namespace tpn
+{
+  //*************************************************************************
+  /// A size class for slab_memory_block_allocator.
+  /// VSize blocks of VBlock_Size bytes.
+  //*************************************************************************
+  template <size_t VBlock_Size, size_t VSize>
+  struct slab_size_class
+  {
+    static TYPHOON_CONSTANT size_t Block_Size = VBlock_Size;
+    static TYPHOON_CONSTANT size_t Size       = VSize;
+  };
+
+  namespace private_slab
+  {
+    //*************************************************************************
+    /// The pools for the size classes, smallest first.
+    //*************************************************************************
+    template <size_t VAlignment, typename... TClasses>
+    struct pools;
+
+    template <size_t VAlignment>
+    struct pools<VAlignment>
+    {
+      static TYPHOON_CONSTANT size_t First_Block_Size = ~size_t(0);
+      static TYPHOON_CONSTANT size_t Max_Block_Size   = 0U;
+      static TYPHOON_CONSTANT bool   Is_Ascending     = true;
+
+      void get(tpn::ipool**)
+      {
+      }
+    };
+
+    template <size_t VAlignment, typename THead, typename... TTail>
+    struct pools<VAlignment, THead, TTail...>
+    {
+      typedef pools<VAlignment, TTail...> tail_t;
+
+      static TYPHOON_CONSTANT size_t First_Block_Size = THead::Block_Size;
+      static TYPHOON_CONSTANT size_t Max_Block_Size   = (THead::Block_Size > tail_t::Max_Block_Size) ? THead::Block_Size : tail_t::Max_Block_Size;
+      static TYPHOON_CONSTANT bool   Is_Ascending     = tail_t::Is_Ascending && (THead::Block_Size < tail_t::First_Block_Size);
+
+      //***********************************************************************
+      /// Writes the address of each pool to 'p'.
+      //***********************************************************************
+      void get(tpn::ipool** p)
+      {
+        *p = &head;
+        tail.get(p + 1);
+      }
+
+      tpn::generic_pool<THead::Block_Size, VAlignment, THead::Size> head;
+      tail_t tail;
+    };
+  }
+
+  //*************************************************************************
+  /// A memory block allocator with a pool for each of a list of size classes.
+  /// A request is mapped to the smallest class that fits with one table
+  /// lookup. If that class is exhausted, the next larger class is tried.
+  /// Releases find the owning pool by address, with one range check over the
+  /// storage and a binary search of the pool boundaries, so neither
+  /// allocation nor release walks a chain of allocators.
+  /// The size classes must be given in ascending order of block size.
+  /// e.g.
+  /// tpn::slab_memory_block_allocator<8U,
+  ///                                  tpn::slab_size_class<32U,  64U>,
+  ///                                  tpn::slab_size_class<128U, 16U>,
+  ///                                  tpn::slab_size_class<512U, 4U>> allocator;
+  //*************************************************************************
+  template <size_t VAlignment, typename... TClasses>
+  class slab_memory_block_allocator : public imemory_block_allocator
+  {
+  private:
+
+    typedef private_slab::pools<VAlignment, TClasses...> pools_t;
+
+  public:
+
+    static TYPHOON_CONSTANT size_t Alignment         = VAlignment;
+    static TYPHOON_CONSTANT size_t Number_Of_Classes = sizeof...(TClasses);
+    static TYPHOON_CONSTANT size_t Max_Block_Size    = pools_t::Max_Block_Size;
+
+    TYPHOON_STATIC_ASSERT(Number_Of_Classes > 0U, "At least one size class is required");
+    TYPHOON_STATIC_ASSERT(Number_Of_Classes <= 255U, "Too many size classes");
+    TYPHOON_STATIC_ASSERT(pools_t::Is_Ascending, "Size classes must be in ascending order of block size");
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    slab_memory_block_allocator()
+    {
+      storage.get(pools);
+
+      // The pools are members of 'storage' in class order, so each pool's
+      // buffer lies between its own address and that of the next pool.
+      for (size_t i = 0U; i < Number_Of_Classes; ++i)
+      {
+        boundaries[i] = uintptr_t(pools[i]);
+      }
+
+      // Fill the table that maps a size to the smallest class that holds it.
+      // Each entry covers sizes up to the next multiple of the alignment.
+      // The pools round their blocks up to the alignment, so a class holds
+      // more than its nominal block size when that is not a multiple of it.
+      size_t size_class = 0U;
+
+      for (size_t i = 0U; i < Lookup_Size; ++i)
+      {
+        const size_t size = (i + 1U) * Alignment;
+
+        while ((((block_size(size_class) + Alignment - 1U) / Alignment) * Alignment) < size)
+        {
+          ++size_class;
+        }
+
+        lookup[i] = uint8_t(size_class);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the index of the smallest class that holds 'required_size',
+    /// or Number_Of_Classes if none does.
+    //*************************************************************************
+    size_t size_class(size_t required_size) const
+    {
+      if (required_size > Max_Block_Size)
+      {
+        return Number_Of_Classes;
+      }
+
+      return lookup[index_of(required_size)];
+    }
+
+    //*************************************************************************
+    /// Returns the block size of a size class.
+    //*************************************************************************
+    static size_t block_size(size_t size_class)
+    {
+      static TYPHOON_CONSTANT size_t block_sizes[Number_Of_Classes] = { TClasses::Block_Size... };
+
+      return (size_class < Number_Of_Classes) ? block_sizes[size_class] : 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the pool for a size class.
+    //*************************************************************************
+    const tpn::ipool& pool(size_t size_class) const
+    {
+      return *pools[size_class];
+    }
+
+  private:
+
+    /// A structure that has the size of one byte, which fits in any block.
+    struct block
+    {
+      char data[1];
+    };
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) TYPHOON_OVERRIDE
+    {
+      if ((required_alignment <= Alignment) && (required_size <= Max_Block_Size))
+      {
+        for (size_t i = lookup[index_of(required_size)]; i < Number_Of_Classes; ++i)
+        {
+          if (!pools[i]->full())
+          {
+            return pools[i]->template allocate<block>();
+          }
+        }
+      }
+
+      return TYPHOON_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) TYPHOON_OVERRIDE
+    {
+      tpn::ipool* const p_pool = find_pool(pblock);
+
+      if (p_pool != TYPHOON_NULLPTR)
+      {
+        p_pool->release(pblock);
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const TYPHOON_OVERRIDE
+    {
+      return find_pool(pblock) != TYPHOON_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The pool whose buffer holds 'pblock', or a null pointer.
+    /// Addresses outside the storage are rejected with one range check.
+    /// Otherwise the last pool that starts at or before the address is
+    /// found by a binary search of the boundaries, and it alone is checked.
+    //*************************************************************************
+    tpn::ipool* find_pool(const void* const pblock) const
+    {
+      const uintptr_t address = uintptr_t(pblock);
+
+      if ((address < uintptr_t(&storage)) || (address >= uintptr_t(&storage + 1)))
+      {
+        return TYPHOON_NULLPTR;
+      }
+
+      size_t first = 0U;
+      size_t last  = Number_Of_Classes;
+
+      while ((last - first) > 1U)
+      {
+        const size_t middle = first + ((last - first) / 2U);
+
+        if (boundaries[middle] <= address)
+        {
+          first = middle;
+        }
+        else
+        {
+          last = middle;
+        }
+      }
+
+      return pools[first]->is_in_pool(pblock) ? pools[first] : TYPHOON_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The lookup table index for a size.
+    //*************************************************************************
+    static size_t index_of(size_t required_size)
+    {
+      return (required_size == 0U) ? 0U : ((required_size - 1U) / Alignment);
+    }
+
+    static TYPHOON_CONSTANT size_t Lookup_Size = (Max_Block_Size + Alignment - 1U) / Alignment;
+
+    pools_t     storage;                       ///< The pools for each size class.
+    tpn::ipool* pools[Number_Of_Classes];      ///< The pools, smallest blocks first.
+    uintptr_t   boundaries[Number_Of_Classes]; ///< The address of each pool, ascending.
+    uint8_t     lookup[Lookup_Size];           ///< The smallest class for each multiple of the alignment.
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,429 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2021 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_SMALL_VECTOR_HPP
+#define TYPHOON_SMALL_VECTOR_HPP
+
+#include "platform.hpp"
+#include "vector.hpp"
+#include "imemory_block_allocator.hpp"
+#include "type_traits.hpp"
+#include "memory.hpp"
+#include "alignment.hpp"
+#include "static_assert.hpp"
+#include "nullptr.hpp"
+#include "initializer_list.hpp"
+
+#include <stddef.h>
+#include <string.h>
+
+#if !TYPHOON_HAS_IVECTOR_GROWTH
+  #error tpn::small_vector requires TYPHOON_IVECTOR_GROWTH_ENABLE to be defined in the profile
+#endif
+
+//*****************************************************************************
+///\defgroup small_vector small_vector
+/// A vector that keeps its first elements inline and moves to a block from a
+/// memory block allocator when it overflows.
+///\ingroup containers
+//*****************************************************************************
+
+namespace tpn
+{
+  //***************************************************************************
+  /// Whether a T may be moved to a new address with memcpy, leaving nothing to
+  /// destroy at the old one.
+  /// Defaults to trivially copyable types. Specialise it for types, such as
+  /// ones holding a pointer to a heap object, that are relocatable but not
+  /// trivially copyable.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  struct is_trivially_relocatable : public tpn::bool_constant<tpn::is_trivially_copyable<T>::value>
+  {
+  };
+
+  //***************************************************************************
+  /// A vector that stores up to INLINE_SIZE elements in an internal buffer.
+  /// When it overflows, the elements move to a block from the allocator, which
+  /// grows geometrically. It is a tpn::ivector<T>, so code taking an ivector
+  /// reference works with it unchanged, and grows it as needed.
+  /// Needs TYPHOON_IVECTOR_GROWTH_ENABLE, which adds the capacity check that
+  /// growth relies on to every ivector.
+  /// If the allocator cannot supply a large enough block then the vector stays
+  /// full and the usual vector_full error is reported.
+  /// Growing invalidates iterators and references, as with std::vector.
+  /// Arguments to emplace, and the value given to insert(position, n, value),
+  /// must not refer to elements of the vector being grown.
+  ///\tparam T            The element type.
+  ///\tparam INLINE_SIZE_ The number of elements stored without the allocator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T, const size_t INLINE_SIZE_>
+  class small_vector : public tpn::ivector<T>
+  {
+  public:
+
+    TYPHOON_STATIC_ASSERT((INLINE_SIZE_ > 0U), "Zero capacity tpn::small_vector is not valid");
+    TYPHOON_STATIC_ASSERT(!tpn::is_pointer<T>::value, "tpn::small_vector does not support pointer elements");
+
+    static const size_t INLINE_SIZE = INLINE_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit small_vector(tpn::imemory_block_allocator& allocator_)
+      : tpn::ivector<T>(reinterpret_cast<T*>(&buffer), INLINE_SIZE, &small_vector::grow)
+      , p_allocator(&allocator_)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor, with size.
+    ///\param initial_size The initial size of the vector.
+    //*************************************************************************
+    small_vector(size_t initial_size, tpn::imemory_block_allocator& allocator_)
+      : tpn::ivector<T>(reinterpret_cast<T*>(&buffer), INLINE_SIZE, &small_vector::grow)
+      , p_allocator(&allocator_)
+    {
+      this->initialise();
+      this->resize(initial_size);
+    }
+
+    //*************************************************************************
+    /// Constructor, from initial size and value.
+    ///\param initial_size The initial size of the vector.
+    ///\param value        The value to fill the vector with.
+    //*************************************************************************
+    small_vector(size_t initial_size, typename tpn::ivector<T>::parameter_t value, tpn::imemory_block_allocator& allocator_)
+      : tpn::ivector<T>(reinterpret_cast<T*>(&buffer), INLINE_SIZE, &small_vector::grow)
+      , p_allocator(&allocator_)
+    {
+      this->initialise();
+      this->resize(initial_size, value);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    small_vector(TIterator first, TIterator last, tpn::imemory_block_allocator& allocator_, typename tpn::enable_if<!tpn::is_integral<TIterator>::value, int>::type = 0)
+      : tpn::ivector<T>(reinterpret_cast<T*>(&buffer), INLINE_SIZE, &small_vector::grow)
+      , p_allocator(&allocator_)
+    {
+      this->assign(first, last);
+    }
+
+#if TYPHOON_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    small_vector(std::initializer_list<T> init, tpn::imemory_block_allocator& allocator_)
+      : tpn::ivector<T>(reinterpret_cast<T*>(&buffer), INLINE_SIZE, &small_vector::grow)
+      , p_allocator(&allocator_)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// The copy uses the same allocator as 'other'.
+    //*************************************************************************
+    small_vector(const small_vector& other)
+      : tpn::ivector<T>(reinterpret_cast<T*>(&buffer), INLINE_SIZE, &small_vector::grow)
+      , p_allocator(other.p_allocator)
+    {
+      this->assign(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// Keeps this vector's allocator.
+    //*************************************************************************
+    small_vector& operator = (const small_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    /// Takes over the block of 'other' if it has one, otherwise relocates its
+    /// inline elements. 'other' is left empty and inline.
+    //*************************************************************************
+    small_vector(small_vector&& other)
+      : tpn::ivector<T>(reinterpret_cast<T*>(&buffer), INLINE_SIZE, &small_vector::grow)
+      , p_allocator(other.p_allocator)
+    {
+      take(other);
+    }
+
+    //*************************************************************************
+    /// Move assignment operator.
+    /// Takes over the block of 'rhs', and its allocator, if it has one,
+    /// otherwise relocates its inline elements and keeps this vector's
+    /// allocator. 'rhs' is left empty and inline.
+    //*************************************************************************
+    small_vector& operator = (small_vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->clear();
+        release_block();
+
+        if (!rhs.is_inline())
+        {
+          p_allocator = rhs.p_allocator;
+        }
+
+        take(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#ifdef TYPHOON_IVECTOR_REPAIR_ENABLE
+    virtual
+#endif
+    ~small_vector()
+    {
+      this->clear();
+      release_block();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the elements are in the internal buffer.
+    //*************************************************************************
+    bool is_inline() const
+    {
+      return this->p_buffer == inline_buffer();
+    }
+
+    //*************************************************************************
+    /// Moves the elements back to the internal buffer, and releases the block,
+    /// if they fit. Otherwise does nothing.
+    //*************************************************************************
+    void shrink_to_fit()
+    {
+      if (!is_inline() && (this->size() <= INLINE_SIZE))
+      {
+        T* const p_block = this->p_buffer;
+
+        this->p_end    = relocate(this->p_buffer, this->p_end, inline_buffer());
+        this->p_buffer = inline_buffer();
+        this->CAPACITY = INLINE_SIZE;
+
+        p_allocator->release(p_block);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the allocator that supplies the blocks.
+    //*************************************************************************
+    tpn::imemory_block_allocator& get_allocator() const
+    {
+      return *p_allocator;
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    /// Only an inline vector may be copied this way.
+    //*************************************************************************
+#ifdef TYPHOON_IVECTOR_REPAIR_ENABLE
+    virtual
+#endif
+    void repair()
+#ifdef TYPHOON_IVECTOR_REPAIR_ENABLE
+      TYPHOON_OVERRIDE
+#endif
+    {
+      TYPHOON_ASSERT(tpn::is_trivially_copyable<T>::value, TYPHOON_ERROR(tpn::vector_incompatible_type));
+      TYPHOON_ASSERT(this->CAPACITY == INLINE_SIZE, TYPHOON_ERROR(tpn::vector_incompatible_type));
+
+      tpn::ivector<T>::repair_buffer(inline_buffer());
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The growth function given to ivector.
+    /// Doubles the capacity, or grows to 'required' if that is more. If the
+    /// allocator cannot supply the doubled size then 'required' is tried.
+    //*************************************************************************
+    static void grow(tpn::ivector<T>& base, size_t required)
+    {
+      small_vector& self = static_cast<small_vector&>(base);
+
+      size_t new_capacity = self.CAPACITY * 2U;
+
+      if (new_capacity < required)
+      {
+        new_capacity = required;
+      }
+
+      T* p_block = self.allocate_block(new_capacity);
+
+      if ((p_block == TYPHOON_NULLPTR) && (new_capacity != required))
+      {
+        new_capacity = required;
+        p_block      = self.allocate_block(new_capacity);
+      }
+
+      if (p_block != TYPHOON_NULLPTR)
+      {
+        T* const   p_old      = self.p_buffer;
+        const bool was_inline = self.is_inline();
+
+        self.p_end    = relocate(self.p_buffer, self.p_end, p_block);
+        self.p_buffer = p_block;
+        self.CAPACITY = new_capacity;
+
+        if (!was_inline)
+        {
+          self.p_allocator->release(p_old);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Allocates a block for 'n' elements, or returns null.
+    //*************************************************************************
+    T* allocate_block(size_t n)
+    {
+      if (n > (size_t(-1) / sizeof(T)))
+      {
+        return TYPHOON_NULLPTR;
+      }
+
+      return static_cast<T*>(p_allocator->allocate(n * sizeof(T), tpn::alignment_of<T>::value));
+    }
+
+    //*************************************************************************
+    /// Releases the block, if there is one, and returns to the inline buffer.
+    /// The vector must be empty.
+    //*************************************************************************
+    void release_block()
+    {
+      if (!is_inline())
+      {
+        p_allocator->release(this->p_buffer);
+
+        this->p_buffer = inline_buffer();
+        this->p_end    = this->p_buffer;
+        this->CAPACITY = INLINE_SIZE;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the elements in [first, last) to 'p_destination', which does not
+    /// overlap them, and returns the new end.
+    /// Trivially relocatable elements are copied as bytes. Others are move
+    /// constructed and the originals destroyed.
+    //*************************************************************************
+    static T* relocate(T* first, T* last, T* p_destination)
+    {
+      const size_t n = size_t(last - first);
+
+      if (tpn::is_trivially_relocatable<T>::value)
+      {
+        if (n != 0U)
+        {
+          memcpy(static_cast<void*>(p_destination), static_cast<const void*>(first), n * sizeof(T));
+        }
+      }
+      else
+      {
+        tpn::uninitialized_move(first, last, p_destination);
+        tpn::destroy(first, last);
+      }
+
+      return p_destination + n;
+    }
+
+#if TYPHOON_USING_CPP11
+    //*************************************************************************
+    /// Takes the contents of 'other'.
+    /// This vector must be empty and inline, and use the allocator of 'other'
+    /// if 'other' has a block.
+    //*************************************************************************
+    void take(small_vector& other)
+    {
+      if (other.is_inline())
+      {
+        this->p_end = relocate(other.p_buffer, other.p_end, this->p_buffer);
+        other.p_end = other.p_buffer;
+      }
+      else
+      {
+        this->p_buffer = other.p_buffer;
+        this->p_end    = other.p_end;
+        this->CAPACITY = other.CAPACITY;
+
+        other.p_buffer = other.inline_buffer();
+        other.p_end    = other.p_buffer;
+        other.CAPACITY = INLINE_SIZE;
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// The address of the internal buffer.
+    //*************************************************************************
+    T* inline_buffer()
+    {
+      return reinterpret_cast<T*>(&buffer);
+    }
+
+    const T* inline_buffer() const
+    {
+      return reinterpret_cast<const T*>(&buffer);
+    }
+
+    tpn::imemory_block_allocator* p_allocator;
+
+    typename tpn::aligned_storage<sizeof(T) * INLINE_SIZE, tpn::alignment_of<T>::value>::type buffer;
+  };
+}
+
+#endif
@@ -37,6 +37,7 @@ SOFTWARE.
 #include "memory.hpp"
 #include "char_traits.hpp"
 #include "optional.hpp"
+#include "private/string_search.hpp"
 
 #include <ctype.h>
 #include <stdint.h>
@@ -487,6 +488,25 @@ namespace tpn
     }
   }
 
+  namespace private_string_utilities
+  {
+    //*********************************************************************
+    /// The length of a null terminated list of delimiters.
+    //*********************************************************************
+    template <typename TPointer>
+    size_t delimiter_count(TPointer delimiters)
+    {
+      size_t count = 0U;
+
+      while (delimiters[count] != 0)
+      {
+        ++count;
+      }
+
+      return count;
+    }
+  }
+
   //*********************************************************************
   /// Find first of any of delimiters within the string
   //*********************************************************************
@@ -515,6 +535,23 @@ namespace tpn
     return last;
   }
 
+  //*********************************************************************
+  /// Find first of any of delimiters within the string
+  /// Contiguous characters are scanned a block at a time.
+  //*********************************************************************
+  template <typename T, typename TPointer>
+  T* find_first_of(T* first, T* last, TPointer delimiters)
+  {
+    typedef typename tpn::remove_cv<T>::type value_type;
+
+    const size_t index = private_string_search::find_of<value_type>(first,
+                                                                    static_cast<size_t>(last - first),
+                                                                    delimiters,
+                                                                    private_string_utilities::delimiter_count(delimiters));
+
+    return (index == private_string_search::npos) ? last : first + index;
+  }
+
   //*********************************************************************
   /// Find first of any of delimiters within the string
   //*********************************************************************
@@ -569,6 +606,24 @@ namespace tpn
     return last;
   }
 
+  //*********************************************************************
+  /// Find first not of any of delimiters within the string
+  /// Contiguous characters are scanned a block at a time.
+  //*********************************************************************
+  template <typename T, typename TPointer>
+  T* find_first_not_of(T* first, T* last, TPointer delimiters)
+  {
+    typedef typename tpn::remove_cv<T>::type value_type;
+
+    const size_t index = private_string_search::find_of<value_type>(first,
+                                                                    static_cast<size_t>(last - first),
+                                                                    delimiters,
+                                                                    private_string_utilities::delimiter_count(delimiters),
+                                                                    false);
+
+    return (index == private_string_search::npos) ? last : first + index;
+  }
+
   //*********************************************************************
   /// Find first not of any of delimiters within the string
   //*********************************************************************
@@ -621,6 +676,23 @@ namespace tpn
     return last;
   }
 
+  //*********************************************************************
+  /// Find last of any of delimiters within the string
+  /// Contiguous characters are scanned a block at a time.
+  //*********************************************************************
+  template <typename T, typename TPointer>
+  T* find_last_of(T* first, T* last, TPointer delimiters)
+  {
+    typedef typename tpn::remove_cv<T>::type value_type;
+
+    const size_t index = private_string_search::rfind_of<value_type>(first,
+                                                                     static_cast<size_t>(last - first),
+                                                                     delimiters,
+                                                                     private_string_utilities::delimiter_count(delimiters));
+
+    return (index == private_string_search::npos) ? last : first + index;
+  }
+
   //*********************************************************************
   /// Find last of any of delimiters within the string
   //*********************************************************************
@@ -681,6 +753,24 @@ namespace tpn
     return last;
   }
 
+  //*********************************************************************
+  /// Find last not of any of delimiters within the string
+  /// Contiguous characters are scanned a block at a time.
+  //*********************************************************************
+  template <typename T, typename TPointer>
+  T* find_last_not_of(T* first, T* last, TPointer delimiters)
+  {
+    typedef typename tpn::remove_cv<T>::type value_type;
+
+    const size_t index = private_string_search::rfind_of<value_type>(first,
+                                                                     static_cast<size_t>(last - first),
+                                                                     delimiters,
+                                                                     private_string_utilities::delimiter_count(delimiters),
+                                                                     false);
+
+    return (index == private_string_search::npos) ? last : first + index;
+  }
+
   //*********************************************************************
   /// Find last not of any of delimiters within the string
   //*********************************************************************
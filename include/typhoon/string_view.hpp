@@ -41,6 +41,7 @@ SOFTWARE.
 #include "hash.hpp"
 #include "basic_string.hpp"
 #include "algorithm.hpp"
+#include "private/string_search.hpp"
 #include "private/minmax_push.hpp"
 
 #include <stdint.h>
@@ -479,26 +480,22 @@ namespace tpn
     //*************************************************************************
     TYPHOON_CONSTEXPR14 size_type find(tpn::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
+      if ((size() < view.size()) || (position > size()))
       {
         return npos;
       }
 
-      const_iterator iposition = tpn::search(begin() + position, end(), view.begin(), view.end());
+      return found_at(position, private_string_search::search(mbegin + position, size() - position, view.data(), view.size()));
+    }
 
-      if (iposition == end())
+    TYPHOON_CONSTEXPR14 size_type find(T c, size_type position = 0) const
+    {
+      if (position >= size())
       {
         return npos;
       }
-      else
-      {
-        return tpn::distance(begin(), iposition);
-      }
-    }
 
-    TYPHOON_CONSTEXPR14 size_type find(T c, size_type position = 0) const
-    {
-      return find(tpn::basic_string_view<T, TTraits>(&c, 1), position);
+      return found_at(position, private_string_search::find(mbegin + position, size() - position, c));
     }
 
     TYPHOON_CONSTEXPR14 size_type find(const T* text, size_type position, size_type count) const
@@ -523,24 +520,20 @@ namespace tpn
 
       position = tpn::min(position, size());
 
-      const_iterator iposition = tpn::find_end(begin(),
-        begin() + position,
-        view.begin(),
-        view.end());
-
-      if (iposition == end())
+      // An empty view is found at the position, unless that is the end.
+      if (view.empty())
       {
-        return npos;
-      }
-      else
-      {
-        return tpn::distance(begin(), iposition);
+        return (position < size()) ? position : npos;
       }
+
+      return private_string_search::rsearch(mbegin, position, view.data(), view.size());
     }
 
     TYPHOON_CONSTEXPR14 size_type rfind(T c, size_type position = npos) const
     {
-      return rfind(tpn::basic_string_view<T, TTraits>(&c, 1), position);
+      position = tpn::min(position, size());
+
+      return private_string_search::rfind(mbegin, position, c);
     }
 
     TYPHOON_CONSTEXPR14 size_type rfind(const T* text, size_type position, size_type count) const
@@ -558,22 +551,9 @@ namespace tpn
     //*************************************************************************
     TYPHOON_CONSTEXPR14 size_type find_first_of(tpn::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position < size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0UL; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
-        }
+        return found_at(position, private_string_search::find_of(mbegin + position, size() - position, view.data(), view.size()));
       }
 
       return npos;
@@ -581,7 +561,12 @@ namespace tpn
 
     TYPHOON_CONSTEXPR14 size_type find_first_of(T c, size_type position = 0) const
     {
-      return find_first_of(tpn::basic_string_view<T, TTraits>(&c, 1), position);
+      if (position < size())
+      {
+        return found_at(position, private_string_search::find(mbegin + position, size() - position, c));
+      }
+
+      return npos;
     }
 
     TYPHOON_CONSTEXPR14 size_type find_first_of(const T* text, size_type position, size_type count) const
@@ -606,30 +591,19 @@ namespace tpn
 
       position = tpn::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      return private_string_search::rfind_of(mbegin, position + 1U, view.data(), view.size());
+    }
 
-      while (it != rend())
+    TYPHOON_CONSTEXPR14 size_type find_last_of(T c, size_type position = npos) const
+    {
+      if (empty())
       {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
+        return npos;
       }
 
-      return npos;
-    }
+      position = tpn::min(position, size() - 1);
 
-    TYPHOON_CONSTEXPR14 size_type find_last_of(T c, size_type position = npos) const
-    {
-      return find_last_of(tpn::basic_string_view<T, TTraits>(&c, 1), position);
+      return private_string_search::rfind(mbegin, position + 1U, c);
     }
 
     TYPHOON_CONSTEXPR14 size_type find_last_of(const T* text, size_type position, size_type count) const
@@ -647,29 +621,9 @@ namespace tpn
     //*************************************************************************
     TYPHOON_CONSTEXPR14 size_type find_first_not_of(tpn::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position < size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0UL; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
+        return found_at(position, private_string_search::find_of(mbegin + position, size() - position, view.data(), view.size(), false));
       }
 
       return npos;
@@ -677,7 +631,12 @@ namespace tpn
 
     TYPHOON_CONSTEXPR14 size_type find_first_not_of(T c, size_type position = 0) const
     {
-      return find_first_not_of(tpn::basic_string_view<T, TTraits>(&c, 1), position);
+      if (position < size())
+      {
+        return found_at(position, private_string_search::find(mbegin + position, size() - position, c, false));
+      }
+
+      return npos;
     }
 
     TYPHOON_CONSTEXPR14 size_type find_first_not_of(const T* text, size_type position, size_type count) const
@@ -702,37 +661,19 @@ namespace tpn
 
       position = tpn::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      return private_string_search::rfind_of(mbegin, position + 1U, view.data(), view.size(), false);
+    }
 
-      while (it != rend())
+    TYPHOON_CONSTEXPR14 size_type find_last_not_of(T c, size_type position = npos) const
+    {
+      if (empty())
       {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
+        return npos;
       }
 
-      return npos;
-    }
+      position = tpn::min(position, size() - 1);
 
-    TYPHOON_CONSTEXPR14 size_type find_last_not_of(T c, size_type position = npos) const
-    {
-      return find_last_not_of(tpn::basic_string_view<T, TTraits>(&c, 1), position);
+      return private_string_search::rfind(mbegin, position + 1U, c, false);
     }
 
     TYPHOON_CONSTEXPR14 size_type find_last_not_of(const T* text, size_type position, size_type count) const
@@ -796,6 +737,14 @@ namespace tpn
 
   private:
 
+    //*************************************************************************
+    /// Converts a search result relative to 'position' to an index.
+    //*************************************************************************
+    static TYPHOON_CONSTEXPR size_type found_at(size_type position, size_t index)
+    {
+      return (index == private_string_search::npos) ? npos : position + index;
+    }
+
     const_pointer mbegin;
     const_pointer mend;
   };
@@ -12,92 +12,398 @@
 
 #include <typhoon/utility.hpp>
 #include <typhoon/memory.hpp>
+#include <typhoon/type_traits.hpp>
+#include <typhoon/placement_new.hpp>
+#include <typhoon/nullptr.hpp>
 
-#include <zephyr/kernel.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//
+// Threads run on Zephyr kernel threads on the target, and on POSIX threads
+// in a host build so that code using them can be tested natively.
+// The native parts are implemented in lib/thread.cpp.
+//
+#if defined(__ZEPHYR__)
+    #define TYPHOON_THREAD_ZEPHYR 1
+    #include <zephyr/kernel.h>
+#elif defined(__unix__) || defined(__APPLE__)
+    #define TYPHOON_THREAD_POSIX 1
+    #include <pthread.h>
+    #include <semaphore.h>
+#else
+    #error "tpn::thread has no backend for this target"
+#endif
+
+// The priority given to threads that do not specify one.
+// Ignored by the POSIX backend.
+#ifndef TYPHOON_THREAD_DEFAULT_PRIORITY
+    #define TYPHOON_THREAD_DEFAULT_PRIORITY 5
+#endif
+
+// The space reserved in each thread for its function object.
+#ifndef TYPHOON_THREAD_FUNCTION_SIZE
+    #define TYPHOON_THREAD_FUNCTION_SIZE (4U * sizeof(void*))
+#endif
 
 namespace tpn {
 
+namespace private_thread {
 
-class thread
-{
-private:
-    using genuine_native_handle_type = k_thread;
+    //
+    // A void() function object stored in place, with no heap allocation.
+    // The callable must fit in 'Size' bytes.
+    //
+    template <size_t Size>
+    class inplace_function
+    {
+    public:
+        inplace_function() noexcept :
+            invoke_(TYPHOON_NULLPTR),
+            manage_(TYPHOON_NULLPTR)
+        {
+        }
+
+        template <typename TFunction,
+                  typename = typename tpn::enable_if<!tpn::is_same<typename tpn::decay<TFunction>::type, inplace_function>::value>::type>
+        inplace_function(TFunction&& f) :
+            inplace_function()
+        {
+            assign(tpn::forward<TFunction>(f));
+        }
+
+        inplace_function(inplace_function&& other) noexcept :
+            inplace_function()
+        {
+            move_from(other);
+        }
+
+        inplace_function& operator=(inplace_function&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                move_from(other);
+            }
 
+            return *this;
+        }
+
+        inplace_function(const inplace_function&) = delete;
+        inplace_function& operator=(const inplace_function&) = delete;
+
+        ~inplace_function()
+        {
+            reset();
+        }
+
+        template <typename TFunction>
+        void assign(TFunction&& f)
+        {
+            using function_type = typename tpn::decay<TFunction>::type;
+
+            static_assert(sizeof(function_type) <= Size, "Function object too large for the in-place storage");
+            static_assert(alignof(function_type) <= alignof(max_align_t), "Function object over-aligned");
+
+            reset();
+
+            ::new (static_cast<void*>(storage_)) function_type(tpn::forward<TFunction>(f));
+            invoke_ = &invoke<function_type>;
+            manage_ = &manage<function_type>;
+        }
+
+        void reset() noexcept
+        {
+            if (manage_ != TYPHOON_NULLPTR)
+            {
+                manage_(storage_, TYPHOON_NULLPTR);
+                invoke_ = TYPHOON_NULLPTR;
+                manage_ = TYPHOON_NULLPTR;
+            }
+        }
+
+        explicit operator bool() const noexcept
+        { return invoke_ != TYPHOON_NULLPTR; }
+
+        void operator()()
+        { invoke_(storage_); }
+
+    private:
+        template <typename TFunction>
+        static void invoke(void* p)
+        { (*static_cast<TFunction*>(p))(); }
+
+        // Moves 'source' to 'destination' and destroys it,
+        // or just destroys 'destination' if 'source' is null.
+        template <typename TFunction>
+        static void manage(void* destination, void* source)
+        {
+            if (source != TYPHOON_NULLPTR)
+            {
+                TFunction* f = static_cast<TFunction*>(source);
+                ::new (destination) TFunction(tpn::move(*f));
+                f->~TFunction();
+            }
+            else
+            {
+                static_cast<TFunction*>(destination)->~TFunction();
+            }
+        }
+
+        void move_from(inplace_function& other) noexcept
+        {
+            if (other.manage_ != TYPHOON_NULLPTR)
+            {
+                other.manage_(storage_, other.storage_);
+                invoke_ = other.invoke_;
+                manage_ = other.manage_;
+                other.invoke_ = TYPHOON_NULLPTR;
+                other.manage_ = TYPHOON_NULLPTR;
+            }
+        }
+
+        alignas(max_align_t) unsigned char storage_[Size];
+        void (*invoke_)(void*);
+        void (*manage_)(void*, void*);
+    };
+
+}
+
+//
+// The common part of all threads, independent of the stack size.
+// A thread cannot be copied or moved, as the native thread refers to
+// the stack held inside the object.
+//
+class ithread
+{
 public:
+#if defined(TYPHOON_THREAD_ZEPHYR)
     using native_handle_type = k_tid_t;
+#else
+    using native_handle_type = pthread_t;
+#endif
+
+    using function_type = private_thread::inplace_function<TYPHOON_THREAD_FUNCTION_SIZE>;
 
     class id
     {
-    private:
-        using native_handle_type = k_tid_t;
-
     public:
-        id() noexcept :
-            id_(::k_current_get())
-        {
-        }
+        using native_handle_type = ithread::native_handle_type;
+
+        id() noexcept;
 
         explicit id(native_handle_type _id) noexcept :
             id_(_id)
         {
         }
 
-        bool operator==(id rhs) noexcept
-        { return this->id_ == rhs.id_; }
+        native_handle_type id_;
+    };
 
-        bool operator!=(id rhs) noexcept
-        { return this->id_ != rhs.id_; }
+    ithread(const ithread&) = delete;
+    ithread& operator=(const ithread&) = delete;
 
-        bool operator<(id rhs) noexcept
-        { return this->id_ < rhs.id_; }
+    //
+    // Runs 'f' on the thread.
+    // The thread must not already be running.
+    //
+    template <typename TFunction>
+    void start(TFunction&& f)
+    {
+        function_.assign(tpn::forward<TFunction>(f));
+        start_native();
+    }
 
-        bool operator<=(id rhs) noexcept
-        { return this->id_ <= rhs.id_; }
+    bool joinable() const noexcept
+    { return joinable_; }
 
-        bool operator>(id rhs) noexcept
-        { return this->id_ > rhs.id_; }
+    //
+    // Waits for the thread to finish.
+    //
+    void join();
 
-        bool operator>=(id rhs) noexcept
-        { return this->id_ >= rhs.id_; }
+    //
+    // Lets the thread run on independently.
+    // The thread object must outlive it, as it holds the stack.
+    //
+    void detach();
 
-        native_handle_type id_;
-    };
+    id get_id() const noexcept;
+
+    native_handle_type native_handle() noexcept;
+
+    size_t stack_size() const noexcept
+    { return stack_size_; }
+
+    int priority() const noexcept
+    { return priority_; }
+
+protected:
+    ithread(void* stack, size_t stack_size, int priority) noexcept :
+        stack_(stack),
+        stack_size_(stack_size),
+        priority_(priority),
+        joinable_(false)
+    {
+    }
+
+    ~ithread()
+    {
+        if (joinable_)
+        {
+            join();
+        }
+    }
 
-    thread() noexcept = default;
+private:
+    void start_native();
+
+#if defined(TYPHOON_THREAD_ZEPHYR)
+    static void entry(void* self, void*, void*);
+#else
+    static void* entry(void* self);
+#endif
+
+    function_type function_;
+    void*         stack_;
+    size_t        stack_size_;
+    int           priority_;
+    bool          joinable_;
+
+#if defined(TYPHOON_THREAD_ZEPHYR)
+    struct k_thread thread_;
+#else
+    pthread_t       thread_;
+#endif
+};
+
+//
+// A thread with a statically allocated stack.
+// The stack lives inside the object, so a thread declared at namespace
+// scope or as a static needs no heap.
+// \tparam STACK_SIZE The size of the stack in bytes.
+//                    A POSIX host falls back to its own stack if the C library cannot use it.
+// \tparam PRIORITY   The Zephyr thread priority.
+//
+template <size_t STACK_SIZE, int PRIORITY = TYPHOON_THREAD_DEFAULT_PRIORITY>
+class thread : public ithread
+{
+public:
+    thread() noexcept :
+#if defined(TYPHOON_THREAD_ZEPHYR)
+        ithread(stack_, K_THREAD_STACK_SIZEOF(stack_), PRIORITY)
+#else
+        ithread(stack_, STACK_SIZE, PRIORITY)
+#endif
+    {
+    }
+
+    template <typename TFunction,
+              typename = typename tpn::enable_if<!tpn::is_same<typename tpn::decay<TFunction>::type, thread>::value>::type>
+    explicit thread(TFunction&& f) :
+        thread()
+    {
+        start(tpn::forward<TFunction>(f));
+    }
 
-    thread(thread&& other) noexcept
-    { constexpr auto asdf = sizeof(genuine_native_handle_type); }
+    //
+    // Joins the thread if it is still joinable.
+    //
+    ~thread()
+    {
+        if (joinable())
+        {
+            join();
+        }
+    }
 
-    
+private:
+#if defined(TYPHOON_THREAD_ZEPHYR)
+    K_THREAD_STACK_MEMBER(stack_, STACK_SIZE);
+#else
+    alignas(64) unsigned char stack_[STACK_SIZE];
+#endif
 };
 
-bool operator==(thread::id lhs, thread::id rhs) noexcept
+inline bool operator==(ithread::id lhs, ithread::id rhs) noexcept
 { return lhs.id_ == rhs.id_; }
 
-bool operator!=(thread::id lhs, thread::id rhs) noexcept
+inline bool operator!=(ithread::id lhs, ithread::id rhs) noexcept
 { return lhs.id_ != rhs.id_; }
 
-bool operator<(thread::id lhs, thread::id rhs) noexcept
+inline bool operator<(ithread::id lhs, ithread::id rhs) noexcept
 { return lhs.id_ < rhs.id_; }
 
-bool operator<=(thread::id lhs, thread::id rhs) noexcept
+inline bool operator<=(ithread::id lhs, ithread::id rhs) noexcept
 { return lhs.id_ <= rhs.id_; }
 
-bool operator>(thread::id lhs, thread::id rhs) noexcept
+inline bool operator>(ithread::id lhs, ithread::id rhs) noexcept
 { return lhs.id_ > rhs.id_; }
 
-bool operator>=(thread::id lhs, thread::id rhs) noexcept
+inline bool operator>=(ithread::id lhs, ithread::id rhs) noexcept
 { return lhs.id_ >= rhs.id_; }
 
+//
+// A counting semaphore on the native kernel object.
+//
+class counting_semaphore
+{
+public:
+    explicit counting_semaphore(uint32_t initial = 0U) noexcept;
+    ~counting_semaphore();
+
+    counting_semaphore(const counting_semaphore&) = delete;
+    counting_semaphore& operator=(const counting_semaphore&) = delete;
+
+    //
+    // Adds 'n' to the count, waking up to 'n' waiting threads.
+    //
+    void release(uint32_t n = 1U);
+
+    //
+    // Waits until the count is non-zero, then decrements it.
+    //
+    void acquire();
+
+    //
+    // Decrements the count if it is non-zero.
+    //
+    bool try_acquire();
+
+    //
+    // Waits up to 'ms' milliseconds for the count to be non-zero,
+    // then decrements it. Returns false on timeout.
+    //
+    bool try_acquire_for_ms(uint32_t ms);
+
+private:
+#if defined(TYPHOON_THREAD_ZEPHYR)
+    struct k_sem sem_;
+#else
+    sem_t        sem_;
+#endif
+};
+
 namespace this_thread {
 
-    thread::id get_id() noexcept
-    {
-        return thread::id(::k_current_get());
-    }
+    ithread::id get_id() noexcept;
+
+    void yield() noexcept;
 
+    void sleep_for_ms(uint32_t ms) noexcept;
+
+}
+
+//
+// The time since start up, in microseconds, from a monotonic clock.
+//
+uint64_t uptime_us() noexcept;
+
+inline ithread::id::id() noexcept :
+    id_(this_thread::get_id().id_)
+{
 }
 
 }
 
-#endif
\ No newline at end of file
+#endif
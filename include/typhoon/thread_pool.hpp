@@ -0,0 +1,240 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#ifndef TYPHOON_THREAD_POOL_HPP
+#define TYPHOON_THREAD_POOL_HPP
+
+#include <typhoon/thread.hpp>
+#include <typhoon/queue_mpmc_atomic.hpp>
+#include <typhoon/atomic.hpp>
+#include <typhoon/utility.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The space reserved in each queued task for its function object.
+#ifndef TYPHOON_THREAD_POOL_TASK_SIZE
+    #define TYPHOON_THREAD_POOL_TASK_SIZE (4U * sizeof(void*))
+#endif
+
+namespace tpn {
+
+//
+// A fixed set of worker threads taking tasks from a bounded queue.
+// Nothing is allocated from the heap; the stacks, the queue and the
+// function objects are all held in the pool.
+// On SMP targets the kernel spreads the workers across the cores.
+// \tparam N_THREADS  The number of worker threads.
+// \tparam STACK_SIZE The stack size of each worker.
+// \tparam QUEUE_SIZE The maximum number of waiting tasks. Must be a power of 2.
+// \tparam TASK_SIZE  The maximum size of a task's function object.
+// \tparam PRIORITY   The priority of the workers.
+//
+template <size_t N_THREADS,
+          size_t STACK_SIZE,
+          size_t QUEUE_SIZE = 16U,
+          size_t TASK_SIZE  = TYPHOON_THREAD_POOL_TASK_SIZE,
+          int    PRIORITY   = TYPHOON_THREAD_DEFAULT_PRIORITY>
+class thread_pool
+{
+public:
+    static_assert(N_THREADS != 0U, "A thread pool needs at least one thread");
+
+    using task_type = private_thread::inplace_function<TASK_SIZE>;
+
+    thread_pool() :
+        outstanding_(0U),
+        stalled_(0U),
+        waiters_(0U),
+        stopping_(false)
+    {
+        for (size_t i = 0U; i < N_THREADS; ++i)
+        {
+            workers_[i].start([this]() { run(); });
+        }
+    }
+
+    //
+    // Runs the tasks already queued, then stops the workers.
+    //
+    ~thread_pool()
+    {
+        stop();
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    //
+    // Queues 'f' to be run on a worker.
+    // Returns false if the queue is full or the pool has been stopped.
+    //
+    template <typename TFunction>
+    bool submit(TFunction&& f)
+    {
+        if (stopping_.load(tpn::memory_order_acquire))
+        {
+            return false;
+        }
+
+        // Counted before it is visible to the workers, so that wait()
+        // cannot see zero while the task is queued.
+        outstanding_.fetch_add(1U, tpn::memory_order_relaxed);
+
+        if (!tasks_.emplace(tpn::forward<TFunction>(f)))
+        {
+            outstanding_.fetch_sub(1U, tpn::memory_order_release);
+            return false;
+        }
+
+        // Wakes any worker blocked behind this slot. A read-modify-write, so
+        // that either it sees the worker's count or the worker sees the slot.
+        const uint32_t stalled = stalled_.fetch_add(0U, tpn::memory_order_acq_rel);
+
+        if (stalled != 0U)
+        {
+            published_.release(stalled);
+        }
+
+        ready_.release();
+
+        return true;
+    }
+
+    //
+    // Waits until every submitted task has finished.
+    // Blocks rather than yields, so that it cannot starve workers of a lower
+    // priority.
+    //
+    void wait()
+    {
+        waiters_.fetch_add(1U, tpn::memory_order_acq_rel);
+
+        while (outstanding_.load(tpn::memory_order_acquire) != 0U)
+        {
+            idle_.acquire();
+        }
+
+        waiters_.fetch_sub(1U, tpn::memory_order_relaxed);
+    }
+
+    //
+    // Runs the tasks already queued, then stops and joins the workers.
+    // Must not be called while other threads are still submitting.
+    //
+    void stop()
+    {
+        if (!stopping_.exchange(true, tpn::memory_order_acq_rel))
+        {
+            ready_.release(static_cast<uint32_t>(N_THREADS));
+
+            for (size_t i = 0U; i < N_THREADS; ++i)
+            {
+                if (workers_[i].joinable())
+                {
+                    workers_[i].join();
+                }
+            }
+        }
+    }
+
+    //
+    // The number of tasks queued or running.
+    //
+    size_t outstanding() const noexcept
+    { return outstanding_.load(tpn::memory_order_acquire); }
+
+    static constexpr size_t size() noexcept
+    { return N_THREADS; }
+
+    static constexpr size_t max_queued() noexcept
+    { return QUEUE_SIZE; }
+
+private:
+    //
+    // The worker loop. Each task, and each worker at shutdown, adds one to
+    // the semaphore, so a worker only finds the queue empty once stopping.
+    //
+    void run()
+    {
+        task_type task;
+
+        for (;;)
+        {
+            ready_.acquire();
+
+            if (!pop(task))
+            {
+                return;
+            }
+
+            task();
+            task.reset();
+
+            if (outstanding_.fetch_sub(1U, tpn::memory_order_acq_rel) == 1U)
+            {
+                // The last one. A read-modify-write, as in submit().
+                const uint32_t waiters = waiters_.fetch_add(0U, tpn::memory_order_acq_rel);
+
+                if (waiters != 0U)
+                {
+                    idle_.release(waiters);
+                }
+            }
+        }
+    }
+
+    //
+    // Pops a task, once the worker holds a count from the semaphore.
+    // The pop can fail while an earlier submit has claimed the slot at the
+    // front but not yet filled it. The worker then blocks until a submit
+    // publishes, rather than yields, as yielding does not run a submitter
+    // of a lower priority on a fixed priority kernel.
+    // Returns false if the queue is empty and the pool is stopping.
+    //
+    bool pop(task_type& task)
+    {
+        while (!tasks_.pop(task))
+        {
+            if (stopping_.load(tpn::memory_order_acquire))
+            {
+                return false;
+            }
+
+            stalled_.fetch_add(1U, tpn::memory_order_acq_rel);
+
+            // Filled since the last look, or the submit will see the count.
+            if (tasks_.pop(task))
+            {
+                stalled_.fetch_sub(1U, tpn::memory_order_relaxed);
+                return true;
+            }
+
+            published_.acquire();
+            stalled_.fetch_sub(1U, tpn::memory_order_relaxed);
+        }
+
+        return true;
+    }
+
+    tpn::queue_mpmc_atomic<task_type, QUEUE_SIZE> tasks_;
+    counting_semaphore                             ready_;
+    counting_semaphore                             published_;
+    counting_semaphore                             idle_;
+    tpn::atomic<size_t>                            outstanding_;
+    tpn::atomic<uint32_t>                          stalled_;
+    tpn::atomic<uint32_t>                          waiters_;
+    tpn::atomic<bool>                              stopping_;
+
+    thread<STACK_SIZE, PRIORITY> workers_[N_THREADS];
+};
+
+}
+
+#endif
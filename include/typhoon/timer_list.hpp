@@ -0,0 +1,593 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2017 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_TIMER_LIST_HPP
+#define TYPHOON_TIMER_LIST_HPP
+
+#include "platform.hpp"
+#include "timer.hpp"
+#include "binary.hpp"
+#include "static_assert.hpp"
+
+#include <stdint.h>
+
+//*****************************************************************************
+// Active timer list policies for the callback and message timers.
+//
+// A policy is a type with a nested 'list' template, parameterised on the
+// timer data type. The timer data type must have the members
+// 'id', 'delta', 'previous' and 'next'.
+//
+// The list interface is
+//   list(TTimerData* ptimers)
+//   bool empty() const
+//   void insert(id)                      'delta' holds the delay in ticks.
+//   void remove(id, bool has_expired)
+//   void clear()
+//   id   next_expired(uint32_t& count)   Consumes 'count' until a timer
+//                                        expires. Returns NO_TIMER when
+//                                        'count' is used up.
+//*****************************************************************************
+
+namespace tpn
+{
+  //***************************************************************************
+  /// Keeps the active timers in a delta-sorted intrusive list.
+  /// Start and stop are O(n) in the number of active timers.
+  /// Tick is O(1) per expired timer.
+  //***************************************************************************
+  struct timer_delta_list
+  {
+    template <typename TTimerData>
+    class list
+    {
+    public:
+
+      //*******************************
+      list(TTimerData* ptimers_)
+        : head(tpn::timer::id::NO_TIMER)
+        , tail(tpn::timer::id::NO_TIMER)
+        , current(tpn::timer::id::NO_TIMER)
+        , ptimers(ptimers_)
+      {
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return head == tpn::timer::id::NO_TIMER;
+      }
+
+      //*******************************
+      // Inserts the timer at the correct delta position
+      //*******************************
+      void insert(tpn::timer::id::type id_)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        if (head == tpn::timer::id::NO_TIMER)
+        {
+          // No entries yet.
+          head = id_;
+          tail = id_;
+          timer.previous = tpn::timer::id::NO_TIMER;
+          timer.next     = tpn::timer::id::NO_TIMER;
+        }
+        else
+        {
+          // We already have entries.
+          tpn::timer::id::type test_id = begin();
+
+          while (test_id != tpn::timer::id::NO_TIMER)
+          {
+            TTimerData& test = ptimers[test_id];
+
+            // Find the correct place to insert.
+            if (timer.delta <= test.delta)
+            {
+              if (test.id == head)
+              {
+                head = timer.id;
+              }
+
+              // Insert before test.
+              timer.previous = test.previous;
+              test.previous  = timer.id;
+              timer.next     = test.id;
+
+              // Adjust the next delta to compensate.
+              test.delta -= timer.delta;
+
+              if (timer.previous != tpn::timer::id::NO_TIMER)
+              {
+                ptimers[timer.previous].next = timer.id;
+              }
+              break;
+            }
+            else
+            {
+              timer.delta -= test.delta;
+            }
+
+            test_id = next(test_id);
+          }
+
+          // Reached the end?
+          if (test_id == tpn::timer::id::NO_TIMER)
+          {
+            // Tag on to the tail.
+            ptimers[tail].next = timer.id;
+            timer.previous     = tail;
+            timer.next         = tpn::timer::id::NO_TIMER;
+            tail               = timer.id;
+          }
+        }
+      }
+
+      //*******************************
+      void remove(tpn::timer::id::type id_, bool has_expired)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        if (head == id_)
+        {
+          head = timer.next;
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+
+        if (tail == id_)
+        {
+          tail = timer.previous;
+        }
+        else
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        if (!has_expired)
+        {
+          // Adjust the next delta.
+          if (timer.next != tpn::timer::id::NO_TIMER)
+          {
+            ptimers[timer.next].delta += timer.delta;
+          }
+        }
+
+        timer.previous = tpn::timer::id::NO_TIMER;
+        timer.next     = tpn::timer::id::NO_TIMER;
+        timer.delta    = tpn::timer::state::INACTIVE;
+      }
+
+      //*******************************
+      /// Removes and returns the front timer if it expires within 'count',
+      /// subtracting its delta from 'count'.
+      /// Otherwise subtracts 'count' from the front timer and returns NO_TIMER.
+      //*******************************
+      tpn::timer::id::type next_expired(uint32_t& count)
+      {
+        if (!empty())
+        {
+          TTimerData& timer = front();
+
+          if (count >= timer.delta)
+          {
+            tpn::timer::id::type id = timer.id;
+
+            count -= timer.delta;
+            remove(id, true);
+
+            return id;
+          }
+
+          // Subtract any remainder from the next due timeout.
+          timer.delta -= count;
+        }
+
+        count = 0U;
+
+        return tpn::timer::id::NO_TIMER;
+      }
+
+      //*******************************
+      TTimerData& front()
+      {
+        return ptimers[head];
+      }
+
+      //*******************************
+      tpn::timer::id::type begin()
+      {
+        current = head;
+        return current;
+      }
+
+      //*******************************
+      tpn::timer::id::type previous(tpn::timer::id::type last)
+      {
+        current = ptimers[last].previous;
+        return current;
+      }
+
+      //*******************************
+      tpn::timer::id::type next(tpn::timer::id::type last)
+      {
+        current = ptimers[last].next;
+        return current;
+      }
+
+      //*******************************
+      void clear()
+      {
+        tpn::timer::id::type id = begin();
+
+        while (id != tpn::timer::id::NO_TIMER)
+        {
+          TTimerData& timer = ptimers[id];
+          id = next(id);
+          timer.next = tpn::timer::id::NO_TIMER;
+        }
+
+        head    = tpn::timer::id::NO_TIMER;
+        tail    = tpn::timer::id::NO_TIMER;
+        current = tpn::timer::id::NO_TIMER;
+      }
+
+    private:
+
+      tpn::timer::id::type head;
+      tpn::timer::id::type tail;
+      tpn::timer::id::type current;
+
+      TTimerData* const ptimers;
+    };
+  };
+
+  //***************************************************************************
+  /// Keeps the active timers in a hierarchical timing wheel.
+  /// Each level has 2^SLOT_BITS slots and each slot is an intrusive list.
+  /// Start and stop are O(1). Tick is O(1) per expired timer, plus a
+  /// cascade of one slot per level each time a lower level wraps.
+  ///
+  /// While a timer is active, 'delta' holds its absolute expiry time,
+  /// modulo 2^31. Delays are therefore limited to 2^31 - 1 ticks; longer
+  /// periods are clamped.
+  /// Timers that expire on the same tick are not guaranteed to be called
+  /// in the same order as with tpn::timer_delta_list.
+  //***************************************************************************
+  template <size_t SLOT_BITS = 6U>
+  struct timer_wheel
+  {
+    TYPHOON_STATIC_ASSERT((SLOT_BITS >= 1U) && (SLOT_BITS <= 8U), "SLOT_BITS must be between 1 and 8");
+
+    template <typename TTimerData>
+    class list
+    {
+    public:
+
+      static TYPHOON_CONSTANT uint32_t TIME_BITS = 31U;
+      static TYPHOON_CONSTANT uint32_t TIME_MASK = 0x7FFFFFFFUL;
+      static TYPHOON_CONSTANT uint32_t SLOTS     = 1UL << SLOT_BITS;
+      static TYPHOON_CONSTANT uint32_t SLOT_MASK = SLOTS - 1U;
+      static TYPHOON_CONSTANT uint32_t LEVELS    = (TIME_BITS + SLOT_BITS - 1U) / SLOT_BITS;
+      static TYPHOON_CONSTANT uint32_t MAX_DELAY = TIME_MASK;
+
+      //*******************************
+      list(TTimerData* ptimers_)
+        : now(0U)
+        , active(0U)
+        , ptimers(ptimers_)
+      {
+        reset();
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return active == 0U;
+      }
+
+      //*******************************
+      /// Inserts the timer in the slot for its expiry time.
+      /// 'delta' holds the delay on entry and the expiry time on exit.
+      //*******************************
+      void insert(tpn::timer::id::type id_)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        uint32_t delay = (timer.delta > MAX_DELAY) ? MAX_DELAY : timer.delta;
+
+        timer.delta = (now + delay) & TIME_MASK;
+        place(id_, delay);
+        ++active;
+      }
+
+      //*******************************
+      /// Unlinks the timer from its slot.
+      /// The slot is found from the expiry time, so no search is needed.
+      //*******************************
+      void remove(tpn::timer::id::type id_, bool /*has_expired*/)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        if (timer.previous != tpn::timer::id::NO_TIMER)
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+        else
+        {
+          // It's the head of a slot. Find which one.
+          for (uint32_t level = 0U; level < LEVELS; ++level)
+          {
+            const uint32_t slot = slot_of(timer.delta, level);
+
+            if (heads[level][slot] == id_)
+            {
+              heads[level][slot] = timer.next;
+
+              if ((level == 0U) && (timer.next == tpn::timer::id::NO_TIMER))
+              {
+                clear_occupied(slot);
+              }
+              break;
+            }
+          }
+        }
+
+        if (timer.next != tpn::timer::id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        timer.previous = tpn::timer::id::NO_TIMER;
+        timer.next     = tpn::timer::id::NO_TIMER;
+        timer.delta    = tpn::timer::state::INACTIVE;
+        --active;
+      }
+
+      //*******************************
+      /// Advances the wheel by up to 'count' ticks, stopping as soon as
+      /// a timer expires. Returns the expired timer, already removed, or
+      /// NO_TIMER once 'count' has been used up.
+      /// Empty runs of level 0 slots are skipped using the occupancy bitmap.
+      //*******************************
+      tpn::timer::id::type next_expired(uint32_t& count)
+      {
+        for (;;)
+        {
+          const uint32_t slot = now & SLOT_MASK;
+
+          tpn::timer::id::type id = heads[0][slot];
+
+          if (id != tpn::timer::id::NO_TIMER)
+          {
+            remove(id, true);
+            return id;
+          }
+
+          uint32_t step = count;
+
+          if (active != 0U)
+          {
+            step = distance_to_next_slot(slot);
+          }
+
+          if (step > count)
+          {
+            step = count;
+          }
+
+          now    = (now + step) & TIME_MASK;
+          count -= step;
+
+          if (step == 0U)
+          {
+            return tpn::timer::id::NO_TIMER;
+          }
+
+          if ((now & SLOT_MASK) == 0U)
+          {
+            cascade();
+          }
+        }
+      }
+
+      //*******************************
+      void clear()
+      {
+        for (uint32_t level = 0U; level < LEVELS; ++level)
+        {
+          for (uint32_t slot = 0U; slot < SLOTS; ++slot)
+          {
+            tpn::timer::id::type id = heads[level][slot];
+
+            while (id != tpn::timer::id::NO_TIMER)
+            {
+              TTimerData& timer = ptimers[id];
+              id = timer.next;
+              timer.previous = tpn::timer::id::NO_TIMER;
+              timer.next     = tpn::timer::id::NO_TIMER;
+            }
+          }
+        }
+
+        reset();
+      }
+
+    private:
+
+      static TYPHOON_CONSTANT uint32_t BITMAP_WORDS = (SLOTS + 31U) / 32U;
+
+      //*******************************
+      static uint32_t slot_of(uint32_t expiry, uint32_t level)
+      {
+        return (expiry >> (level * SLOT_BITS)) & SLOT_MASK;
+      }
+
+      //*******************************
+      /// The lowest level whose span covers the delay.
+      //*******************************
+      static uint32_t level_of(uint32_t delay)
+      {
+        uint32_t level = 0U;
+
+        while ((level < (LEVELS - 1U)) && ((delay >> ((level + 1U) * SLOT_BITS)) != 0U))
+        {
+          ++level;
+        }
+
+        return level;
+      }
+
+      //*******************************
+      /// Pushes the timer on to the front of the slot for its expiry.
+      //*******************************
+      void place(tpn::timer::id::type id_, uint32_t delay)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        const uint32_t level = level_of(delay);
+        const uint32_t slot  = slot_of(timer.delta, level);
+
+        tpn::timer::id::type& head = heads[level][slot];
+
+        timer.previous = tpn::timer::id::NO_TIMER;
+        timer.next     = head;
+
+        if (head != tpn::timer::id::NO_TIMER)
+        {
+          ptimers[head].previous = id_;
+        }
+
+        head = id_;
+
+        if (level == 0U)
+        {
+          set_occupied(slot);
+        }
+      }
+
+      //*******************************
+      /// Called when level 0 wraps. Redistributes the current slot of each
+      /// higher level whose lower levels have all wrapped.
+      //*******************************
+      void cascade()
+      {
+        for (uint32_t level = 1U; level < LEVELS; ++level)
+        {
+          const uint32_t slot = slot_of(now, level);
+
+          tpn::timer::id::type id = heads[level][slot];
+          heads[level][slot] = tpn::timer::id::NO_TIMER;
+
+          while (id != tpn::timer::id::NO_TIMER)
+          {
+            const tpn::timer::id::type next_id = ptimers[id].next;
+
+            place(id, (ptimers[id].delta - now) & TIME_MASK);
+            id = next_id;
+          }
+
+          if (slot != 0U)
+          {
+            break;
+          }
+        }
+      }
+
+      //*******************************
+      /// The number of ticks to the next occupied level 0 slot, or to the
+      /// point where level 0 wraps, whichever is nearer.
+      //*******************************
+      uint32_t distance_to_next_slot(uint32_t slot) const
+      {
+        uint32_t start = slot + 1U;
+
+        if (start < SLOTS)
+        {
+          uint32_t word = start / 32U;
+          uint32_t bits = occupied[word] & (~uint32_t(0U) << (start % 32U));
+
+          while ((bits == 0U) && (++word < BITMAP_WORDS))
+          {
+            bits = occupied[word];
+          }
+
+          if (bits != 0U)
+          {
+            return ((word * 32U) + tpn::count_trailing_zeros(bits)) - slot;
+          }
+        }
+
+        return SLOTS - slot;
+      }
+
+      //*******************************
+      void set_occupied(uint32_t slot)
+      {
+        occupied[slot / 32U] |= (uint32_t(1U) << (slot % 32U));
+      }
+
+      //*******************************
+      void clear_occupied(uint32_t slot)
+      {
+        occupied[slot / 32U] &= ~(uint32_t(1U) << (slot % 32U));
+      }
+
+      //*******************************
+      void reset()
+      {
+        for (uint32_t level = 0U; level < LEVELS; ++level)
+        {
+          for (uint32_t slot = 0U; slot < SLOTS; ++slot)
+          {
+            heads[level][slot] = tpn::timer::id::NO_TIMER;
+          }
+        }
+
+        for (uint32_t word = 0U; word < BITMAP_WORDS; ++word)
+        {
+          occupied[word] = 0U;
+        }
+
+        active = 0U;
+      }
+
+      tpn::timer::id::type heads[LEVELS][SLOTS];
+      uint32_t             occupied[BITMAP_WORDS];
+      uint32_t             now;
+      uint_least16_t       active;
+
+      TTimerData* const ptimers;
+    };
+  };
+}
+
+#endif
@@ -32,6 +32,7 @@ SOFTWARE.
 #define TYPHOON_UTILITY_HPP
 
 #include "platform.hpp"
+#include "static_assert.hpp"
 #include "type_traits.hpp"
 
 #if defined(TYPHOON_IN_UNIT_TEST) || TYPHOON_USING_STL
@@ -536,6 +537,32 @@ namespace tpn
   inline constexpr in_place_index_t<I> in_place_index{};
 #endif
 
+  //***************************************************************************
+  /// Tags for range inserts into the flat containers, promising that the
+  /// range is already sorted by key.
+  /// sorted_unique also promises that no key is repeated.
+  //***************************************************************************
+
+  //*************************
+  struct sorted_unique_t
+  {
+    explicit TYPHOON_CONSTEXPR sorted_unique_t() {}
+  };
+
+#if TYPHOON_USING_CPP17
+  inline constexpr sorted_unique_t sorted_unique{};
+#endif
+
+  //*************************
+  struct sorted_equivalent_t
+  {
+    explicit TYPHOON_CONSTEXPR sorted_equivalent_t() {}
+  };
+
+#if TYPHOON_USING_CPP17
+  inline constexpr sorted_equivalent_t sorted_equivalent{};
+#endif
+
 #if TYPHOON_USING_CPP11
   //*************************************************************************
   /// A function wrapper for free/global functions.
@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.hpp"
 #include "functional.hpp"
 #include "type_traits.hpp"
+#include "span.hpp"
+#include "private/statistics.hpp"
 
 #include <math.h>
 #include <stdint.h>
@@ -118,9 +120,30 @@ namespace tpn
     //*********************************
     void add(TInput value)
     {
-      sum_of_squares += TCalc(value * value);
-      sum            += TCalc(value);
-      ++counter;
+      accumulator.add(value);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Add a contiguous block of values.
+    /// Floating point values are summed a vector at a time.
+    //*********************************
+    void add(tpn::span<const TInput> values)
+    {
+      if (!values.empty())
+      {
+        accumulator.add(values.data(), values.size());
+        recalculate = true;
+      }
+    }
+
+    //*********************************
+    /// Add the values from another variance,
+    /// as if they had been added to this one.
+    //*********************************
+    void merge(const variance& other)
+    {
+      accumulator.merge(other.accumulator);
       recalculate = true;
     }
 
@@ -165,14 +188,9 @@ namespace tpn
       {
         variance_value = 0.0;
 
-        if (counter != 0)
+        if (accumulator.counter != 0)
         {
-          double n = double(counter);
-          double adjustment = 1.0 / (n * (n - Adjustment)) ;
-
-          double square_of_sum = sum * sum;
-
-          variance_value = (n * sum_of_squares - square_of_sum) * adjustment;
+          variance_value = accumulator.variance(Adjustment);
         }
 
         recalculate = false;
@@ -194,7 +212,7 @@ namespace tpn
     //*********************************
     size_t count() const
     {
-      return size_t(counter);
+      return size_t(accumulator.counter);
     }
 
     //*********************************
@@ -202,18 +220,14 @@ namespace tpn
     //*********************************
     void clear()
     {
-      sum_of_squares = calc_t(0);
-      sum            = calc_t(0);
-      counter        = 0U;
+      accumulator.clear();
       variance_value = 0.0;
       recalculate    = true;
     }
 
   private:
   
-    calc_t   sum_of_squares;
-    calc_t   sum;
-    uint32_t counter;
+    private_statistics::moments<calc_t> accumulator;
     mutable double variance_value;
     mutable bool   recalculate;
   };
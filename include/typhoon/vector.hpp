@@ -221,6 +221,13 @@ namespace tpn
     //*********************************************************************
     void resize(size_t new_size, const_reference value)
     {
+      const_pointer p_value = tpn::addressof(value);
+
+      if (new_size > size())
+      {
+        make_room(new_size - size(), p_value);
+      }
+
       TYPHOON_ASSERT(new_size <= CAPACITY, TYPHOON_ERROR(vector_full));
 
       const size_t current_size = size();
@@ -228,7 +235,7 @@ namespace tpn
 
       if (current_size < new_size)
       {
-        tpn::uninitialized_fill_n(p_end, delta, value);
+        tpn::uninitialized_fill_n(p_end, delta, *p_value);
         TYPHOON_ADD_DEBUG_COUNT(delta)
       }
       else
@@ -246,6 +253,11 @@ namespace tpn
     //*********************************************************************
     void uninitialized_resize(size_t new_size)
     {
+      if (new_size > size())
+      {
+        make_room(new_size - size());
+      }
+
       TYPHOON_ASSERT(new_size <= CAPACITY, TYPHOON_ERROR(vector_full));
 
 #if defined(TYPHOON_DEBUG_COUNT)
@@ -263,11 +275,16 @@ namespace tpn
     }
 
     //*********************************************************************
-    /// Does nothing.
+    /// Grows the buffer to hold at least 'n' elements, if the vector is able
+    /// to grow. Otherwise does nothing.
     /// For compatibility with the STL vector API.
     //*********************************************************************
-    void reserve(size_t)
+    void reserve(size_t n)
     {
+      if (n > size())
+      {
+        make_room(n - size());
+      }
     }
 
     //*********************************************************************
@@ -381,12 +398,24 @@ namespace tpn
     {
       TYPHOON_STATIC_ASSERT((tpn::is_same<typename tpn::remove_cv<T>::type, typename tpn::remove_cv<typename tpn::iterator_traits<TIterator>::value_type>::type>::value), "Iterator type does not match container type");
 
+#if TYPHOON_HAS_IVECTOR_GROWTH
+      // Cleared first, so that growing has no elements to relocate.
+      initialise();
+
+      if (p_grow != TYPHOON_NULLPTR)
+      {
+        make_room(size_t(tpn::distance(first, last)));
+      }
+#endif
+
 #if TYPHOON_IS_DEBUG_BUILD
       difference_type d = tpn::distance(first, last);
       TYPHOON_ASSERT(static_cast<size_t>(d) <= CAPACITY, TYPHOON_ERROR(vector_full));
 #endif
 
+#if !TYPHOON_HAS_IVECTOR_GROWTH
       initialise();
+#endif
 
       p_end = tpn::uninitialized_copy(first, last, p_buffer);
       TYPHOON_ADD_DEBUG_COUNT(uint32_t(tpn::distance(first, last)))
@@ -400,9 +429,17 @@ namespace tpn
     //*********************************************************************
     void assign(size_t n, parameter_t value)
     {
+#if TYPHOON_HAS_IVECTOR_GROWTH
+      // Cleared first, so that growing has no elements to relocate.
+      initialise();
+      make_room(n);
+
+      TYPHOON_ASSERT(n <= CAPACITY, TYPHOON_ERROR(vector_full));
+#else
       TYPHOON_ASSERT(n <= CAPACITY, TYPHOON_ERROR(vector_full));
 
       initialise();
+#endif
 
       p_end = tpn::uninitialized_fill_n(p_buffer, n, value);
       TYPHOON_ADD_DEBUG_COUNT(uint32_t(n))
@@ -431,10 +468,13 @@ namespace tpn
     //*********************************************************************
     void push_back(const_reference value)
     {
+      const_pointer p_value = tpn::addressof(value);
+      make_room(1U, p_value);
+
 #if defined(TYPHOON_CHECK_PUSH_POP)
       TYPHOON_ASSERT(size() != CAPACITY, TYPHOON_ERROR(vector_full));
 #endif
-      create_back(value);
+      create_back(*p_value);
     }
 
 #if TYPHOON_USING_CPP11
@@ -445,10 +485,13 @@ namespace tpn
     //*********************************************************************
     void push_back(rvalue_reference value)
     {
+      pointer p_value = tpn::addressof(value);
+      make_room(1U, p_value);
+
 #if defined(TYPHOON_CHECK_PUSH_POP)
       TYPHOON_ASSERT(size() != CAPACITY, TYPHOON_ERROR(vector_full));
 #endif
-      create_back(tpn::move(value));
+      create_back(tpn::move(*p_value));
     }
 #endif
 
@@ -461,6 +504,8 @@ namespace tpn
     template <typename ... Args>
     void emplace_back(Args && ... args)
     {
+      make_room(1U);
+
 #if defined(TYPHOON_CHECK_PUSH_POP)
       TYPHOON_ASSERT(size() != CAPACITY, TYPHOON_ERROR(vector_full));
 #endif
@@ -477,6 +522,8 @@ namespace tpn
     template <typename T1>
     void emplace_back(const T1& value1)
     {
+      make_room(1U);
+
 #if defined(TYPHOON_CHECK_PUSH_POP)
       TYPHOON_ASSERT(size() != CAPACITY, TYPHOON_ERROR(vector_full));
 #endif
@@ -493,6 +540,8 @@ namespace tpn
     template <typename T1, typename T2>
     void emplace_back(const T1& value1, const T2& value2)
     {
+      make_room(1U);
+
 #if defined(TYPHOON_CHECK_PUSH_POP)
       TYPHOON_ASSERT(size() != CAPACITY, TYPHOON_ERROR(vector_full));
 #endif
@@ -509,6 +558,8 @@ namespace tpn
     template <typename T1, typename T2, typename T3>
     void emplace_back(const T1& value1, const T2& value2, const T3& value3)
     {
+      make_room(1U);
+
 #if defined(TYPHOON_CHECK_PUSH_POP)
       TYPHOON_ASSERT(size() != CAPACITY, TYPHOON_ERROR(vector_full));
 #endif
@@ -525,6 +576,8 @@ namespace tpn
     template <typename T1, typename T2, typename T3, typename T4>
     void emplace_back(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      make_room(1U);
+
 #if defined(TYPHOON_CHECK_PUSH_POP)
       TYPHOON_ASSERT(size() != CAPACITY, TYPHOON_ERROR(vector_full));
 #endif
@@ -554,19 +607,23 @@ namespace tpn
     //*********************************************************************
     iterator insert(const_iterator position, const_reference value)
     {
+      const size_t  index   = size_t(tpn::distance(cbegin(), position));
+      const_pointer p_value = tpn::addressof(value);
+      make_room(1U, p_value);
+
       TYPHOON_ASSERT(size() != CAPACITY, TYPHOON_ERROR(vector_full));
 
-      iterator position_ = to_iterator(position);
+      iterator position_ = p_buffer + index;
 
       if (position_ == end())
       {
-        create_back(value);
+        create_back(*p_value);
       }
       else
       {
         create_back(back());
         tpn::move_backward(position_, p_end - 2, p_end - 1);
-        *position_ = value;
+        *position_ = *p_value;
       }
 
       return position_;
@@ -581,19 +638,23 @@ namespace tpn
     //*********************************************************************
     iterator insert(const_iterator position, rvalue_reference value)
     {
+      const size_t index   = size_t(tpn::distance(cbegin(), position));
+      pointer      p_value = tpn::addressof(value);
+      make_room(1U, p_value);
+
       TYPHOON_ASSERT(size() != CAPACITY, TYPHOON_ERROR(vector_full));
 
-      iterator position_ = to_iterator(position);
+      iterator position_ = p_buffer + index;
 
       if (position_ == end())
       {
-        create_back(tpn::move(value));
+        create_back(tpn::move(*p_value));
       }
       else
       {
         create_back(tpn::move(back()));
         tpn::move_backward(position_, p_end - 2, p_end - 1);
-        *position_ = tpn::move(value);
+        *position_ = tpn::move(*p_value);
       }
 
       return position_;
@@ -607,9 +668,12 @@ namespace tpn
     template <typename ... Args>
     iterator emplace(const_iterator position, Args && ... args)
     {
+      const size_t index = size_t(tpn::distance(cbegin(), position));
+      make_room(1U);
+
       TYPHOON_ASSERT(!full(), TYPHOON_ERROR(vector_full));
 
-      iterator position_ = to_iterator(position);
+      iterator position_ = p_buffer + index;
 
       void* p;
 
@@ -634,9 +698,12 @@ namespace tpn
     template <typename T1>
     iterator emplace(const_iterator position, const T1& value1)
     {
+      const size_t index = size_t(tpn::distance(cbegin(), position));
+      make_room(1U);
+
       TYPHOON_ASSERT(!full(), TYPHOON_ERROR(vector_full));
 
-      iterator position_ = to_iterator(position);
+      iterator position_ = p_buffer + index;
 
       void* p;
 
@@ -661,9 +728,12 @@ namespace tpn
     template <typename T1, typename T2>
     iterator emplace(const_iterator position, const T1& value1, const T2& value2)
     {
+      const size_t index = size_t(tpn::distance(cbegin(), position));
+      make_room(1U);
+
       TYPHOON_ASSERT(!full(), TYPHOON_ERROR(vector_full));
 
-      iterator position_ = to_iterator(position);
+      iterator position_ = p_buffer + index;
 
       void* p;
 
@@ -688,9 +758,12 @@ namespace tpn
     template <typename T1, typename T2, typename T3>
     iterator emplace(const_iterator position, const T1& value1, const T2& value2, const T3& value3)
     {
+      const size_t index = size_t(tpn::distance(cbegin(), position));
+      make_room(1U);
+
       TYPHOON_ASSERT(!full(), TYPHOON_ERROR(vector_full));
 
-      iterator position_ = to_iterator(position);
+      iterator position_ = p_buffer + index;
 
       void* p;
 
@@ -715,9 +788,12 @@ namespace tpn
     template <typename T1, typename T2, typename T3, typename T4>
     iterator emplace(const_iterator position, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      const size_t index = size_t(tpn::distance(cbegin(), position));
+      make_room(1U);
+
       TYPHOON_ASSERT(!full(), TYPHOON_ERROR(vector_full));
 
-      iterator position_ = to_iterator(position);
+      iterator position_ = p_buffer + index;
 
       void* p;
 
@@ -749,9 +825,12 @@ namespace tpn
     //*********************************************************************
     void insert(const_iterator position, size_t n, parameter_t value)
     {
+      const size_t index = size_t(tpn::distance(cbegin(), position));
+      make_room(n);
+
       TYPHOON_ASSERT((size() + n) <= CAPACITY, TYPHOON_ERROR(vector_full));
 
-      iterator position_ = to_iterator(position);
+      iterator position_ = p_buffer + index;
 
       size_t insert_n = n;
       size_t insert_begin = tpn::distance(begin(), position_);
@@ -807,11 +886,13 @@ namespace tpn
     void insert(const_iterator position, TIterator first, TIterator last, typename tpn::enable_if<!tpn::is_integral<TIterator>::value, int>::type = 0)
     {
       size_t count = tpn::distance(first, last);
+      size_t insert_begin = tpn::distance(cbegin(), position);
+
+      make_room(count);
 
       TYPHOON_ASSERT((size() + count) <= CAPACITY, TYPHOON_ERROR(vector_full));
 
       size_t insert_n = count;
-      size_t insert_begin = tpn::distance(cbegin(), position);
       size_t insert_end = insert_begin + insert_n;
 
       // Move old data.
@@ -999,9 +1080,32 @@ namespace tpn
       : vector_base(MAX_SIZE)
       , p_buffer(p_buffer_)
       , p_end(p_buffer_)
+#if TYPHOON_HAS_IVECTOR_GROWTH
+      , p_grow(TYPHOON_NULLPTR)
+#endif
     {
     }
 
+#if TYPHOON_HAS_IVECTOR_GROWTH
+    //*********************************************************************
+    /// Moves the elements to a larger buffer so that at least 'required'
+    /// elements fit, updating p_buffer, p_end and CAPACITY.
+    /// Leaves the vector unchanged if it cannot.
+    //*********************************************************************
+    typedef void (*grow_function_t)(ivector& vector, size_t required);
+
+    //*********************************************************************
+    /// Constructor, for a vector that can grow.
+    //*********************************************************************
+    ivector(T* p_buffer_, size_t MAX_SIZE, grow_function_t p_grow_)
+      : vector_base(MAX_SIZE)
+      , p_buffer(p_buffer_)
+      , p_end(p_buffer_)
+      , p_grow(p_grow_)
+    {
+    }
+#endif
+
     //*********************************************************************
     /// Initialise the vector.
     //*********************************************************************
@@ -1025,9 +1129,55 @@ namespace tpn
 
     pointer p_buffer; ///< Pointer to the start of the buffer.
     pointer p_end;    ///< Pointer to one past the last element in the buffer.
+#if TYPHOON_HAS_IVECTOR_GROWTH
+    grow_function_t p_grow; ///< Grows the buffer when full. Null for a fixed capacity.
+#endif
 
   private:
 
+    //*********************************************************************
+    /// Grows the buffer, if the vector is able to, so that 'n' more elements
+    /// fit. A fixed capacity vector is left as it is, for the caller's
+    /// vector_full check to report.
+    //*********************************************************************
+    void make_room(size_t n)
+    {
+#if TYPHOON_HAS_IVECTOR_GROWTH
+      if (((size() + n) > CAPACITY) && (p_grow != TYPHOON_NULLPTR))
+      {
+        p_grow(*this, size() + n);
+      }
+#else
+      (void)n;
+#endif
+    }
+
+    //*********************************************************************
+    /// As make_room(n), keeping 'p_value' pointing at the same element if it
+    /// refers to one in this vector, such as in v.push_back(v[0]).
+    //*********************************************************************
+    template <typename TPointer>
+    void make_room(size_t n, TPointer& p_value)
+    {
+#if TYPHOON_HAS_IVECTOR_GROWTH
+      if (((size() + n) > CAPACITY) && (p_grow != TYPHOON_NULLPTR))
+      {
+        const bool   is_element = (p_value >= p_buffer) && (p_value < p_end);
+        const size_t index      = is_element ? size_t(p_value - p_buffer) : 0U;
+
+        p_grow(*this, size() + n);
+
+        if (is_element)
+        {
+          p_value = p_buffer + index;
+        }
+      }
+#else
+      (void)n;
+      (void)p_value;
+#endif
+    }
+
     //*********************************************************************
     /// Create a new element with a default value at the back.
     //*********************************************************************
@@ -0,0 +1,214 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/TYPHOONCPP/tpn
+https://www.tpncpp.com
+
+Copyright(c) 2014 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef TYPHOON_WYHASH_HPP
+#define TYPHOON_WYHASH_HPP
+
+#include "platform.hpp"
+#include "unaligned_type.hpp"
+
+#include <stdint.h>
+#include <stddef.h>
+
+///\defgroup wyhash wyhash hash calculations
+///\ingroup maths
+
+#if TYPHOON_USING_64BIT_TYPES
+
+namespace tpn
+{
+  namespace private_wyhash
+  {
+    //*************************************************************************
+    /// The default secret.
+    //*************************************************************************
+    static const uint64_t secret[4] = { 0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL, 0x4B33A62ED433D4A3ULL, 0x4D5A2DA51DE1AA47ULL };
+
+    //*************************************************************************
+    /// The 128 bit product of a and b, low half in a, high half in b.
+    //*************************************************************************
+    inline void multiply(uint64_t& a, uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+      const unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+
+      a = static_cast<uint64_t>(r);
+      b = static_cast<uint64_t>(r >> 64U);
+#else
+      const uint64_t ha = a >> 32U;
+      const uint64_t hb = b >> 32U;
+      const uint64_t la = static_cast<uint32_t>(a);
+      const uint64_t lb = static_cast<uint32_t>(b);
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+
+      const uint64_t t  = rl + (rm0 << 32U);
+      uint64_t       c  = (t < rl) ? 1U : 0U;
+      const uint64_t lo = t + (rm1 << 32U);
+      c += (lo < t) ? 1U : 0U;
+
+      a = lo;
+      b = rh + (rm0 >> 32U) + (rm1 >> 32U) + c;
+#endif
+    }
+
+    //*************************************************************************
+    /// Folds the 128 bit product of a and b.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      multiply(a, b);
+
+      return a ^ b;
+    }
+
+    //*************************************************************************
+    /// Little endian loads from any alignment.
+    //*************************************************************************
+    inline uint64_t read_64(const uint8_t* p)
+    {
+      return *reinterpret_cast<const tpn::le_uint64_t*>(p);
+    }
+
+    inline uint64_t read_32(const uint8_t* p)
+    {
+      return static_cast<uint32_t>(*reinterpret_cast<const tpn::le_uint32_t*>(p));
+    }
+
+    //*************************************************************************
+    /// The first, middle and last of 1 to 3 bytes.
+    //*************************************************************************
+    inline uint64_t read_small(const uint8_t* p, size_t length)
+    {
+      return (uint64_t(p[0]) << 16U) | (uint64_t(p[length >> 1U]) << 8U) | uint64_t(p[length - 1U]);
+    }
+  }
+
+  //***************************************************************************
+  /// Calculates the 64 bit wyhash (final version 4) of a block of bytes.
+  /// See https://github.com/wangyi-fudan/wyhash for more details.
+  /// Keys of up to 16 bytes are read as two overlapping words. Longer keys are
+  /// read 16 bytes at a time, in three independent lanes of 48 bytes once
+  /// they are longer than 48 bytes, so that there are three multiplies in
+  /// flight rather than one multiply per byte.
+  ///\ingroup wyhash
+  //***************************************************************************
+  inline uint64_t wyhash_64(const uint8_t* begin, const uint8_t* end, uint64_t seed = 0U)
+  {
+    using private_wyhash::secret;
+    using private_wyhash::mix;
+    using private_wyhash::read_64;
+    using private_wyhash::read_32;
+
+    const uint8_t* p      = begin;
+    const size_t   length = static_cast<size_t>(end - begin);
+
+    seed ^= mix(seed ^ secret[0], secret[1]);
+
+    uint64_t a;
+    uint64_t b;
+
+    if (length <= 16U)
+    {
+      if (length >= 4U)
+      {
+        const size_t offset = (length >> 3U) << 2U;
+
+        a = (read_32(p) << 32U) | read_32(p + offset);
+        b = (read_32(p + length - 4U) << 32U) | read_32(p + length - 4U - offset);
+      }
+      else if (length > 0U)
+      {
+        a = private_wyhash::read_small(p, length);
+        b = 0U;
+      }
+      else
+      {
+        a = 0U;
+        b = 0U;
+      }
+    }
+    else
+    {
+      size_t remaining = length;
+
+      if (remaining > 48U)
+      {
+        uint64_t seed1 = seed;
+        uint64_t seed2 = seed;
+
+        do
+        {
+          seed  = mix(read_64(p)      ^ secret[1], read_64(p + 8U)  ^ seed);
+          seed1 = mix(read_64(p + 16U) ^ secret[2], read_64(p + 24U) ^ seed1);
+          seed2 = mix(read_64(p + 32U) ^ secret[3], read_64(p + 40U) ^ seed2);
+          p         += 48U;
+          remaining -= 48U;
+        } while (remaining > 48U);
+
+        seed ^= seed1 ^ seed2;
+      }
+
+      while (remaining > 16U)
+      {
+        seed = mix(read_64(p) ^ secret[1], read_64(p + 8U) ^ seed);
+        p         += 16U;
+        remaining -= 16U;
+      }
+
+      a = read_64(p + remaining - 16U);
+      b = read_64(p + remaining - 8U);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    private_wyhash::multiply(a, b);
+
+    return mix(a ^ secret[0] ^ length, b ^ secret[1]);
+  }
+
+  //***************************************************************************
+  /// Calculates a 32 bit hash of a block of bytes by folding the 64 bit
+  /// wyhash.
+  ///\ingroup wyhash
+  //***************************************************************************
+  inline uint32_t wyhash_32(const uint8_t* begin, const uint8_t* end, uint64_t seed = 0U)
+  {
+    const uint64_t h = wyhash_64(begin, end, seed);
+
+    return static_cast<uint32_t>(h ^ (h >> 32U));
+  }
+}
+
+#endif
+#endif
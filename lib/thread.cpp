@@ -0,0 +1,293 @@
+//
+// Copyright (c) 2016-2019 Jin (jaehwanspin@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/hyper-level-nerds/typhoon
+//
+
+#include <typhoon/thread.hpp>
+
+#if defined(TYPHOON_THREAD_POSIX)
+    #include <errno.h>
+    #include <sched.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
+namespace tpn {
+
+#if defined(TYPHOON_THREAD_ZEPHYR)
+
+//
+// Zephyr
+//
+
+void ithread::entry(void* self, void*, void*)
+{
+    ithread* t = static_cast<ithread*>(self);
+
+    t->function_();
+    t->function_.reset();
+}
+
+void ithread::start_native()
+{
+    ::k_thread_create(&thread_,
+                      static_cast<k_thread_stack_t*>(stack_),
+                      stack_size_,
+                      &ithread::entry,
+                      this, nullptr, nullptr,
+                      priority_,
+                      0,
+                      K_NO_WAIT);
+
+    joinable_ = true;
+}
+
+void ithread::join()
+{
+    if (joinable_)
+    {
+        ::k_thread_join(&thread_, K_FOREVER);
+        joinable_ = false;
+    }
+}
+
+void ithread::detach()
+{
+    // Zephyr threads need no reaping.
+    joinable_ = false;
+}
+
+ithread::id ithread::get_id() const noexcept
+{
+    return id(const_cast<k_tid_t>(&thread_));
+}
+
+ithread::native_handle_type ithread::native_handle() noexcept
+{
+    return &thread_;
+}
+
+counting_semaphore::counting_semaphore(uint32_t initial) noexcept
+{
+    ::k_sem_init(&sem_, initial, K_SEM_MAX_LIMIT);
+}
+
+counting_semaphore::~counting_semaphore()
+{
+}
+
+void counting_semaphore::release(uint32_t n)
+{
+    while (n-- != 0U)
+    {
+        ::k_sem_give(&sem_);
+    }
+}
+
+void counting_semaphore::acquire()
+{
+    ::k_sem_take(&sem_, K_FOREVER);
+}
+
+bool counting_semaphore::try_acquire()
+{
+    return ::k_sem_take(&sem_, K_NO_WAIT) == 0;
+}
+
+bool counting_semaphore::try_acquire_for_ms(uint32_t ms)
+{
+    return ::k_sem_take(&sem_, K_MSEC(ms)) == 0;
+}
+
+namespace this_thread {
+
+    ithread::id get_id() noexcept
+    {
+        return ithread::id(::k_current_get());
+    }
+
+    void yield() noexcept
+    {
+        ::k_yield();
+    }
+
+    void sleep_for_ms(uint32_t ms) noexcept
+    {
+        ::k_msleep(static_cast<int32_t>(ms));
+    }
+
+}
+
+uint64_t uptime_us() noexcept
+{
+    return ::k_ticks_to_us_floor64(::k_uptime_ticks());
+}
+
+#else
+
+//
+// POSIX
+//
+
+void* ithread::entry(void* self)
+{
+    ithread* t = static_cast<ithread*>(self);
+
+    t->function_();
+    t->function_.reset();
+
+    return nullptr;
+}
+
+void ithread::start_native()
+{
+    // The C library keeps thread local storage at the top of the stack, so
+    // a small embedded stack may not be enough. Fall back to a stack of the
+    // library's own if it is too small or is rejected.
+    const long minimum = ::sysconf(_SC_THREAD_STACK_MIN);
+
+    if ((minimum > 0) && (stack_size_ >= static_cast<size_t>(minimum)))
+    {
+        pthread_attr_t attr;
+        ::pthread_attr_init(&attr);
+        ::pthread_attr_setstack(&attr, stack_, stack_size_);
+
+        joinable_ = (::pthread_create(&thread_, &attr, &ithread::entry, this) == 0);
+
+        ::pthread_attr_destroy(&attr);
+    }
+
+    if (!joinable_)
+    {
+        joinable_ = (::pthread_create(&thread_, nullptr, &ithread::entry, this) == 0);
+    }
+}
+
+void ithread::join()
+{
+    if (joinable_)
+    {
+        ::pthread_join(thread_, nullptr);
+        joinable_ = false;
+    }
+}
+
+void ithread::detach()
+{
+    if (joinable_)
+    {
+        ::pthread_detach(thread_);
+        joinable_ = false;
+    }
+}
+
+ithread::id ithread::get_id() const noexcept
+{
+    return id(thread_);
+}
+
+ithread::native_handle_type ithread::native_handle() noexcept
+{
+    return thread_;
+}
+
+counting_semaphore::counting_semaphore(uint32_t initial) noexcept
+{
+    ::sem_init(&sem_, 0, initial);
+}
+
+counting_semaphore::~counting_semaphore()
+{
+    ::sem_destroy(&sem_);
+}
+
+void counting_semaphore::release(uint32_t n)
+{
+    while (n-- != 0U)
+    {
+        ::sem_post(&sem_);
+    }
+}
+
+void counting_semaphore::acquire()
+{
+    // Retry if interrupted by a signal.
+    while (::sem_wait(&sem_) != 0)
+    {
+    }
+}
+
+bool counting_semaphore::try_acquire()
+{
+    return ::sem_trywait(&sem_) == 0;
+}
+
+bool counting_semaphore::try_acquire_for_ms(uint32_t ms)
+{
+    // sem_timedwait takes an absolute time on the realtime clock.
+    struct timespec ts;
+    ::clock_gettime(CLOCK_REALTIME, &ts);
+
+    ts.tv_sec  += static_cast<time_t>(ms / 1000U);
+    ts.tv_nsec += static_cast<long>((ms % 1000U) * 1000000UL);
+
+    if (ts.tv_nsec >= 1000000000L)
+    {
+        ts.tv_sec  += 1;
+        ts.tv_nsec -= 1000000000L;
+    }
+
+    for (;;)
+    {
+        if (::sem_timedwait(&sem_, &ts) == 0)
+        {
+            return true;
+        }
+
+        if (errno != EINTR)
+        {
+            return false;
+        }
+    }
+}
+
+namespace this_thread {
+
+    ithread::id get_id() noexcept
+    {
+        return ithread::id(::pthread_self());
+    }
+
+    void yield() noexcept
+    {
+        ::sched_yield();
+    }
+
+    void sleep_for_ms(uint32_t ms) noexcept
+    {
+        struct timespec ts;
+        ts.tv_sec  = static_cast<time_t>(ms / 1000U);
+        ts.tv_nsec = static_cast<long>((ms % 1000U) * 1000000UL);
+
+        while (::nanosleep(&ts, &ts) != 0)
+        {
+        }
+    }
+
+}
+
+uint64_t uptime_us() noexcept
+{
+    struct timespec ts;
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (static_cast<uint64_t>(ts.tv_sec) * 1000000U) + (static_cast<uint64_t>(ts.tv_nsec) / 1000U);
+}
+
+#endif
+
+}